@@ -124,9 +124,9 @@ set(DNNL_ENABLE_PRIMITIVE "ALL" CACHE STRING
     - ALL (the default). Includes all primitives to be enabled.
     - <PRIMITIVE_NAME>. Includes only the selected primitive to be enabled.
       Possible values are: BATCH_NORMALIZATION, BINARY, CONCAT, CONVOLUTION,
-      DECONVOLUTION, ELTWISE, INNER_PRODUCT, LAYER_NORMALIZATION, LRN, MATMUL,
-      POOLING, PRELU, REDUCTION, REORDER, RESAMPLING, RNN, SHUFFLE, SOFTMAX,
-      SUM.
+      DECONVOLUTION, ELTWISE, EMBEDDING_BAG, INNER_PRODUCT, LAYER_NORMALIZATION,
+      LRN, MATMUL, POOLING, PRELU, REDUCTION, REORDER, RESAMPLING, RNN, SHUFFLE,
+      SOFTMAX, SUM, TOPK.
     - <PRIMITIVE_NAME>;<PRIMITIVE_NAME>;... Includes only selected primitives to
       be enabled at build time. This is treated as CMake string, thus, semicolon
       is a mandatory delimiter between names. This is the way to specify several
@@ -231,6 +231,13 @@ option(DNNL_ENABLE_ITT_TASKS
     on those ITT tasks and show corresponding timeline information."
     ON)
 
+option(DNNL_ENABLE_TRACE
+    "Enable the execution timeline tracer (on by default). When the
+    ONEDNN_TRACE_FILE environment variable is set, the start and end of
+    primitive executions and parallel region tasks are recorded per thread
+    and written in the Chrome trace event format."
+    ON)
+
 # ===================
 # Engine capabilities
 # ===================
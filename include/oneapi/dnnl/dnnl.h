@@ -358,6 +358,31 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_set_scratchpad_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_scales_mask(
         dnnl_primitive_attr_t attr, int arg, int mask);
 
+/// Sets primitive attributes scaling factors for primitive operations for a
+/// given memory argument. The scaling factors must be passed at execution time
+/// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
+///
+/// @sa dnnl_primitive_attr_set_scales_mask
+///
+///
+/// @param attr Primitive attributes.
+/// @param arg Parameter argument index as passed to the
+///     dnnl_primitive_execute() call.
+/// @param mask Scaling factors correspondence mask that defines the
+///     correspondence between the tensor dimensions and the @p scales array.
+///     The set i-th bit indicates that a dedicated scaling factor is used for
+///     each group of indices along that dimension.
+/// @param ndims Number of group dimensions.
+/// @param group_dims Scaling factors correspondence groups that define the
+///     number of consecutive elements along the last @p ndims dimensions of
+///     the tensor that share the same scaling factor.
+/// @param data_type Scaling factors data type.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_scales(
+        dnnl_primitive_attr_t attr, int arg, int mask, int ndims,
+        const dnnl_dims_t group_dims, dnnl_data_type_t data_type);
+
 /// Sets primitive attributes zero points for primitive operations for a given
 /// memory argument. The zero points must be passed at execution time
 /// as an argument with index #DNNL_ARG_ATTR_ZERO_POINTS | arg.
@@ -378,6 +403,31 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_set_scales_mask(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_zero_points_mask(
         dnnl_primitive_attr_t attr, int arg, int mask);
 
+/// Sets primitive attributes zero points for primitive operations for a given
+/// memory argument. The zero points must be passed at execution time
+/// as an argument with index #DNNL_ARG_ATTR_ZERO_POINTS | arg.
+///
+/// @sa dnnl_primitive_attr_set_zero_points_mask
+///
+///
+/// @param attr Primitive attributes.
+/// @param arg Parameter argument index as passed to the
+///     dnnl_primitive_execute() call.
+/// @param mask Zero point correspondence mask that defines the
+///     correspondence between the tensor dimensions and the @p
+///     zero_points array. The set i-th bit indicates that a dedicated
+///     zero point is used for each group of indices along that dimension.
+/// @param ndims Number of group dimensions.
+/// @param group_dims Zero point correspondence groups that define the number
+///     of consecutive elements along the last @p ndims dimensions of the
+///     tensor that share the same zero point.
+/// @param data_type Zero points data type.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_zero_points(
+        dnnl_primitive_attr_t attr, int arg, int mask, int ndims,
+        const dnnl_dims_t group_dims, dnnl_data_type_t data_type);
+
 /// Returns primitive attributes post-ops.
 ///
 /// @warning
@@ -3290,6 +3340,78 @@ dnnl_status_t DNNL_API dnnl_reduction_primitive_desc_create(
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_topk Top-k
+/// @{
+
+/// Creates a primitive descriptor for a top-k primitive.
+///
+/// The primitive selects the k largest values of the source along @p axis,
+/// where k is the size of the destination along @p axis. The values are
+/// stored in decreasing order along with their s32 indices in the source.
+/// Equal values are ordered by increasing index.
+///
+/// @note
+///     Destination memory descriptors are allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination values memory descriptor.
+/// @param dst_indices_desc Destination indices memory descriptor. Must have
+///     the same dimensions as @p dst_desc and the #dnnl_s32 data type.
+/// @param axis The axis along which the values are selected.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_topk_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t dst_indices_desc, int axis,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_topk
+
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+/// @{
+
+/// Creates a primitive descriptor for an embedding bag primitive.
+///
+/// The primitive gathers the rows of an embedding table (the source) listed
+/// in the indices and pools each bag of rows into a single destination row.
+/// Bag b consists of the indices from offsets[b] up to offsets[b + 1], or up
+/// to the end of the indices for the last bag. Empty bags produce zeros.
+///
+/// Integer tables are dequantized using the source scales and zero points
+/// attributes with the mask either 0 (common) or 1 (one value per table row).
+///
+/// @note
+///     The destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Pooling algorithm kind: #dnnl_reduction_sum,
+///     #dnnl_reduction_mean or #dnnl_reduction_max.
+/// @param src_desc Embedding table memory descriptor, a 2D tensor of table
+///     rows by embedding dimension.
+/// @param indices_desc Indices memory descriptor, a 1D #dnnl_s32 tensor.
+/// @param offsets_desc Offsets memory descriptor, a 1D #dnnl_s32 tensor with
+///     one element per bag.
+/// @param dst_desc Destination memory descriptor, a 2D tensor of bags by
+///     embedding dimension.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_embedding_bag_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_embedding_bag
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_primitive_cache
@@ -3318,6 +3440,29 @@ dnnl_status_t DNNL_API dnnl_get_primitive_cache_capacity(int *capacity);
 ///     success.
 dnnl_status_t DNNL_API dnnl_set_primitive_cache_capacity(int capacity);
 
+/// Returns the number of shards the primitive cache is split into. Each shard
+/// is an independent cache holding a part of the primitive cache capacity.
+///
+/// @param shards Number of primitive cache shards to query. The value is 0 if
+///     the primitive cache is disabled at build time.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p shards value is invalid, and #dnnl_success/#dnnl::status::success on
+///     success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_shards(int *shards);
+
+/// Returns hit, miss and eviction counters of a primitive cache shard.
+///
+/// @param shard Index of the shard, must be less than the number of shards
+///     returned by dnnl_get_primitive_cache_shards().
+/// @param stats Output statistics. Concurrently accessing the primitive cache
+///     is safe, but the counters are not guaranteed to be consistent with each
+///     other in this case.
+/// @returns #dnnl_invalid_arguments/#dnnl::status::invalid_arguments if the
+///     @p shard or @p stats value is invalid, and
+///     #dnnl_success/#dnnl::status::success on success.
+dnnl_status_t DNNL_API dnnl_get_primitive_cache_stats(
+        int shard, dnnl_primitive_cache_stats_t *stats);
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_service
@@ -3385,6 +3530,22 @@ dnnl_status_t DNNL_API dnnl_set_jit_profiling_flags(unsigned flags);
 /// @returns #dnnl_unimplemented/#dnnl::status::unimplemented on Windows.
 dnnl_status_t DNNL_API dnnl_set_jit_profiling_jitdumpdir(const char *dir);
 
+/// Writes the execution timeline recorded so far in the Chrome trace event
+/// format.
+///
+/// The timeline is recorded only when the ONEDNN_TRACE_FILE environment
+/// variable is set, and is also written to that file at exit.
+///
+/// @sa @ref dev_guide_profilers
+///
+/// @param path Output file path.
+/// @returns #dnnl_success/#dnnl::status::success if the file was written
+///     and an error status otherwise.
+/// @returns #dnnl_unimplemented/#dnnl::status::unimplemented if the feature
+///     was disabled at build time (see @ref dev_guide_build_options for more
+///     details).
+dnnl_status_t DNNL_API dnnl_dump_trace(const char *path);
+
 /// Sets the maximal ISA the library can dispatch to on the CPU. See
 /// #dnnl_cpu_isa_t and #dnnl::cpu_isa for the list of the values accepted by
 /// the C and C++ API functions respectively.
@@ -3460,6 +3621,24 @@ dnnl_status_t DNNL_API dnnl_set_cpu_isa_hints(dnnl_cpu_isa_hints_t isa_hints);
 /// library can follow.
 dnnl_cpu_isa_hints_t DNNL_API dnnl_get_cpu_isa_hints(void);
 
+/// Configures placement of large CPU buffers.
+///
+/// When enabled, memory objects and scratchpads of CPU engines that are at
+/// least 2 MB large are aligned to 2 MB, advised to be backed by transparent
+/// huge pages (on Linux), and first touched by the threads of the library in
+/// the same static partitioning the primitives use, so that the pages are
+/// placed on the NUMA nodes of the threads that access them.
+///
+/// @note
+///     This setting overrides the ONEDNN_CPU_HUGEPAGES environment variable.
+///     It affects only the buffers allocated after the call.
+///
+/// @param enable Flag value. Set to 0 to disable and set to 1 to enable.
+/// @returns #dnnl_success/#dnnl::status::success on success and a
+///     #dnnl_unimplemented/#dnnl::status::unimplemented if the library was
+///     built without CPU support.
+dnnl_status_t DNNL_API dnnl_set_cpu_hugepages(int enable);
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -3481,6 +3660,11 @@ dnnl_status_t DNNL_API dnnl_reset_profiling(dnnl_stream_t stream);
 /// @p num_entries the @p data parameter should be NULL. When @p data is NULL
 /// then the @p data_kind parameter is ignored.
 ///
+/// On CPU engines, when @p data is not NULL, @p num_entries is the capacity
+/// of @p data on input. At most that many entries are written and the number
+/// of available entries is returned, which is greater than the capacity if
+/// the data was truncated.
+///
 /// The profiling data can be reset by calling #dnnl_reset_profiling.
 ///
 /// @note
@@ -3498,6 +3682,28 @@ dnnl_status_t DNNL_API dnnl_reset_profiling(dnnl_stream_t stream);
 dnnl_status_t DNNL_API dnnl_query_profiling_data(dnnl_stream_t stream,
         dnnl_profiling_data_kind_t data_kind, int *num_entries, uint64_t *data);
 
+/// Queries implementation names of the profiled primitive executions. The
+/// order of the names matches the order of the entries returned by
+/// #dnnl_query_profiling_data. In order to query the @p num_entries the
+/// @p names parameter should be NULL. When @p names is not NULL,
+/// @p num_entries is the capacity of @p names on input, and the number of
+/// available entries is returned as for #dnnl_query_profiling_data.
+/// Supported for CPU engines only.
+///
+/// @note
+///     The returned strings remain valid until the next
+///     #dnnl_reset_profiling call or until the stream is destroyed.
+///
+/// @param stream Stream that was used for executing a primitive that
+/// is being profiled.
+/// @param num_entries Number of profiling data entries.
+/// @param names Implementation names.
+///
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_query_profiling_impl_names(
+        dnnl_stream_t stream, int *num_entries, const char **names);
+
 /// @} dnnl_api_profiling
 #endif
 
@@ -3684,6 +3890,371 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Performs a batch of single precision matrix-matrix multiplies with the
+/// matrices located at a constant stride from each other.
+///
+/// For each `i` in `[0, batch)` the operation is the same as the one of
+/// #dnnl_sgemm() with the matrices `A + i * stride_a`, `B + i * stride_b`,
+/// and `C + i * stride_c`. The work of the whole batch is distributed between
+/// the threads at once, which is more efficient than a sequence of
+/// #dnnl_sgemm() calls for small matrices.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the A matrices.
+/// @param stride_a The stride (in elements) between the A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the B matrices.
+/// @param stride_b The stride (in elements) between the B matrices.
+/// @param beta The beta parameter that is used to scale the C matrices.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the C matrices.
+/// @param stride_c The stride (in elements) between the C matrices.
+/// @param batch The number of matrix-matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch);
+
+/// Performs a batch of single precision matrix-matrix multiplies with the
+/// matrices given by arrays of pointers.
+///
+/// For each `i` in `[0, batch)` the operation is the same as the one of
+/// #dnnl_sgemm() with the matrices `A[i]`, `B[i]`, and `C[i]`. All the
+/// matrices share the same dimensions and leading dimensions.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A An array of @p batch pointers to the A matrices data.
+/// @param lda The leading dimension for the A matrices.
+/// @param B An array of @p batch pointers to the B matrices data.
+/// @param ldb The leading dimension for the B matrices.
+/// @param beta The beta parameter that is used to scale the C matrices.
+/// @param C An array of @p batch pointers to the C matrices data.
+/// @param ldc The leading dimension for the C matrices.
+/// @param batch The number of matrix-matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const float *const *A, dnnl_dim_t lda, const float *const *B,
+        dnnl_dim_t ldb, float beta, float *const *C, dnnl_dim_t ldc,
+        dnnl_dim_t batch);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting
+/// matrices C located at a constant stride from each other.
+///
+/// For each `i` in `[0, batch)` the operation is the same as the one of
+/// #dnnl_gemm_u8s8s32() with the matrices `A + i * stride_a`,
+/// `B + i * stride_b`, and `C + i * stride_c`. The offsets @p ao, @p bo, and
+/// @p co are shared by all the matrices.
+///
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param offsetc Flag specifying how offsets should be applied to matrix C
+///     (see #dnnl_gemm_u8s8s32()).
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the A matrices.
+/// @param stride_a The stride (in elements) between the A matrices.
+/// @param ao The offset value for the A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the B matrices.
+/// @param stride_b The stride (in elements) between the B matrices.
+/// @param bo The offset value for the B matrices.
+/// @param beta The beta parameter that is used to scale the C matrices.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the C matrices.
+/// @param stride_c The stride (in elements) between the C matrices.
+/// @param co An array of offset values for the C matrices.
+/// @param batch The number of matrix-matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        uint8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting
+/// matrices C given by arrays of pointers.
+///
+/// For each `i` in `[0, batch)` the operation is the same as the one of
+/// #dnnl_gemm_u8s8s32() with the matrices `A[i]`, `B[i]`, and `C[i]`. The
+/// offsets @p ao, @p bo, and @p co are shared by all the matrices.
+///
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param offsetc Flag specifying how offsets should be applied to matrix C
+///     (see #dnnl_gemm_u8s8s32()).
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A An array of @p batch pointers to the A matrices data.
+/// @param lda The leading dimension for the A matrices.
+/// @param ao The offset value for the A matrices.
+/// @param B An array of @p batch pointers to the B matrices data.
+/// @param ldb The leading dimension for the B matrices.
+/// @param bo The offset value for the B matrices.
+/// @param beta The beta parameter that is used to scale the C matrices.
+/// @param C An array of @p batch pointers to the C matrices data.
+/// @param ldc The leading dimension for the C matrices.
+/// @param co An array of offset values for the C matrices.
+/// @param batch The number of matrix-matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *const *A, dnnl_dim_t lda, uint8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co,
+        dnnl_dim_t batch);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit signed
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting
+/// matrices C located at a constant stride from each other.
+///
+/// For each `i` in `[0, batch)` the operation is the same as the one of
+/// #dnnl_gemm_s8s8s32() with the matrices `A + i * stride_a`,
+/// `B + i * stride_b`, and `C + i * stride_c`. The offsets @p ao, @p bo, and
+/// @p co are shared by all the matrices.
+///
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param offsetc Flag specifying how offsets should be applied to matrix C
+///     (see #dnnl_gemm_s8s8s32()).
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the A matrices.
+/// @param stride_a The stride (in elements) between the A matrices.
+/// @param ao The offset value for the A matrices.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the B matrices.
+/// @param stride_b The stride (in elements) between the B matrices.
+/// @param bo The offset value for the B matrices.
+/// @param beta The beta parameter that is used to scale the C matrices.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the C matrices.
+/// @param stride_c The stride (in elements) between the C matrices.
+/// @param co An array of offset values for the C matrices.
+/// @param batch The number of matrix-matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        int8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit signed
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting
+/// matrices C given by arrays of pointers.
+///
+/// For each `i` in `[0, batch)` the operation is the same as the one of
+/// #dnnl_gemm_s8s8s32() with the matrices `A[i]`, `B[i]`, and `C[i]`. The
+/// offsets @p ao, @p bo, and @p co are shared by all the matrices.
+///
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param offsetc Flag specifying how offsets should be applied to matrix C
+///     (see #dnnl_gemm_s8s8s32()).
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A An array of @p batch pointers to the A matrices data.
+/// @param lda The leading dimension for the A matrices.
+/// @param ao The offset value for the A matrices.
+/// @param B An array of @p batch pointers to the B matrices data.
+/// @param ldb The leading dimension for the B matrices.
+/// @param bo The offset value for the B matrices.
+/// @param beta The beta parameter that is used to scale the C matrices.
+/// @param C An array of @p batch pointers to the C matrices data.
+/// @param ldc The leading dimension for the C matrices.
+/// @param co An array of offset values for the C matrices.
+/// @param batch The number of matrix-matrix multiplies.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *const *A, dnnl_dim_t lda, int8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co,
+        dnnl_dim_t batch);
+
+/// Returns the size of a buffer required to pack a matrix for
+/// #dnnl_sgemm_compute().
+///
+/// The packed layout depends on the maximum number of threads available to
+/// the library at the time of the call: #dnnl_sgemm_compute() uses the work
+/// partitioning the matrix was packed for.
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for the A matrix, and 'B' or
+///     'b' for the B matrix.
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success,
+///     #dnnl_unimplemented/#dnnl::status::unimplemented if packing is not
+///     supported on the system, and a status describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size);
+
+/// Packs a matrix for #dnnl_sgemm_compute().
+///
+/// @param identifier Matrix to pack: 'A' or 'a' for the A matrix, and 'B' or
+///     'b' for the B matrix.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the data of the matrix to pack.
+/// @param dst A pointer to the buffer of at least the size returned by
+///     #dnnl_sgemm_pack_get_size() for the same parameters.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, void *dst);
+
+/// Performs single-precision matrix-matrix multiply with packed matrices.
+///
+/// The operation is defined as:
+///
+/// `C := op( A )*op( B ) + beta*C`
+///
+/// where `op( X ) = X`, `op( X ) = X**T`, or X is a matrix packed with
+/// #dnnl_sgemm_pack(). The dimensions, transposition flags, and leading
+/// dimensions must be the same as the ones used to pack the matrices.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, 'T' or 't' means that A is transposed, and 'P' or 'p'
+///     means that A is packed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, 'T' or 't' means that B is transposed, and 'P' or 'p'
+///     means that B is packed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or to the packed A matrix.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data or to the packed B matrix.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_compute(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc);
+
+/// Returns the size of a buffer required to pack a matrix for
+/// #dnnl_gemm_u8s8s32_compute().
+///
+/// @sa #dnnl_sgemm_pack_get_size() for the description of the parameters.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs an 8-bit unsigned A matrix or an 8-bit signed B matrix for
+/// #dnnl_gemm_u8s8s32_compute().
+///
+/// @sa #dnnl_sgemm_pack() for the description of the parameters.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs integer matrix-matrix multiply on 8-bit unsigned matrix A, 8-bit
+/// signed matrix B, and 32-bit signed resulting matrix C, any of A and B may
+/// be packed with #dnnl_gemm_u8s8s32_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op(A) * op(B) + beta * C + C_offset`
+///
+/// @sa #dnnl_gemm_u8s8s32() for the description of @p offsetc and @p co, and
+///     #dnnl_sgemm_compute() for the description of the other parameters.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co);
+
+/// Returns the size of a buffer required to pack a matrix for
+/// #dnnl_gemm_s8s8s32_compute().
+///
+/// @sa #dnnl_sgemm_pack_get_size() for the description of the parameters.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs an 8-bit signed A or B matrix for #dnnl_gemm_s8s8s32_compute().
+///
+/// @sa #dnnl_sgemm_pack() for the description of the parameters.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_pack(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst);
+
+/// Performs integer matrix-matrix multiply on 8-bit signed matrix A, 8-bit
+/// signed matrix B, and 32-bit signed resulting matrix C, any of A and B may
+/// be packed with #dnnl_gemm_s8s8s32_pack().
+///
+/// The operation is defined as:
+///
+/// `C := op(A) * op(B) + beta * C + C_offset`
+///
+/// @sa #dnnl_gemm_s8s8s32() for the description of @p offsetc and @p co, and
+///     #dnnl_sgemm_compute() for the description of the other parameters.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_compute(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
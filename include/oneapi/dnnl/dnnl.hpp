@@ -148,6 +148,10 @@ struct primitive : public handle<dnnl_primitive_t> {
         layer_normalization = dnnl_layer_normalization,
         /// A group normalization primitive
         group_normalization = dnnl_group_normalization,
+        /// A top-k primitive.
+        topk = dnnl_topk,
+        /// An embedding bag primitive.
+        embedding_bag = dnnl_embedding_bag,
     };
 
     using handle::handle;
@@ -530,6 +534,11 @@ enum class normalization_flags : unsigned {
     /// On training, normalization will require the workspace to implement
     /// backward propagation. On inference, the workspace is not required.
     fuse_norm_add_relu = dnnl_fuse_norm_add_relu,
+
+    /// Use Root Mean Square (RMS) normalization. The mean is considered to be
+    /// zero and the mean of squares is used in place of the variance. Only
+    /// supported by layer normalization.
+    rms_norm = dnnl_rms_norm,
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -856,6 +865,10 @@ struct memory : public handle<dnnl_memory_t> {
         s8 = dnnl_s8,
         /// 8-bit unsigned integer.
         u8 = dnnl_u8,
+        /// 4-bit signed integer.
+        s4 = dnnl_s4,
+        /// 4-bit unsigned integer.
+        u4 = dnnl_u4,
     };
 
     /// Returns size of data type in bytes.
@@ -3927,6 +3940,31 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set scales primitive attribute");
     }
 
+    /// Sets scaling factors for primitive operations for a given memory
+    /// argument. The scaling factors must be passed at execution time
+    /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
+    ///
+    /// @sa dnnl_primitive_attr_set_scales
+    ///
+    /// @param arg Parameter argument index as passed to the
+    ///     primitive::execute() call.
+    /// @param mask Scaling factors correspondence mask that defines the
+    ///     correspondence between the tensor dimensions and the @p scales
+    ///     vector. The set i-th bit indicates that a dedicated scaling factor
+    ///     is used for each group of indices along that dimension.
+    /// @param groups Scaling factors correspondence groups that define the
+    ///     number of consecutive elements along the last dimensions of the
+    ///     tensor that share the same scaling factor.
+    /// @param data_type Scaling factors data type.
+    void set_scales(int arg, int mask, const memory::dims &groups,
+            memory::data_type data_type = memory::data_type::f32) {
+        memory::validate_dims(groups);
+        error::wrap_c_api(dnnl_primitive_attr_set_scales(get(), arg, mask,
+                                  (int)groups.size(), groups.data(),
+                                  memory::convert_to_c(data_type)),
+                "could not set scales primitive attribute");
+    }
+
     /// Sets zero points for primitive operations for a given memory argument.
     /// The zero points must be passed at execution time as an argument with
     /// index #DNNL_ARG_ATTR_ZERO_POINTS | arg.
@@ -3946,6 +3984,31 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set zero points primitive attribute");
     }
 
+    /// Sets zero points for primitive operations for a given memory argument.
+    /// The zero points must be passed at execution time as an argument with
+    /// index #DNNL_ARG_ATTR_ZERO_POINTS | arg.
+    ///
+    /// @sa dnnl_primitive_attr_set_zero_points
+    ///
+    /// @param arg Parameter argument index as passed to the
+    ///     primitive::execute() call.
+    /// @param mask Zero point correspondence mask that defines the
+    ///     correspondence between the tensor dimensions and the @p
+    ///     zero_points vector. The set i-th bit indicates that a dedicated
+    ///     zero point is used for each group of indices along that dimension.
+    /// @param groups Zero point correspondence groups that define the number
+    ///     of consecutive elements along the last dimensions of the tensor
+    ///     that share the same zero point.
+    /// @param data_type Zero points data type.
+    void set_zero_points(int arg, int mask, const memory::dims &groups,
+            memory::data_type data_type = memory::data_type::s32) {
+        memory::validate_dims(groups);
+        error::wrap_c_api(dnnl_primitive_attr_set_zero_points(get(), arg,
+                                  mask, (int)groups.size(), groups.data(),
+                                  memory::convert_to_c(data_type)),
+                "could not set zero points primitive attribute");
+    }
+
     /// Returns post-ops previously set via set_post_ops().
     ///
     /// @returns Post-ops.
@@ -13196,6 +13259,196 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_topk Top-k
+///
+/// A primitive to select the largest values of a tensor along an axis and
+/// their indices.
+///
+/// @{
+
+/// Top-k primitive.
+struct topk : public primitive {
+    /// Primitive descriptor for a top-k primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a top-k primitive.
+        ///
+        /// The number of selected values is the size of the destination
+        /// along @p axis.
+        ///
+        /// @note
+        ///     Destination memory descriptors may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination values memory descriptor.
+        /// @param dst_indices_desc Destination indices memory descriptor.
+        /// @param axis The axis along which the values are selected.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &dst_desc,
+                const memory::desc &dst_indices_desc, int axis,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_topk_primitive_desc_create(&pd,
+                    aengine.get(), src_desc.get(), dst_desc.get(),
+                    dst_indices_desc.get(), axis, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a top-k "
+                        "primitive");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a top-k primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a top-k primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::topk) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns a destination indices memory descriptor.
+        /// @returns Destination indices memory descriptor.
+        memory::desc dst_indices_desc() const { return base::dst_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_axis()const
+        int get_axis() const { return base::get_axis(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    topk() = default;
+
+    /// Constructs a top-k primitive.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    topk(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a top-k primitive from a cache blob.
+    /// @param pd Primitive descriptor for a top-k primitive.
+    /// @param cache_blob Cache blob.
+    topk(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_topk
+
+/// @addtogroup dnnl_api_embedding_bag Embedding Bag
+///
+/// A primitive to gather rows of an embedding table and pool them in bags.
+///
+/// @{
+
+/// Embedding bag primitive.
+struct embedding_bag : public primitive {
+    /// Primitive descriptor for an embedding bag primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an embedding bag primitive.
+        ///
+        /// Bag b pools the table rows listed in the indices from offsets[b]
+        /// up to offsets[b + 1], or up to the end of the indices for the last
+        /// bag.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Pooling algorithm kind: either
+        ///     #dnnl::algorithm::reduction_sum,
+        ///     #dnnl::algorithm::reduction_mean, or
+        ///     #dnnl::algorithm::reduction_max.
+        /// @param src_desc Embedding table memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Offsets memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_embedding_bag_primitive_desc_create(
+                    &pd, aengine.get(), convert_to_c(aalgorithm),
+                    src_desc.get(), indices_desc.get(), offsets_desc.get(),
+                    dst_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for an "
+                        "embedding bag primitive");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for an embedding bag primitive
+        /// from a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an embedding bag
+        ///     primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::embedding_bag) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns an indices memory descriptor.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const { return base::src_desc(1); }
+
+        /// Returns an offsets memory descriptor.
+        /// @returns Offsets memory descriptor.
+        memory::desc offsets_desc() const { return base::src_desc(2); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    embedding_bag() = default;
+
+    /// Constructs an embedding bag primitive.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    embedding_bag(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs an embedding bag primitive from a cache blob.
+    /// @param pd Primitive descriptor for an embedding bag primitive.
+    /// @param cache_blob Cache blob.
+    embedding_bag(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_embedding_bag
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -13267,6 +13520,11 @@ inline status set_jit_profiling_jitdumpdir(const std::string &dir) {
     return static_cast<status>(dnnl_set_jit_profiling_jitdumpdir(dir.c_str()));
 }
 
+/// @copydoc dnnl_dump_trace()
+inline status dump_trace(const std::string &path) {
+    return static_cast<status>(dnnl_dump_trace(path.c_str()));
+}
+
 /// @copydoc dnnl_cpu_isa_t
 enum class cpu_isa {
     /// @copydoc dnnl_cpu_isa_default
@@ -13325,6 +13583,11 @@ inline cpu_isa_hints get_cpu_isa_hints() {
     return static_cast<cpu_isa_hints>(dnnl_get_cpu_isa_hints());
 }
 
+/// @copydoc dnnl_set_cpu_hugepages()
+inline status set_cpu_hugepages(int enable) {
+    return static_cast<status>(dnnl_set_cpu_hugepages(enable));
+}
+
 /// @} dnnl_api_service
 
 #ifdef DNNL_EXPERIMENTAL_PROFILING
@@ -13337,6 +13600,10 @@ enum class profiling_data_kind {
     undef = dnnl_profiling_data_kind_undef,
     /// Data kind to query an execution time in nanoseconds.
     time = dnnl_profiling_data_kind_time,
+    /// @copydoc dnnl_profiling_data_kind_start_time
+    start_time = dnnl_profiling_data_kind_start_time,
+    /// @copydoc dnnl_profiling_data_kind_primitive_kind
+    primitive_kind = dnnl_profiling_data_kind_primitive_kind,
 };
 
 /// Resets a profiler's state.
@@ -13382,6 +13649,29 @@ inline std::vector<uint64_t> get_profiling_data(
     return data;
 }
 
+/// Returns implementation names of the profiled primitive executions. The
+/// order of the names matches the order of the entries returned by
+/// #dnnl::get_profiling_data. Supported for CPU engines only.
+///
+/// @param stream Stream that was used for executing a primitive that
+///     is being profiled.
+///
+/// @returns A vector with the implementation names.
+inline std::vector<std::string> get_profiling_impl_names(stream &stream) {
+    int num_entries = 0;
+    error::wrap_c_api(dnnl_query_profiling_impl_names(
+                              stream.get(), &num_entries, nullptr),
+            "could not get number of entries for profiling data");
+
+    if (num_entries == 0) return {};
+
+    std::vector<const char *> names(num_entries);
+    error::wrap_c_api(dnnl_query_profiling_impl_names(
+                              stream.get(), &num_entries, names.data()),
+            "could not get profiling implementation names");
+    return std::vector<std::string>(names.begin(), names.end());
+}
+
 /// @} dnnl_api_profiling
 #endif
 
@@ -13406,6 +13696,27 @@ inline void set_primitive_cache_capacity(int capacity) {
             "could not set primitive cache capacity");
 }
 
+/// @copydoc dnnl_primitive_cache_stats_t
+using primitive_cache_stats_t = dnnl_primitive_cache_stats_t;
+
+/// Returns the number of shards the primitive cache is split into.
+inline int get_primitive_cache_shards() {
+    int result = 0;
+    error::wrap_c_api(dnnl_get_primitive_cache_shards(&result),
+            "could not get primitive cache shards");
+    return result;
+}
+
+/// Returns hit, miss and eviction counters of a primitive cache shard.
+///
+/// @param shard Index of the shard.
+inline primitive_cache_stats_t get_primitive_cache_stats(int shard) {
+    primitive_cache_stats_t result {};
+    error::wrap_c_api(dnnl_get_primitive_cache_stats(shard, &result),
+            "could not get primitive cache statistics");
+    return result;
+}
+
 /// @} dnnl_api_primitive_cache
 
 /// @addtogroup dnnl_api_blas BLAS functions
@@ -13441,6 +13752,146 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_sgemm_batch_strided()
+inline status sgemm_batch_strided(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_sgemm_batch_strided(transa, transb, M, N,
+            K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+            stride_c, batch));
+}
+
+/// @copydoc dnnl_sgemm_batch()
+inline status sgemm_batch(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *const *A,
+        dnnl_dim_t lda, const float *const *B, dnnl_dim_t ldb, float beta,
+        float *const *C, dnnl_dim_t ldc, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_sgemm_batch(transa, transb, M, N, K,
+            alpha, A, lda, B, ldb, beta, C, ldc, batch));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch_strided()
+inline status gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, uint8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b,
+            bo, beta, C, ldc, stride_c, co, batch));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch()
+inline status gemm_u8s8s32_batch(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *const *A, dnnl_dim_t lda, uint8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co,
+        dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch(transa, transb, offsetc,
+            M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co, batch));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch_strided()
+inline status gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, int8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b,
+            bo, beta, C, ldc, stride_c, co, batch));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch()
+inline status gemm_s8s8s32_batch(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *const *A, dnnl_dim_t lda, int8_t ao,
+        const int8_t *const *B, dnnl_dim_t ldb, int8_t bo, float beta,
+        int32_t *const *C, dnnl_dim_t ldc, const int32_t *co,
+        dnnl_dim_t batch) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch(transa, transb, offsetc,
+            M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co, batch));
+}
+
+/// @copydoc dnnl_sgemm_pack_get_size()
+inline status sgemm_pack_get_size(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_sgemm_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_sgemm_pack()
+inline status sgemm_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const float *src, void *dst) {
+    return static_cast<status>(dnnl_sgemm_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_sgemm_compute()
+inline status sgemm_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const void *A, dnnl_dim_t lda,
+        const void *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_sgemm_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack_get_size()
+inline status gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_pack()
+inline status gemm_u8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_compute()
+inline status gemm_u8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_pack_get_size()
+inline status gemm_s8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_pack()
+inline status gemm_s8s8s32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const void *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_compute()
+inline status gemm_s8s8s32_compute(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, int32_t *C,
+        dnnl_dim_t ldc, const int32_t *co) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_compute(transa, transb,
+            offsetc, M, N, K, A, lda, B, ldb, beta, C, ldc, co));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
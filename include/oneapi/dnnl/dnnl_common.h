@@ -54,6 +54,29 @@ size_t DNNL_API dnnl_engine_get_count(dnnl_engine_kind_t kind);
 dnnl_status_t DNNL_API dnnl_engine_create(
         dnnl_engine_t *engine, dnnl_engine_kind_t kind, size_t index);
 
+/// Creates a CPU engine that allocates memory with user-provided call-back
+/// functions.
+///
+/// The call-back functions are used for all memory objects and scratchpads
+/// the library allocates on behalf of the engine, including the memory for
+/// packed weights and temporary buffers of primitives. Memory allocated with
+/// @p allocate is released with @p deallocate, the call-back functions must
+/// be thread-safe and valid until all the objects created with the engine
+/// are destroyed.
+///
+/// @param engine Output engine.
+/// @param kind Engine kind. Must be #dnnl_cpu.
+/// @param index Engine index that should be between 0 and the count of
+///     engines of the requested kind.
+/// @param allocate Allocation call-back function. The returned memory must be
+///     aligned to at least the requested alignment.
+/// @param deallocate Deallocation call-back function.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_engine_create_with_allocator(dnnl_engine_t *engine,
+        dnnl_engine_kind_t kind, size_t index, dnnl_host_allocate_f allocate,
+        dnnl_host_deallocate_f deallocate);
+
 /// Returns the kind of an engine.
 ///
 /// @param engine Engine to query.
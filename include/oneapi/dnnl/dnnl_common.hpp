@@ -275,6 +275,26 @@ struct engine : public handle<dnnl_engine_t> {
         reset(engine);
     }
 
+    /// Constructs a CPU engine that allocates memory with user-provided
+    /// call-back functions. The call-back functions must be thread-safe and
+    /// valid until all the objects created with the engine are destroyed.
+    ///
+    /// @param akind The kind of engine to construct. Must be
+    ///     #dnnl::engine::kind::cpu.
+    /// @param index The index of the engine. Must be less than the value
+    ///     returned by #get_count() for this particular kind of engine.
+    /// @param allocate Allocation call-back function.
+    /// @param deallocate Deallocation call-back function.
+    engine(kind akind, size_t index, dnnl_host_allocate_f allocate,
+            dnnl_host_deallocate_f deallocate) {
+        dnnl_engine_t engine;
+        error::wrap_c_api(dnnl_engine_create_with_allocator(&engine,
+                                  convert_to_c(akind), index, allocate,
+                                  deallocate),
+                "could not create an engine");
+        reset(engine);
+    }
+
     /// Returns the kind of the engine.
     /// @returns The kind of the engine.
     kind get_kind() const {
@@ -98,6 +98,10 @@ typedef enum {
     /// [OFP8 standard 8-bit floating-point](https://www.opencompute.org/documents/ocp-8-bit-floating-point-specification-ofp8-revision-1-0-2023-06-20-pdf)
     /// with a 4-bit exponent and a 3-bit mantissa.
     dnnl_f8_e4m3 = 10,
+    /// 4-bit signed integer.
+    dnnl_s4 = 11,
+    /// 4-bit unsigned integer.
+    dnnl_u4 = 12,
 
     /// Parameter to allow internal only data_types without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -184,6 +188,14 @@ typedef struct dnnl_engine *dnnl_engine_t;
 typedef const struct dnnl_engine *const_dnnl_engine_t;
 #endif
 
+/// Allocation call-back function interface for host memory used by CPU
+/// engines (see #dnnl_engine_create_with_allocator()).
+typedef void *(*dnnl_host_allocate_f)(size_t size, size_t alignment);
+
+/// Deallocation call-back function interface for host memory used by CPU
+/// engines (see #dnnl_engine_create_with_allocator()).
+typedef void (*dnnl_host_deallocate_f)(void *ptr);
+
 /// @} dnnl_api_engine
 
 /// @addtogroup dnnl_api_stream Stream
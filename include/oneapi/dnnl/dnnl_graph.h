@@ -383,6 +383,20 @@ dnnl_status_t DNNL_API dnnl_graph_partition_get_ops(
 dnnl_status_t DNNL_API dnnl_graph_partition_get_id(
         const_dnnl_graph_partition_t partition, size_t *id);
 
+/// Enables or disables inter-op parallelism for a partition. When enabled, the
+/// partitions compiled afterwards may execute independent operations of the
+/// partition concurrently, each of them using a part of the available threads.
+/// The setting only takes effect for partitions executed on CPU with the
+/// OpenMP or TBB threading runtimes and is disabled by default.
+///
+/// @param partition The target partition.
+/// @param enable Non-zero value to enable inter-op parallelism, zero to
+///     disable it.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_partition_set_inter_op_parallelism(
+        dnnl_graph_partition_t partition, int enable);
+
 /// Compiles a partition with given input and output logical tensors. The output
 /// logical tensors can contain unknown dimensions. For this case, the
 /// compilation will deduce the output shapes according to input shapes. The
@@ -405,6 +419,33 @@ dnnl_status_t DNNL_API dnnl_graph_partition_compile(
         const dnnl_graph_logical_tensor_t **inputs, size_t out_num,
         const dnnl_graph_logical_tensor_t **outputs, dnnl_engine_t engine);
 
+/// Compiles a partition with given input and output logical tensors using a
+/// cache blob obtained with #dnnl_graph_compiled_partition_get_cache_blob().
+/// The cache blob is used to speed up creation of the primitives the
+/// compiled partition consists of. The cache blob must have been created for
+/// the same partition, input and output logical tensors, engine kind, CPU
+/// ISA, number of threads, and library version, otherwise the function
+/// returns #dnnl_invalid_arguments. The function returns #dnnl_unimplemented
+/// for engines other than GPU engines with the OpenCL runtime.
+///
+/// @param partition The target partition.
+/// @param compiled_partition Output compiled partition.
+/// @param in_num The number of input logical tensors.
+/// @param inputs A list of input logical tensors.
+/// @param out_num The number of output logical tensors.
+/// @param outputs A list of output logical tensors.
+/// @param engine The target engine of the compilation.
+/// @param size Size of the cache blob in bytes.
+/// @param cache_blob Cache blob of size @p size.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_partition_compile_from_cache_blob(
+        dnnl_graph_partition_t partition,
+        dnnl_graph_compiled_partition_t compiled_partition, size_t in_num,
+        const dnnl_graph_logical_tensor_t **inputs, size_t out_num,
+        const dnnl_graph_logical_tensor_t **outputs, dnnl_engine_t engine,
+        size_t size, const uint8_t *cache_blob);
+
 /// Returns the number of input logical tensors of a partition.
 ///
 /// @param partition The target partition.
@@ -541,6 +582,26 @@ dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_inplace_ports(
         size_t *num_inplace_pairs,
         const dnnl_graph_inplace_pair_t **inplace_pairs);
 
+/// Retrieves a cache blob associated with the given compiled partition.
+///
+/// The cache blob contains the cache blobs of the primitives the compiled
+/// partition consists of and can be passed to
+/// #dnnl_graph_partition_compile_from_cache_blob() to speed up compilation of
+/// the same partition, e.g. in another process. The function returns
+/// #dnnl_unimplemented if the compiled partition is not implemented with
+/// primitives, e.g. for graph compiler backend partitions, or if any of its
+/// primitives does not support cache blobs.
+///
+/// @param compiled_partition The handle of target compiled partition.
+/// @param size Size of the cache blob in bytes.
+/// @param cache_blob Cache blob of size @p size. If the @p cache_blob is
+///     nullptr then the size of the cache blob is returned in @p size.
+/// @returns #dnnl_success on success or a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_graph_compiled_partition_get_cache_blob(
+        const_dnnl_graph_compiled_partition_t compiled_partition, size_t *size,
+        uint8_t *cache_blob);
+
 /// @} dnnl_graph_api_compiled_partition
 
 /// @addtogroup dnnl_graph_api_graph
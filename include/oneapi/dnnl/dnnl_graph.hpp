@@ -705,6 +705,26 @@ public:
                         c_outputs.data()),
                 "could not execute the compiled_partition");
     }
+
+    /// Returns a cache blob for the compiled partition. The cache blob can be
+    /// passed to #dnnl::graph::partition::compile() to speed up compilation
+    /// of the same partition. Only compiled partitions for GPU engines with
+    /// the OpenCL runtime whose primitives all support cache blobs can be
+    /// exported, otherwise an exception is thrown.
+    ///
+    /// @returns The cache blob.
+    std::vector<uint8_t> get_cache_blob() const {
+        size_t size = 0;
+        error::wrap_c_api(dnnl_graph_compiled_partition_get_cache_blob(
+                                  get(), &size, nullptr),
+                "could not get cache blob size from a compiled partition");
+
+        std::vector<uint8_t> cache_blob(size);
+        error::wrap_c_api(dnnl_graph_compiled_partition_get_cache_blob(
+                                  get(), &size, cache_blob.data()),
+                "could not get a cache blob from a compiled partition");
+        return cache_blob;
+    }
 };
 
 /// @} dnnl_graph_api_compiled_partition
@@ -789,6 +809,7 @@ public:
         ReLU = dnnl_graph_op_relu,
         ReLUBackward = dnnl_graph_op_relu_backward,
         Reorder = dnnl_graph_op_reorder,
+        RMSNorm = dnnl_graph_op_rms_norm,
         Round = dnnl_graph_op_round,
         Select = dnnl_graph_op_select,
         Sigmoid = dnnl_graph_op_sigmoid,
@@ -1215,6 +1236,30 @@ public:
         return compile_(inputs, outputs, e);
     }
 
+    /// Compiles a partition with given input and output logical tensors using
+    /// a cache blob obtained with
+    /// #dnnl::graph::compiled_partition::get_cache_blob(). The cache blob
+    /// speeds up creation of the primitives the compiled partition consists
+    /// of. The cache blob must have been created for the same partition,
+    /// logical tensors, engine kind, CPU ISA, number of threads, and library
+    /// version. Supported for GPU engines with the OpenCL runtime only.
+    ///
+    /// @param inputs A list of input logical tensors.
+    /// @param outputs A list of output logical tensors.
+    /// @param e The engine used to compile the partition.
+    /// @param cache_blob Cache blob.
+    /// @returns A compiled partition.
+    compiled_partition compile(const std::vector<logical_tensor> &inputs,
+            const std::vector<logical_tensor> &outputs, const engine &e,
+            const std::vector<uint8_t> &cache_blob) const {
+        if (!is_supported()) {
+            error::wrap_c_api(dnnl_invalid_arguments,
+                    "could not compile an unsupported partition");
+        }
+
+        return compile_(inputs, outputs, e, &cache_blob);
+    }
+
     /// Returns the supporting status of a partition. Some operations may not be
     /// supported by the library under certain circumstances. During
     /// partitioning stage, unsupported partitions will be returned to users
@@ -1285,9 +1330,23 @@ public:
         return static_cast<engine::kind>(akind);
     }
 
+    /// Enables or disables inter-op parallelism for the partition. When
+    /// enabled, the partitions compiled afterwards may execute independent
+    /// operations concurrently, each of them using a part of the available
+    /// threads. The setting only takes effect for partitions executed on CPU
+    /// with the OpenMP or TBB threading runtimes and is disabled by default.
+    ///
+    /// @param enable Whether to enable inter-op parallelism.
+    void set_inter_op_parallelism(bool enable) {
+        error::wrap_c_api(dnnl_graph_partition_set_inter_op_parallelism(
+                                  get(), enable ? 1 : 0),
+                "could not set inter-op parallelism of the partition");
+    }
+
 private:
     compiled_partition compile_(const std::vector<logical_tensor> &inputs,
-            const std::vector<logical_tensor> &outputs, const engine &e) const {
+            const std::vector<logical_tensor> &outputs, const engine &e,
+            const std::vector<uint8_t> *cache_blob = nullptr) const {
         std::vector<const dnnl_graph_logical_tensor_t *> c_inputs;
         std::vector<const dnnl_graph_logical_tensor_t *> c_outputs;
 
@@ -1305,10 +1364,20 @@ private:
         error::wrap_c_api(
                 dnnl_graph_compiled_partition_create(&cpartitions, get()),
                 "could not create compiled_partition");
-        error::wrap_c_api(dnnl_graph_partition_compile(get(), cpartitions,
-                                  c_inputs.size(), c_inputs.data(),
-                                  c_outputs.size(), c_outputs.data(), e.get()),
-                "partition compile failed");
+        if (cache_blob) {
+            error::wrap_c_api(
+                    dnnl_graph_partition_compile_from_cache_blob(get(),
+                            cpartitions, c_inputs.size(), c_inputs.data(),
+                            c_outputs.size(), c_outputs.data(), e.get(),
+                            cache_blob->size(), cache_blob->data()),
+                    "partition compile from cache blob failed");
+        } else {
+            error::wrap_c_api(
+                    dnnl_graph_partition_compile(get(), cpartitions,
+                            c_inputs.size(), c_inputs.data(), c_outputs.size(),
+                            c_outputs.data(), e.get()),
+                    "partition compile failed");
+        }
 
         return compiled_partition(cpartitions);
     }
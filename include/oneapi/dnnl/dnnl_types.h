@@ -84,6 +84,13 @@ typedef enum {
     dnnl_profiling_data_kind_undef = 0,
     /// Data kind to query an execution time in nanoseconds.
     dnnl_profiling_data_kind_time,
+    /// Data kind to query an execution start time in nanoseconds. The time
+    /// is measured from an unspecified point and can only be compared with
+    /// other start times. Supported for CPU engines only.
+    dnnl_profiling_data_kind_start_time,
+    /// Data kind to query a kind of the executed primitive
+    /// (#dnnl_primitive_kind_t). Supported for CPU engines only.
+    dnnl_profiling_data_kind_primitive_kind,
 } dnnl_profiling_data_kind_t;
 
 #endif
@@ -2000,6 +2007,10 @@ typedef enum {
     dnnl_layer_normalization,
     /// A group normalization primitive.
     dnnl_group_normalization,
+    /// A top-k primitive.
+    dnnl_topk,
+    /// An embedding bag primitive.
+    dnnl_embedding_bag,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -2227,6 +2238,18 @@ typedef enum {
     ///    tensor and then perform backward normalization.
     dnnl_fuse_norm_add_relu = 0x10U,
 
+    /// Use Root Mean Square (RMS) normalization
+    ///
+    /// Supported by layer normalization only. If specified:
+    ///  - on forward propagation the mean is considered to be zero and the
+    ///    mean of squares is used instead of the variance. Only the mean of
+    ///    squares is an output on forward propagation for training (or an
+    ///    input when used with #dnnl_use_global_stats), passed as
+    ///    #DNNL_ARG_VARIANCE; #DNNL_ARG_MEAN is not used.
+    ///  - on backward propagation the derivative is computed with respect to
+    ///    the mean of squares only, assuming the mean is zero.
+    dnnl_rms_norm = 0x20U,
+
 } dnnl_normalization_flags_t;
 
 /// @} dnnl_api_primitives_common
@@ -2436,12 +2459,18 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for RNN input recurrent hidden state vector. An alias
 /// for #DNNL_ARG_SRC_1.
 #define DNNL_ARG_SRC_ITER DNNL_ARG_SRC_1
+/// A special mnemonic for embedding bag indices. An alias for
+/// #DNNL_ARG_SRC_1.
+#define DNNL_ARG_SRC_INDICES DNNL_ARG_SRC_1
 
 /// Source argument #2.
 #define DNNL_ARG_SRC_2 3
 /// A special mnemonic for RNN input recurrent cell state vector. An alias for
 /// #DNNL_ARG_SRC_2.
 #define DNNL_ARG_SRC_ITER_C DNNL_ARG_SRC_2
+/// A special mnemonic for embedding bag offsets. An alias for
+/// #DNNL_ARG_SRC_2.
+#define DNNL_ARG_SRC_OFFSETS DNNL_ARG_SRC_2
 
 /// Source argument #3.
 #define DNNL_ARG_SRC_3 4
@@ -2465,6 +2494,9 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for RNN input recurrent hidden state vector. An
 /// alias for #DNNL_ARG_DST_1.
 #define DNNL_ARG_DST_ITER DNNL_ARG_DST_1
+/// A special mnemonic for top-k output indices. An alias for
+/// #DNNL_ARG_DST_1.
+#define DNNL_ARG_DST_INDICES DNNL_ARG_DST_1
 
 /// Destination argument #2.
 #define DNNL_ARG_DST_2 19
@@ -2857,6 +2889,18 @@ typedef enum {
 
 /// @} dnnl_api_service
 
+/// @addtogroup dnnl_api_primitive_cache
+/// @{
+
+/// Structure containing statistics of a primitive cache shard.
+typedef struct {
+    uint64_t hits; ///< Number of lookups that found an entry in the cache
+    uint64_t misses; ///< Number of lookups that added an entry to the cache
+    uint64_t evictions; ///< Number of entries evicted from the cache
+} dnnl_primitive_cache_stats_t;
+
+/// @} dnnl_api_primitive_cache
+
 /// @} dnnl_api
 
 #ifdef __cplusplus
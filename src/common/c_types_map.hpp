@@ -155,6 +155,8 @@ const data_type_t f64 = dnnl_f64;
 const data_type_t s32 = dnnl_s32;
 const data_type_t s8 = dnnl_s8;
 const data_type_t u8 = dnnl_u8;
+const data_type_t s4 = dnnl_s4;
+const data_type_t u4 = dnnl_u4;
 const data_type_t boolean = dnnl_boolean;
 const data_type_t data_type_max = dnnl_data_type_max;
 
@@ -228,11 +230,16 @@ using profiling_data_kind_t = dnnl_profiling_data_kind_t;
 namespace profiling_data_kind {
 const profiling_data_kind_t undef = dnnl_profiling_data_kind_undef;
 const profiling_data_kind_t time = dnnl_profiling_data_kind_time;
+const profiling_data_kind_t start_time = dnnl_profiling_data_kind_start_time;
+const profiling_data_kind_t primitive_kind
+        = dnnl_profiling_data_kind_primitive_kind;
 #else
 using profiling_data_kind_t = int;
 namespace profiling_data_kind {
 const profiling_data_kind_t undef = 0;
 const profiling_data_kind_t time = 1;
+const profiling_data_kind_t start_time = 2;
+const profiling_data_kind_t primitive_kind = 3;
 #endif
 // Internal only data kinds.
 const profiling_data_kind_t internal_only_start
@@ -1859,6 +1866,7 @@ const normalization_flags_t use_scale = dnnl_use_scale;
 const normalization_flags_t use_shift = dnnl_use_shift;
 const normalization_flags_t fuse_norm_relu = dnnl_fuse_norm_relu;
 const normalization_flags_t fuse_norm_add_relu = dnnl_fuse_norm_add_relu;
+const normalization_flags_t rms_norm = dnnl_rms_norm;
 } // namespace normalization_flags
 
 using rnn_flags_t = dnnl_rnn_flags_t;
@@ -1919,10 +1927,13 @@ const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax = dnnl_softmax;
 const primitive_kind_t layer_normalization = dnnl_layer_normalization;
 const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t topk = dnnl_topk;
+const primitive_kind_t embedding_bag = dnnl_embedding_bag;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
 const primitive_kind_t zero_pad = internal_only_start;
+const primitive_kind_t sdpa = (primitive_kind_t)(internal_only_start + 1);
 } // namespace primitive_kind
 
 using query_t = dnnl_query_t;
@@ -2049,6 +2060,7 @@ struct deconvolution_pd_t;
 struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
+struct embedding_bag_pd_t;
 struct gemm_pd_t;
 struct group_normalization_bwd_pd_t;
 struct group_normalization_fwd_pd_t;
@@ -2071,6 +2083,7 @@ struct prelu_pd_t;
 struct reduction_pd_t;
 struct reorder_pd_t;
 struct resampling_pd_t;
+struct sdpa_pd_t;
 struct rnn_bwd_pd_t;
 struct rnn_fwd_pd_t;
 struct rnn_pd_t;
@@ -2079,6 +2092,7 @@ struct softmax_bwd_pd_t;
 struct softmax_fwd_pd_t;
 struct softmax_pd_t;
 struct sum_pd_t;
+struct topk_pd_t;
 
 } // namespace impl
 } // namespace dnnl
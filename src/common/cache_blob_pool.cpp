@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/cache_blob_pool.hpp"
+#include "common/primitive_iface.hpp"
+
+namespace dnnl {
+namespace impl {
+
+namespace {
+thread_local cache_blob_pool_t *active_pool = nullptr;
+} // namespace
+
+void cache_blob_pool_t::record(primitive_iface_t *primitive_iface) {
+    primitive_iface->retain();
+    primitives_.emplace_back(
+            primitive_iface, [](primitive_iface_t *p) { p->release(); });
+}
+
+cache_blob_pool_t *cache_blob_pool_t::get_active() {
+    return active_pool;
+}
+
+cache_blob_pool_t::scoped_activation_t::scoped_activation_t(
+        cache_blob_pool_t &pool)
+    : prev_pool_(active_pool) {
+    active_pool = &pool;
+}
+
+cache_blob_pool_t::scoped_activation_t::~scoped_activation_t() {
+    active_pool = prev_pool_;
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,80 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_CACHE_BLOB_POOL_HPP
+#define COMMON_CACHE_BLOB_POOL_HPP
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// A set of primitive cache blobs indexed by cache blob IDs. A pool can be
+// activated on the current thread for a scope. While a pool is active,
+// primitives created on the thread without an explicit cache blob use the
+// pooled cache blob with the matching ID, and all the created primitives are
+// recorded in the pool. The graph API uses it to export and import compiled
+// partitions that consist of several primitives.
+struct cache_blob_pool_t {
+    using blob_id_t = std::vector<uint8_t>;
+    using blob_t = std::vector<uint8_t>;
+    using blob_map_t = std::map<blob_id_t, blob_t>;
+
+    cache_blob_pool_t(const blob_map_t &blobs = blob_map_t()) : blobs_(blobs) {}
+
+    const blob_t *find_blob(const blob_id_t &id) const {
+        auto it = blobs_.find(id);
+        return it == blobs_.end() ? nullptr : &it->second;
+    }
+
+    void record(primitive_iface_t *primitive_iface);
+
+    const std::vector<std::shared_ptr<primitive_iface_t>> &
+    get_recorded_primitives() const {
+        return primitives_;
+    }
+
+    // Returns the pool active on the current thread or nullptr.
+    static cache_blob_pool_t *get_active();
+
+    // Activates the pool on the current thread for the lifetime of the object.
+    struct scoped_activation_t {
+        scoped_activation_t(cache_blob_pool_t &pool);
+        ~scoped_activation_t();
+
+    private:
+        cache_blob_pool_t *prev_pool_;
+
+        DNNL_DISALLOW_COPY_AND_ASSIGN(scoped_activation_t);
+    };
+
+private:
+    blob_map_t blobs_;
+    std::vector<std::shared_ptr<primitive_iface_t>> primitives_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cache_blob_pool_t);
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
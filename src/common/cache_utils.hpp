@@ -18,19 +18,16 @@
 #define COMMON_CACHE_UTILS_HPP
 
 #include <algorithm>
+#include <atomic>
 #include <future>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 
 #include "oneapi/dnnl/dnnl_config.h"
 
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-#include "cpu/platform.hpp"
-#else
-#include <chrono>
-#endif
-
 #ifdef _WIN32
 #include <windows.h>
 #endif
@@ -114,10 +111,12 @@ protected:
     virtual value_t get_or_add(const key_t &key, const value_t &value) = 0;
     virtual void remove_if_invalidated(const key_t &key) = 0;
     virtual void update_entry(const key_t &key, const object_t &p) = 0;
-    static utils::rw_mutex_t &rw_mutex() {
-        static utils::rw_mutex_t mutex;
-        return mutex;
-    }
+    // Each cache instance has its own mutex so that independent caches (e.g.
+    // shards of the same cache) do not contend with each other.
+    utils::rw_mutex_t &rw_mutex() const { return rw_mutex_; }
+
+private:
+    mutable utils::rw_mutex_t rw_mutex_;
 };
 
 // The cache uses LRU replacement policy
@@ -129,7 +128,15 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
     using object_t = typename lru_base_t::object_t;
     using cache_object_t = typename lru_base_t::cache_object_t;
     using value_t = typename lru_base_t::value_t;
-    lru_cache_t(int capacity) : capacity_(capacity) {}
+
+    struct stats_t {
+        size_t hits;
+        size_t misses;
+        size_t evictions;
+    };
+
+    lru_cache_t(int capacity)
+        : capacity_(capacity), hits_(0), misses_(0), evictions_(0) {}
 
     ~lru_cache_t() override {
         if (cache_mapper().empty()) return;
@@ -171,7 +178,7 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
             for (auto it = cache_mapper().begin();
                     it != cache_mapper().end();) {
                 if (!it->first.has_runtime_dependencies()) {
-                    it = cache_mapper().erase(it);
+                    it = erase_entry(it);
                 } else {
                     ++it;
                 }
@@ -231,6 +238,15 @@ struct lru_cache_t final : public cache_t<K, O, C, key_merge> {
         return get_size_no_lock();
     }
 
+    // The counters are updated with relaxed memory ordering, hence the
+    // returned values are not necessarily consistent with each other when
+    // the cache is accessed concurrently.
+    stats_t get_stats() const {
+        return {hits_.load(std::memory_order_relaxed),
+                misses_.load(std::memory_order_relaxed),
+                evictions_.load(std::memory_order_relaxed)};
+    }
+
 protected:
     int get_size_no_lock() const { return (int)cache_mapper().size(); }
 
@@ -243,7 +259,10 @@ protected:
             // Check if the requested entry is present in the cache (likely
             // cache_hit)
             auto e = get_future(key);
-            if (e.valid()) { return e; }
+            if (e.valid()) {
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return e;
+            }
         }
 
         utils::lock_write_t lock_w(this->rw_mutex());
@@ -261,6 +280,9 @@ protected:
         if (!e.valid()) {
             // If the entry is missing in the cache then add it (cache_miss)
             add(key, value);
+            misses_.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            hits_.fetch_add(1, std::memory_order_relaxed);
         }
         return e;
     }
@@ -279,18 +301,10 @@ protected:
         if (!value.get().is_empty()) { return; }
 
         // Remove the invalidated entry
-        cache_mapper().erase(it);
+        erase_entry(it);
     }
 
 private:
-    static size_t get_timestamp() {
-#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-        return cpu::platform::get_timestamp();
-#else
-        return std::chrono::steady_clock::now().time_since_epoch().count();
-#endif
-    }
-
     void update_entry(const key_t &key, const object_t &p) override {
         // Cast to void as compilers may warn about comparing compile time
         // constant function pointers with nullptr, as that is often not an
@@ -315,39 +329,23 @@ private:
         key_merge(it->first, p);
     }
 
+    // Entries are kept in an eviction queue ordered by the time of their last
+    // access, the least recently used entry is at the back. Both a hit and a
+    // miss move the entry to the front, therefore eviction has O(1)
+    // complexity.
     void evict(int n) {
-        using v_t =
-                typename std::unordered_map<key_t, timed_entry_t>::value_type;
-
-        if (n == capacity_) {
+        evictions_.fetch_add(n, std::memory_order_relaxed);
+        if (n == get_size_no_lock()) {
             cache_mapper().clear();
+            eviction_queue_.clear();
             return;
         }
 
         for (int e = 0; e < n; e++) {
-            // Find the smallest timestamp
-            // TODO: revisit the eviction algorithm due to O(n) complexity, E.g.
-            // maybe evict multiple entries at once.
-            auto it = std::min_element(cache_mapper().begin(),
-                    cache_mapper().end(),
-                    [&](const v_t &left, const v_t &right) {
-                        // By default, load() and operator T use sequentially
-                        // consistent memory ordering, which enforces writing
-                        // the timestamps into registers in the same exact order
-                        // they are read from the CPU cache line. Since eviction
-                        // is performed under a write lock, this order is not
-                        // important, therefore we can safely use the weakest
-                        // memory ordering (relaxed). This brings about a few
-                        // microseconds performance improvement for default
-                        // cache capacity.
-                        return left.second.timestamp_.load(
-                                       std::memory_order_relaxed)
-                                < right.second.timestamp_.load(
-                                        std::memory_order_relaxed);
-                    });
-            auto res = cache_mapper().erase(it->first);
-            MAYBE_UNUSED(res);
-            assert(res);
+            assert(!eviction_queue_.empty());
+            auto it = cache_mapper().find(eviction_queue_.back()->first);
+            assert(it != cache_mapper().end());
+            erase_entry(it);
         }
     }
     void add(const key_t &key, const value_t &value) {
@@ -358,52 +356,76 @@ private:
             evict(1);
         }
 
-        size_t timestamp = get_timestamp();
-
         auto res = cache_mapper().emplace(std::piecewise_construct,
-                std::forward_as_tuple(key),
-                std::forward_as_tuple(value, timestamp));
+                std::forward_as_tuple(key), std::forward_as_tuple(value));
         MAYBE_UNUSED(res);
         assert(res.second);
+
+        // References to unordered_map elements stay valid on rehashing,
+        // therefore the queue can point to them directly.
+        eviction_queue_.push_front(&(*res.first));
+        res.first->second.queue_pos_ = eviction_queue_.begin();
     }
     value_t get_future(const key_t &key) {
         auto it = cache_mapper().find(key);
         if (it == cache_mapper().end()) return value_t();
 
-        size_t timestamp = get_timestamp();
-        it->second.timestamp_.store(timestamp);
+        // A hit is served under the read lock, hence concurrent hits are
+        // serialized on the queue mutex only for the time of the splice.
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            eviction_queue_.splice(eviction_queue_.begin(), eviction_queue_,
+                    it->second.queue_pos_);
+        }
         // Return the entry
         return it->second.value_;
     }
 
     int capacity_;
-    struct timed_entry_t {
+    std::atomic<size_t> hits_;
+    std::atomic<size_t> misses_;
+    std::atomic<size_t> evictions_;
+
+    struct cache_entry_t;
+    using entry_t = std::pair<const key_t, cache_entry_t>;
+    using eviction_queue_t = std::list<entry_t *>;
+
+    struct cache_entry_t {
         value_t value_;
-        std::atomic<size_t> timestamp_;
-        timed_entry_t(const value_t &value, size_t timestamp)
-            : value_(value), timestamp_(timestamp) {}
+        typename eviction_queue_t::iterator queue_pos_;
+        cache_entry_t(const value_t &value) : value_(value) {}
     };
 
-    std::unordered_map<key_t, timed_entry_t> &cache_mapper() {
+    using cache_mapper_iterator_t =
+            typename std::unordered_map<key_t, cache_entry_t>::iterator;
+    cache_mapper_iterator_t erase_entry(cache_mapper_iterator_t it) {
+        eviction_queue_.erase(it->second.queue_pos_);
+        return cache_mapper().erase(it);
+    }
+
+    std::unordered_map<key_t, cache_entry_t> &cache_mapper() {
         return cache_mapper_;
     }
 
-    const std::unordered_map<key_t, timed_entry_t> &cache_mapper() const {
+    const std::unordered_map<key_t, cache_entry_t> &cache_mapper() const {
         return cache_mapper_;
     }
 
     // Leaks cached resources. Used to avoid issues with calling destructors
     // allocated by an already unloaded dynamic library.
     void release_cache() {
-        auto t = utils::make_unique<std::unordered_map<key_t, timed_entry_t>>();
+        auto t = utils::make_unique<std::unordered_map<key_t, cache_entry_t>>();
         std::swap(*t, cache_mapper_);
         t.release();
+        eviction_queue_.clear();
     }
-    // Each entry in the cache has a corresponding key and timestamp. NOTE:
-    // pairs that contain atomics cannot be stored in an unordered_map *as an
-    // element*, since it invokes the copy constructor of std::atomic, which is
-    // deleted.
-    std::unordered_map<key_t, timed_entry_t> cache_mapper_;
+    // Each entry in the cache has a corresponding key and a position in the
+    // eviction queue.
+    std::unordered_map<key_t, cache_entry_t> cache_mapper_;
+    eviction_queue_t eviction_queue_;
+    // Guards the order of the eviction queue on the cache hit path, which
+    // runs under the shared (read) lock.
+    std::mutex queue_mutex_;
 };
 
 } // namespace utils
@@ -62,7 +62,6 @@ status_t concat_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
 
     const int ndims = src_mds[0]->ndims;
     const dims_t &dims = src_mds[0]->dims;
-    const data_type_t dt = src_mds[0]->data_type;
     VCONDCHECK(primitive, create, check, concat,
             !memory_desc_wrapper(src_mds[0]).has_runtime_dims_or_strides(),
             status::unimplemented, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
@@ -87,8 +86,6 @@ status_t concat_primitive_desc_create(std::shared_ptr<primitive_desc_t> &pd,
             VCHECK_CONCAT(src_md.dims[d] == dims[d], VERBOSE_INCONSISTENT_DIM,
                     "src_0", d, SRC2STR(i), d);
         }
-        VCHECK_CONCAT(src_md.data_type == dt, VERBOSE_INCONSISTENT_DT, "src_0",
-                SRC2STR(i));
         concat_dim_sz += src_md.dims[concat_dim];
     }
 #undef SRC2STR
@@ -52,6 +52,10 @@
 #include "common/ittnotify.hpp"
 #endif
 
+#if defined(DNNL_ENABLE_TRACE)
+#include "common/trace.hpp"
+#endif
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
 #define DNNL_THR_SYNC 1
 inline int dnnl_get_max_threads() {
@@ -282,7 +286,8 @@ inline int adjust_num_threads(int nthr, dim_t work_amount) {
 #endif
 }
 
-static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
+static inline void parallel_untraced(
+        int nthr, const std::function<void(int, int)> &f) {
     nthr = adjust_num_threads(nthr, INT64_MAX);
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_SEQ
     for (int i = 0; i < nthr; ++i) {
@@ -364,6 +369,23 @@ static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
 #endif
 }
 
+static inline void parallel(int nthr, const std::function<void(int, int)> &f) {
+#if defined(DNNL_ENABLE_TRACE)
+    nthr = adjust_num_threads(nthr, INT64_MAX);
+    if (nthr > 1 && trace::is_enabled()) {
+        // Each thread of the team records its work under the name of the
+        // event that started the parallel region.
+        const std::string name = trace::current_name();
+        parallel_untraced(nthr, [&](int ithr, int nthr_) {
+            trace::scope_t scope(trace::category_t::parallel, name);
+            f(ithr, nthr_);
+        });
+        return;
+    }
+#endif
+    parallel_untraced(nthr, f);
+}
+
 // XXX: IMPORTANT!!!
 // Keep the functions below static.
 //
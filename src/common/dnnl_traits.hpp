@@ -26,6 +26,7 @@
 #include "c_types_map.hpp"
 #include "float16.hpp"
 #include "float8.hpp"
+#include "int4.hpp"
 #include "nstl.hpp"
 #include "opdesc.hpp"
 #include "utils.hpp"
@@ -80,6 +81,14 @@ struct prec_traits<data_type::u8> {
     typedef uint8_t type;
 };
 template <>
+struct prec_traits<data_type::s4> {
+    typedef int4_t type;
+};
+template <>
+struct prec_traits<data_type::u4> {
+    typedef uint4_t type;
+};
+template <>
 struct prec_traits<data_type::boolean> {
     typedef bool type;
 };
@@ -117,6 +126,14 @@ struct data_traits<uint8_t> {
     static constexpr data_type_t data_type = data_type::u8;
 };
 template <>
+struct data_traits<int4_t> {
+    static constexpr data_type_t data_type = data_type::s4;
+};
+template <>
+struct data_traits<uint4_t> {
+    static constexpr data_type_t data_type = data_type::u4;
+};
+template <>
 struct data_traits<bool> {
     static constexpr data_type_t data_type = data_type::boolean;
 };
@@ -154,10 +171,13 @@ PKIND_TRAITS_INST(inner_product);
 PKIND_TRAITS_INST(rnn);
 PKIND_TRAITS_INST(gemm);
 PKIND_TRAITS_INST(zero_pad);
+PKIND_TRAITS_INST(sdpa);
 PKIND_TRAITS_INST(binary);
 PKIND_TRAITS_INST(matmul);
 PKIND_TRAITS_INST(resampling);
 PKIND_TRAITS_INST(reduction);
+PKIND_TRAITS_INST(topk);
+PKIND_TRAITS_INST(embedding_bag);
 #undef PKIND_TRAITS_INST
 
 } // namespace impl
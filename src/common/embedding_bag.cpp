@@ -0,0 +1,132 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "embedding_bag_pd.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::alg_kind;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+#define VCHECK_EMBEDDING_BAG(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, embedding_bag, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_EMBEDDING_BAG_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, embedding_bag, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+
+status_t embedding_bag_desc_init(embedding_bag_desc_t *embedding_bag_desc,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *dst_desc) {
+    VCHECK_EMBEDDING_BAG(
+            !any_null(src_desc, indices_desc, offsets_desc, dst_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_EMBEDDING_BAG(
+            one_of(alg_kind, reduction_sum, reduction_mean, reduction_max),
+            VERBOSE_BAD_ALGORITHM);
+
+    VCHECK_EMBEDDING_BAG(src_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_EMBEDDING_BAG(indices_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "indices");
+    VCHECK_EMBEDDING_BAG(offsets_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "offsets");
+    VCHECK_EMBEDDING_BAG(one_of(dst_desc->format_kind, format_kind::blocked,
+                                 format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+
+    VCHECK_EMBEDDING_BAG(indices_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "indices");
+    VCHECK_EMBEDDING_BAG(offsets_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "offsets");
+
+    VCHECK_EMBEDDING_BAG(
+            src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src", src_desc->ndims);
+    VCHECK_EMBEDDING_BAG(indices_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "indices", indices_desc->ndims);
+    VCHECK_EMBEDDING_BAG(offsets_desc->ndims == 1, VERBOSE_BAD_NDIMS,
+            "offsets", offsets_desc->ndims);
+    VCHECK_EMBEDDING_BAG(
+            dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst", dst_desc->ndims);
+
+    // One destination row per bag.
+    VCHECK_EMBEDDING_BAG(dst_desc->dims[0] == offsets_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "offsets", 0);
+    VCHECK_EMBEDDING_BAG(dst_desc->dims[1] == src_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "dst", 1, "src", 1);
+    // Indices and offsets are stored as s32.
+    VCHECK_EMBEDDING_BAG(src_desc->dims[0] <= INT32_MAX, VERBOSE_BAD_DIM,
+            "src", 0);
+    VCHECK_EMBEDDING_BAG(indices_desc->dims[0] <= INT32_MAX, VERBOSE_BAD_DIM,
+            "indices", 0);
+
+    VCHECK_EMBEDDING_BAG(
+            src_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG, "src");
+    VCHECK_EMBEDDING_BAG(indices_desc->extra.flags == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "indices");
+    VCHECK_EMBEDDING_BAG(offsets_desc->extra.flags == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "offsets");
+    VCHECK_EMBEDDING_BAG(
+            IMPLICATION(dst_desc->format_kind == format_kind::blocked,
+                    dst_desc->extra.flags == 0),
+            VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
+
+    const bool runtime_dims_or_strides
+            = memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(indices_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(offsets_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides();
+    VCHECK_EMBEDDING_BAG_UNIMPL(
+            !runtime_dims_or_strides, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    auto ebd = embedding_bag_desc_t();
+    ebd.primitive_kind = primitive_kind::embedding_bag;
+    ebd.alg_kind = alg_kind;
+    ebd.src_desc = *src_desc;
+    ebd.indices_desc = *indices_desc;
+    ebd.offsets_desc = *offsets_desc;
+    ebd.dst_desc = *dst_desc;
+
+    *embedding_bag_desc = ebd;
+    return success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_embedding_bag_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *dst_desc, const primitive_attr_t *attr) {
+    auto embedding_bag_desc = embedding_bag_desc_t();
+    CHECK(embedding_bag_desc_init(&embedding_bag_desc, alg_kind, src_desc,
+            indices_desc, offsets_desc, dst_desc));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&embedding_bag_desc, nullptr, attr);
+}
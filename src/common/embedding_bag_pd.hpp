@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EMBEDDING_BAG_PD_HPP
+#define COMMON_EMBEDDING_BAG_PD_HPP
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_EMBEDDING_BAG(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, embedding_bag, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t embedding_bag_desc_init(embedding_bag_desc_t *embedding_bag_desc,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *dst_desc);
+
+struct embedding_bag_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::embedding_bag;
+
+    typedef embedding_bag_pd_t hint_class;
+
+    const embedding_bag_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC:
+            case DNNL_ARG_SRC_INDICES:
+            case DNNL_ARG_SRC_OFFSETS: return arg_usage_t::input;
+            case DNNL_ARG_DST: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_SRC_INDICES: return src_md(1);
+            case DNNL_ARG_SRC_OFFSETS: return src_md(2);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    // Index 0 is the embedding table, index 1 is the indices and index 2 is
+    // the offsets.
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return &desc_.src_desc;
+        if (index == 1) return &desc_.indices_desc;
+        if (index == 2) return &desc_.offsets_desc;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 3; }
+    int n_outputs() const override { return 1; }
+
+    alg_kind_t alg_kind() const { return desc_.alg_kind; }
+    // The number of rows in the embedding table.
+    dim_t n_rows() const { return desc_.src_desc.dims[0]; }
+    // The size of a table row.
+    dim_t emb_dim() const { return desc_.src_desc.dims[1]; }
+    dim_t n_indices() const { return desc_.indices_desc.dims[0]; }
+    dim_t n_bags() const { return desc_.offsets_desc.dims[0]; }
+
+protected:
+    embedding_bag_desc_t desc_;
+
+    memory_desc_t dst_md_;
+
+    embedding_bag_pd_t(const embedding_bag_desc_t *adesc,
+            const primitive_attr_t *attr, const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , dst_md_(desc_.dst_desc) {}
+
+    // A destination with `any` format is plain.
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+        return memory_desc_init_by_tag(dst_md_, format_tag::ab);
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -102,6 +102,28 @@ status_t dnnl_engine_create(
     }
 }
 
+status_t dnnl_engine_create_with_allocator(engine_t **engine,
+        engine_kind_t kind, size_t index, dnnl_host_allocate_f allocate,
+        dnnl_host_deallocate_f deallocate) {
+    using namespace dnnl::impl;
+    if (engine == nullptr) return invalid_arguments;
+    VCONDCHECK(common, create, check, engine, allocate && deallocate,
+            invalid_arguments, VERBOSE_NULL_ARG);
+    // Only the native CPU runtimes allocate memory on the host through the
+    // engine.
+    VCONDCHECK(common, create, check, engine,
+            kind == engine_kind::cpu
+                    && is_native_runtime(get_default_runtime(kind)),
+            unimplemented, VERBOSE_INVALID_ENGINE_KIND,
+            dnnl_engine_kind2str(kind));
+
+    engine_t *e = nullptr;
+    CHECK(dnnl_engine_create(&e, kind, index));
+    e->set_host_allocator(allocate, deallocate);
+    *engine = e;
+    return success;
+}
+
 status_t dnnl_engine_get_kind(engine_t *engine, engine_kind_t *kind) {
     using namespace dnnl::impl;
     if (engine == nullptr) return invalid_arguments;
@@ -122,6 +122,16 @@ struct dnnl_engine : public dnnl::impl::c_compatible {
 
     virtual bool mayiuse_f16_accumulator_with_f16() const { return false; }
 
+    /** user-provided host allocation call-backs, nullptr if not set */
+    dnnl_host_allocate_f host_allocate() const { return host_allocate_; }
+    dnnl_host_deallocate_f host_deallocate() const { return host_deallocate_; }
+    bool has_host_allocator() const { return host_allocate_ != nullptr; }
+    void set_host_allocator(
+            dnnl_host_allocate_f allocate, dnnl_host_deallocate_f deallocate) {
+        host_allocate_ = allocate;
+        host_deallocate_ = deallocate;
+    }
+
 #ifdef ONEDNN_BUILD_GRAPH
     /** only used in graph implementation **/
     void *get_allocator() const { return (void *)(&allocator_); };
@@ -141,6 +151,9 @@ protected:
     dnnl::impl::runtime_kind_t runtime_kind_;
     size_t index_;
 
+    dnnl_host_allocate_f host_allocate_ = nullptr;
+    dnnl_host_deallocate_f host_deallocate_ = nullptr;
+
 #ifdef ONEDNN_BUILD_GRAPH
     /** only used in graph implementation **/
     dnnl::impl::graph::allocator_t allocator_;
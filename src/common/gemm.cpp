@@ -25,6 +25,7 @@
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm/gemm_pack.hpp"
 #endif
 
 #include "common/bfloat16.hpp"
@@ -46,6 +47,15 @@ const char *c2f_offsetC(const char *offC) {
     return offC;
 }
 
+// The row-major A matrix is the column-major B matrix and vice versa.
+const char *c2f_identifier(const char *identifier) {
+    if (identifier) {
+        if (identifier[0] == 'A' || identifier[0] == 'a') return "B";
+        if (identifier[0] == 'B' || identifier[0] == 'b') return "A";
+    }
+    return identifier;
+}
+
 std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
     std::string s_ = std::to_string(M);
     s_ += "x";
@@ -159,6 +169,277 @@ extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
 #endif
 }
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+namespace {
+template <typename data_t>
+using batch_op_t = cpu::gemm_batch_operand_t<data_t>;
+} // namespace
+#endif
+
+dnnl_status_t dnnl_sgemm_batch_strided(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
+        dim_t stride_a, const float *B, dim_t ldb, dim_t stride_b, float beta,
+        float *C, dim_t ldc, dim_t stride_c, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f32", "f32", "f32",
+            cpu::gemm_batch<float, float, float>(&transb, &transa, nullptr, N,
+                    M, K, alpha, batch_op_t<const float>(B, stride_b), ldb, 0,
+                    batch_op_t<const float>(A, stride_a), lda, 0, beta,
+                    batch_op_t<float>(C, stride_c), ldc, nullptr, batch));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const float *const *A, dim_t lda,
+        const float *const *B, dim_t ldb, float beta, float *const *C,
+        dim_t ldc, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f32", "f32", "f32",
+            cpu::gemm_batch<float, float, float>(&transb, &transa, nullptr, N,
+                    M, K, alpha, batch_op_t<const float>(B), ldb, 0,
+                    batch_op_t<const float>(A), lda, 0, beta,
+                    batch_op_t<float>(C), ldc, nullptr, batch));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *A,
+        dim_t lda, dim_t stride_a, uint8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "u8", "s8", "s32",
+            cpu::gemm_batch<int8_t, uint8_t, int32_t>(&transb, &transa,
+                    c2f_offsetC(&offsetc), N, M, K, alpha,
+                    batch_op_t<const int8_t>(B, stride_b), ldb, bo,
+                    batch_op_t<const uint8_t>(A, stride_a), lda, ao, beta,
+                    batch_op_t<int32_t>(C, stride_c), ldc, co, batch));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch(char transa, char transb, char offsetc,
+        dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *const *A,
+        dim_t lda, uint8_t ao, const int8_t *const *B, dim_t ldb, int8_t bo,
+        float beta, int32_t *const *C, dim_t ldc, const int32_t *co,
+        dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "u8", "s8", "s32",
+            cpu::gemm_batch<int8_t, uint8_t, int32_t>(&transb, &transa,
+                    c2f_offsetC(&offsetc), N, M, K, alpha,
+                    batch_op_t<const int8_t>(B), ldb, bo,
+                    batch_op_t<const uint8_t>(A), lda, ao, beta,
+                    batch_op_t<int32_t>(C), ldc, co, batch));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const int8_t *A,
+        dim_t lda, dim_t stride_a, int8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "s8", "s8", "s32",
+            cpu::gemm_batch<int8_t, int8_t, int32_t>(&transb, &transa,
+                    c2f_offsetC(&offsetc), N, M, K, alpha,
+                    batch_op_t<const int8_t>(B, stride_b), ldb, bo,
+                    batch_op_t<const int8_t>(A, stride_a), lda, ao, beta,
+                    batch_op_t<int32_t>(C, stride_c), ldc, co, batch));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch(char transa, char transb, char offsetc,
+        dim_t M, dim_t N, dim_t K, float alpha, const int8_t *const *A,
+        dim_t lda, int8_t ao, const int8_t *const *B, dim_t ldb, int8_t bo,
+        float beta, int32_t *const *C, dim_t ldc, const int32_t *co,
+        dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "s8", "s8", "s32",
+            cpu::gemm_batch<int8_t, int8_t, int32_t>(&transb, &transa,
+                    c2f_offsetC(&offsetc), N, M, K, alpha,
+                    batch_op_t<const int8_t>(B), ldb, bo,
+                    batch_op_t<const int8_t>(A), lda, ao, beta,
+                    batch_op_t<int32_t>(C), ldc, co, batch));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_batch_strided(
+        char transa, char transb, dim_t M, dim_t N, dim_t K, float alpha,
+        const bfloat16_t *A, dim_t lda, dim_t stride_a, const bfloat16_t *B,
+        dim_t ldb, dim_t stride_b, float beta, float *C, dim_t ldc,
+        dim_t stride_c, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "bf16", "bf16", "f32",
+            cpu::gemm_batch<bfloat16_t, bfloat16_t, float>(&transb, &transa,
+                    nullptr, N, M, K, alpha,
+                    batch_op_t<const bfloat16_t>(B, stride_b), ldb, 0,
+                    batch_op_t<const bfloat16_t>(A, stride_a), lda, 0, beta,
+                    batch_op_t<float>(C, stride_c), ldc, nullptr, batch));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_batch(char transa,
+        char transb, dim_t M, dim_t N, dim_t K, float alpha,
+        const bfloat16_t *const *A, dim_t lda, const bfloat16_t *const *B,
+        dim_t ldb, float beta, float *const *C, dim_t ldc, dim_t batch) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "bf16", "bf16", "f32",
+            cpu::gemm_batch<bfloat16_t, bfloat16_t, float>(&transb, &transa,
+                    nullptr, N, M, K, alpha, batch_op_t<const bfloat16_t>(B),
+                    ldb, 0, batch_op_t<const bfloat16_t>(A), lda, 0, beta,
+                    batch_op_t<float>(C), ldc, nullptr, batch));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return dnnl_invalid_arguments;
+    return cpu::sgemm_pack_get_size(c2f_identifier(&identifier), &transb,
+            &transa, &N, &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_pack(char identifier, char transa, char transb,
+        dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb, const float *src,
+        void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::sgemm_pack(c2f_identifier(&identifier), &transb, &transa, &N,
+            &M, &K, &ldb, &lda, src, (float *)dst);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_compute(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, const void *A, dim_t lda, const void *B, dim_t ldb,
+        float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const float alpha = 1.f;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f32", "f32", "f32",
+            cpu::sgemm_compute(&transb, &transa, &N, &M, &K, (const float *)B,
+                    &ldb, (const float *)A, &lda, &beta, C, &ldc));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return dnnl_invalid_arguments;
+    return cpu::gemm_s8u8s32_pack_get_size(c2f_identifier(&identifier),
+            &transb, &transa, &N, &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const void *src, void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_s8u8s32_pack(c2f_identifier(&identifier), &transb,
+            &transa, &N, &M, &K, &ldb, &lda, src, dst);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const void *A, dim_t lda,
+        const void *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const float alpha = 1.f;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "u8", "s8", "s32",
+            cpu::gemm_s8u8s32_compute(&transb, &transa, c2f_offsetC(&offsetc),
+                    &N, &M, &K, (const int8_t *)B, &ldb, (const uint8_t *)A,
+                    &lda, &beta, C, &ldc, co));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return dnnl_invalid_arguments;
+    return cpu::gemm_s8s8s32_pack_get_size(c2f_identifier(&identifier),
+            &transb, &transa, &N, &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const void *src, void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_s8s8s32_pack(c2f_identifier(&identifier), &transb,
+            &transa, &N, &M, &K, &ldb, &lda, src, dst);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_compute(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, const void *A, dim_t lda,
+        const void *B, dim_t ldb, float beta, int32_t *C, dim_t ldc,
+        const int32_t *co) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const float alpha = 1.f;
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "s8", "s8", "s32",
+            cpu::gemm_s8s8s32_compute(&transb, &transa, c2f_offsetC(&offsetc),
+                    &N, &M, &K, (const int8_t *)B, &ldb, (const int8_t *)A,
+                    &lda, &beta, C, &ldc, co));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 dnnl_status_t dnnl_threadpool_interop_sgemm(char transa, char transb, dim_t M,
         dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
@@ -0,0 +1,83 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_INT4_HPP
+#define COMMON_INT4_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace dnnl {
+namespace impl {
+
+// 4-bit integer types. In memory two values are packed into a single byte:
+// the element with an even index occupies the lower half of the byte and the
+// element with an odd index occupies the upper half.
+
+struct uint4_t {
+    uint8_t raw_bits_;
+    uint4_t() = default;
+    constexpr uint4_t(uint8_t r, bool) : raw_bits_(r & 0xf) {}
+    constexpr uint4_t(int i) : raw_bits_(static_cast<uint8_t>(i) & 0xf) {}
+
+    constexpr operator int() const { return raw_bits_; }
+    constexpr operator float() const { return (float)raw_bits_; }
+
+    // Returns the `idx`-th element of an array of packed values.
+    static uint4_t extract(const void *base, size_t idx) {
+        const uint8_t byte = static_cast<const uint8_t *>(base)[idx / 2];
+        return uint4_t(idx % 2 ? byte >> 4 : byte, true);
+    }
+
+    // Writes the value to the `idx`-th element of an array of packed values
+    // leaving the other half of the byte intact.
+    void insert(void *base, size_t idx) const {
+        uint8_t &byte = static_cast<uint8_t *>(base)[idx / 2];
+        byte = idx % 2 ? (byte & 0x0f) | (raw_bits_ << 4)
+                       : (byte & 0xf0) | raw_bits_;
+    }
+};
+static_assert(sizeof(uint4_t) == 1, "uint4_t must be 1 byte");
+
+struct int4_t {
+    uint8_t raw_bits_;
+    int4_t() = default;
+    constexpr int4_t(uint8_t r, bool) : raw_bits_(r & 0xf) {}
+    constexpr int4_t(int i) : raw_bits_(static_cast<uint8_t>(i) & 0xf) {}
+
+    // Sign-extends the lower 4 bits.
+    constexpr operator int() const {
+        return (int)raw_bits_ - ((raw_bits_ & 0x8) << 1);
+    }
+    constexpr operator float() const { return (float)(int)(*this); }
+
+    static int4_t extract(const void *base, size_t idx) {
+        const uint8_t byte = static_cast<const uint8_t *>(base)[idx / 2];
+        return int4_t(idx % 2 ? byte >> 4 : byte, true);
+    }
+
+    void insert(void *base, size_t idx) const {
+        uint8_t &byte = static_cast<uint8_t *>(base)[idx / 2];
+        byte = idx % 2 ? (byte & 0x0f) | (raw_bits_ << 4)
+                       : (byte & 0xf0) | raw_bits_;
+    }
+};
+static_assert(sizeof(int4_t) == 1, "int4_t must be 1 byte");
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
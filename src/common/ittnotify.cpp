@@ -79,6 +79,8 @@ void primitive_task_start(primitive_kind_t kind) {
             CASE(softmax),
             CASE(layer_normalization),
             CASE(group_normalization),
+            CASE(topk),
+            CASE(embedding_bag),
     };
 #undef CASE
     int kind_idx = (int)kind;
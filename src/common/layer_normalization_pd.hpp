@@ -75,6 +75,10 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool use_global_stats() const {
         return desc_.flags & normalization_flags::use_global_stats;
     }
+    // RMS normalization: the mean is zero and is not a primitive argument.
+    bool skip_mean() const {
+        return desc_.flags & normalization_flags::rms_norm;
+    }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -91,6 +95,10 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     const memory_desc_t *stat_md() const { return &stat_md_; }
 
 protected:
+    // Number of statistics tensors: mean and variance, or only the mean of
+    // squares for RMS normalization.
+    int n_stats() const { return skip_mean() ? 1 : 2; }
+
     layer_normalization_desc_t desc_;
     const layer_normalization_fwd_pd_t *hint_fwd_pd_;
 
@@ -156,6 +164,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
         if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE)) {
+            if (arg == DNNL_ARG_MEAN && skip_mean()) return arg_usage_t::unused;
             if (stats_are_src()) return arg_usage_t::input;
             if (!stats_are_src() && is_training()) return arg_usage_t::output;
             return arg_usage_t::unused;
@@ -184,14 +193,16 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     const memory_desc_t *src_md(
             int index = 0, bool user_input = false) const override {
         if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
-        if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
+        if (stats_are_src() && ((index == 1 && !skip_mean()) || index == 2))
+            return &stat_md_;
         return &glob_zero_md;
     }
 
     const memory_desc_t *dst_md(
             int index = 0, bool user_input = false) const override {
         if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
-        if (!stats_are_src() && is_training() && (index == 1 || index == 2))
+        if (!stats_are_src() && is_training()
+                && ((index == 1 && !skip_mean()) || index == 2))
             return &stat_md_;
         return &glob_zero_md;
     }
@@ -202,10 +213,10 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
     int n_inputs() const override {
-        return 1 + 2 * stats_are_src() + use_scale() + use_shift();
+        return 1 + n_stats() * stats_are_src() + use_scale() + use_shift();
     }
     int n_outputs() const override {
-        return 1 + 2 * (!stats_are_src()) * is_training();
+        return 1 + n_stats() * (!stats_are_src()) * is_training();
     }
 
 protected:
@@ -245,6 +256,7 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     typedef layer_normalization_fwd_pd_t hint_class;
 
     arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_MEAN && skip_mean()) return arg_usage_t::unused;
         if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE,
                     DNNL_ARG_DIFF_DST))
             return arg_usage_t::input;
@@ -281,7 +293,7 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     const memory_desc_t *src_md(
             int index = 0, bool user_input = false) const override {
         if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
-        if (index == 1 || index == 2) return &stat_md_;
+        if ((index == 1 && !skip_mean()) || index == 2) return &stat_md_;
         return &glob_zero_md;
     }
     const memory_desc_t *diff_dst_md(
@@ -306,7 +318,9 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
         return index == 0 ? &diff_scaleshift_md_ : &glob_zero_md;
     }
 
-    int n_inputs() const override { return 4 + use_scale() + use_shift(); }
+    int n_inputs() const override {
+        return 2 + n_stats() + use_scale() + use_shift();
+    }
     int n_outputs() const override {
         return 1
                 + (desc_.prop_kind == prop_kind::backward)
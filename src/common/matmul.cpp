@@ -46,6 +46,7 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
 
     // Check attributes
     const data_type_t src_dt = desc.src_desc.data_type;
+    const data_type_t wei_dt = desc.weights_desc.data_type;
     const data_type_t dst_dt = desc.dst_desc.data_type;
 
     // Matmul supports scales for floating point data types
@@ -55,6 +56,19 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
     const bool is_int8 = utils::one_of(src_dt, data_type::s8, data_type::u8);
     if (is_int8) attr_mask |= smask_t::zero_points_runtime;
 
+    // Weights decompression supports grouped scales and zero points of
+    // weights with non-default data types.
+    const bool is_wei_decomp = utils::one_of(src_dt, data_type::f32,
+                                       data_type::bf16, data_type::f16)
+            && utils::one_of(wei_dt, data_type::s8, data_type::u8,
+                    data_type::s4, data_type::u4);
+    if (is_wei_decomp)
+        attr_mask |= smask_t::zero_points_runtime
+                | smask_t::scales_runtime_groups
+                | smask_t::scales_runtime_data_type
+                | smask_t::zero_points_runtime_groups
+                | smask_t::zero_points_runtime_data_type;
+
     VCHECK_MATMUL_UNIMPL(attr->has_default_values(attr_mask, dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
 
@@ -65,9 +79,12 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
         const int mask_wei = sc.get(DNNL_ARG_WEIGHTS).mask_;
         const int mask_dst = sc.get(DNNL_ARG_DST).mask_;
 
+        const int ndims = desc.weights_desc.ndims;
+        const int kn_mask = (1 << (ndims - 1)) | (1 << (ndims - 2));
+
         VCHECK_MATMUL_UNIMPL(utils::everyone_is(0, mask_src, mask_dst)
-                        && utils::one_of(mask_wei, 0,
-                                1 << (desc.weights_desc.ndims - 1)),
+                        && (utils::one_of(mask_wei, 0, 1 << (ndims - 1))
+                                || (is_wei_decomp && mask_wei == kn_mask)),
                 VERBOSE_UNSUPPORTED_SCALES_CFG);
     }
 
@@ -79,14 +96,20 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
         zp.get(DNNL_ARG_WEIGHTS, &mask_wei);
         zp.get(DNNL_ARG_DST, &mask_dst);
 
-        VCHECK_MATMUL_UNIMPL(mask_wei == 0
-                        && (mask_src == 0
-                                || (desc.src_desc.ndims == 2
-                                        && mask_src == 1 << 1))
-                        && (mask_dst == 0
-                                || (desc.dst_desc.ndims == 2
-                                        && mask_dst == 1 << 1)),
-                VERBOSE_UNSUPPORTED_ZP_CFG);
+        const int ndims = desc.weights_desc.ndims;
+        const int kn_mask = (1 << (ndims - 1)) | (1 << (ndims - 2));
+        const bool wei_decomp_zp_ok = is_wei_decomp
+                && utils::everyone_is(0, mask_src, mask_dst)
+                && utils::one_of(mask_wei, 0, 1 << (ndims - 1), kn_mask);
+
+        const bool zp_ok = mask_wei == 0
+                && (mask_src == 0
+                        || (desc.src_desc.ndims == 2 && mask_src == 1 << 1))
+                && (mask_dst == 0
+                        || (desc.dst_desc.ndims == 2 && mask_dst == 1 << 1));
+
+        VCHECK_MATMUL_UNIMPL(
+                zp_ok || wei_decomp_zp_ok, VERBOSE_UNSUPPORTED_ZP_CFG);
     }
 
     // Check post-ops
@@ -130,16 +130,68 @@ struct matmul_pd_t : public primitive_desc_t {
     bool attr_scales_ok(const std::vector<int> &supported_args
             = {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST}) const {
         bool ok = attr()->scales_.has_default_values(supported_args);
+        const int n_mask = 1 << (ndims() - 1);
+        const int kn_mask = n_mask | (1 << (ndims() - 2));
         for (int arg : supported_args) {
             const auto &mask = attr()->scales_.get(arg).mask_;
             if (arg == DNNL_ARG_WEIGHTS)
-                ok = ok && (mask == 0 || mask == (1 << (dst_md()->ndims - 1)));
+                ok = ok
+                        && (mask == 0 || mask == n_mask
+                                || (with_wei_decompression()
+                                        && mask == kn_mask));
             else
                 ok = ok && (mask == 0);
         }
         return ok;
     }
 
+    // Weights decompression: integer weights are converted to the
+    // floating-point data type of the source before the multiplication. The
+    // weights scales and zero points may be grouped along the K dimension.
+    bool with_wei_decompression() const {
+        using namespace data_type;
+        return utils::one_of(src_md_.data_type, f32, bf16, f16)
+                && utils::one_of(weights_md_.data_type, s8, u8, s4, u4);
+    }
+
+    // Returns the number of consecutive weights elements along the K and N
+    // dimensions that share a single quantization parameter. A dimension that
+    // is not a part of the `mask` is shared as a whole.
+    void wei_qparam_groups(int mask, int group_ndims, const dim_t *groups,
+            dim_t &group_k, dim_t &group_n) const {
+        const bool per_k = mask & (1 << (ndims() - 2));
+        const bool per_n = mask & (1 << (ndims() - 1));
+        group_k = per_k ? (group_ndims == 2 ? groups[0] : 1) : K();
+        group_n = per_n ? (group_ndims > 0 ? groups[group_ndims - 1] : 1) : N();
+    }
+
+    // Checks the weights scales and zero points used for weights
+    // decompression: only per-K and per-N masks are supported, a per-K
+    // parameter requires groups, and groups must split K and N evenly.
+    bool attr_wei_decompression_ok() const {
+        const int kn_mask = (1 << (ndims() - 1)) | (1 << (ndims() - 2));
+        auto qparam_ok = [&](int mask, int group_ndims, const dim_t *groups) {
+            if ((mask & ~kn_mask) != 0) return false;
+            if (group_ndims == 0) return (mask & (1 << (ndims() - 2))) == 0;
+            if (group_ndims != 2) return false;
+            if (is_runtime_value(K()) || is_runtime_value(N())) return false;
+            dim_t group_k = 0, group_n = 0;
+            wei_qparam_groups(mask, group_ndims, groups, group_k, group_n);
+            return K() % group_k == 0 && N() % group_n == 0;
+        };
+
+        const auto &scales = attr()->scales_.get(DNNL_ARG_WEIGHTS);
+        const auto &zp = attr()->zero_points_;
+        bool ok = IMPLICATION(!scales.has_default_values(),
+                qparam_ok(scales.mask_, scales.ndims_, scales.group_dims_));
+        ok = ok
+                && IMPLICATION(!zp.has_default_values(DNNL_ARG_WEIGHTS),
+                        qparam_ok(zp.get(DNNL_ARG_WEIGHTS),
+                                zp.get_groups_ndims(DNNL_ARG_WEIGHTS),
+                                zp.get_groups(DNNL_ARG_WEIGHTS)));
+        return ok && with_wei_decompression();
+    }
+
 protected:
     matmul_desc_t desc_;
 
@@ -65,7 +65,8 @@ size_t memory_desc_map_size(const memory_desc_t *md, int index = 0) {
     memory_desc_t md_no_offset0 = *md;
     md_no_offset0.offset0 = 0;
     return memory_desc_wrapper(md_no_offset0).size(index)
-            + md->offset0 * mdw.data_type_size();
+            + utils::div_up(md->offset0 * mdw.data_type_size(),
+                    mdw.sub_byte_data_type_multiplier());
 }
 } // namespace
 
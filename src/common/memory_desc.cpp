@@ -122,6 +122,8 @@ status_t memory_desc_init_by_csr_encoding(memory_desc_t &memory_desc, int ndims,
     bool args_ok = memory_desc_sanity_check(
             ndims, dims, data_type, format_kind::undef);
     if (!args_ok) return invalid_arguments;
+    // Sparse sizes are computed in whole bytes per element.
+    if (one_of(data_type, data_type::s4, data_type::u4)) return unimplemented;
 
     auto md = memory_desc_t();
     md.ndims = ndims;
@@ -149,6 +151,8 @@ status_t memory_desc_init_by_packed_encoding(memory_desc_t &memory_desc,
     bool args_ok = memory_desc_sanity_check(
             ndims, dims, data_type, format_kind::undef);
     if (!args_ok) return invalid_arguments;
+    // Sparse sizes are computed in whole bytes per element.
+    if (one_of(data_type, data_type::s4, data_type::u4)) return unimplemented;
 
     auto md = memory_desc_t();
     md.ndims = ndims;
@@ -36,7 +36,12 @@ enum class wino_memory_format_t {
     // Tensor of weights for 4x3 convolution.
     //
     // Internal weights format for 4x3 Winograd.
-    wino_wei_OBaaIBOIio
+    wino_wei_OBaaIBOIio,
+    // Tensor of weights for 4x3 and 6x3 convolutions in bf16, pairs of input
+    // channels are interleaved.
+    //
+    // Internal weights format for 4x3 and 6x3 Winograd.
+    wino_wei_aaOIo2i
 };
 
 enum class rnn_packed_memory_format_t { undef, ldigo_p, ldgoi_p, ldio_p };
@@ -127,6 +127,12 @@ struct memory_desc_wrapper : public c_compatible {
     /** return the size of data type (a shortcut) */
     size_t data_type_size() const { return types::data_type_size(data_type()); }
 
+    /** return the number of elements packed into data_type_size() bytes */
+    size_t sub_byte_data_type_multiplier() const {
+        return utils::one_of(data_type(), data_type::s4, data_type::u4) ? 2
+                                                                        : 1;
+    }
+
     /** return the size of data type of additional buffer */
     size_t additional_buffer_data_size(uint64_t flag_select) const {
         using namespace memory_extra_flags;
@@ -244,7 +250,8 @@ struct memory_desc_wrapper : public c_compatible {
                 max_size = utils::array_product(bd.inner_blks, bd.inner_nblks);
             }
 
-            size_t data_size = max_size * data_type_size();
+            size_t data_size = utils::div_up(max_size * data_type_size(),
+                    sub_byte_data_type_multiplier());
             if (is_additional_buffer()) {
                 // The additional buffers, typically of data type int32_t, float
                 // are stored at the end of data. Pad the data, so that the
@@ -321,7 +328,8 @@ struct memory_desc_wrapper : public c_compatible {
         if (utils::one_of(format_kind(), format_kind::undef, format_kind::any))
             return false;
         if (has_runtime_dims_or_strides() || has_broadcast()) return false;
-        return nelems(with_padding) * data_type_size()
+        return utils::div_up(nelems(with_padding) * data_type_size(),
+                       sub_byte_data_type_multiplier())
                 == size(0, /* include_additional_size = */ false);
     }
 
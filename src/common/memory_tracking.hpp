@@ -220,6 +220,7 @@ enum {
     key_deconv_zp,
     key_eltwise_diff_dst,
     key_eltwise_src,
+    key_embedding_bag_acc,
     key_fusion_forward_scratchpad,
     key_fusion_inout_buffer,
     key_gemm_tmp_buffer,
@@ -227,6 +228,7 @@ enum {
     key_gemm_blocked_b,
     key_gemm_accumulator,
     key_gnorm_cvt,
+    key_gnorm_diff_coeffs,
     key_gnorm_reduction,
     key_gnorm_tmp_mean,
     key_gnorm_tmp_var,
@@ -281,10 +283,19 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_sdpa_acc,
+    key_sdpa_k_tile,
+    key_sdpa_probs,
+    key_sdpa_q_tile,
+    key_sdpa_scores,
+    key_sdpa_stats,
+    key_sdpa_v_tile,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_topk_indices,
+    key_topk_values,
     key_wino_U,
     key_wino_V,
     key_wino_M,
@@ -21,6 +21,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/gemm_types.hpp"
+#include "common/sdpa_types.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -417,6 +418,40 @@ struct reduction_desc_t {
     float p, eps;
 };
 
+// A descriptor of a top-k operation.
+struct topk_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_topk.
+    primitive_kind_t primitive_kind;
+    // Source memory descriptor.
+    memory_desc_t src_desc;
+    // Destination values memory descriptor.
+    memory_desc_t dst_desc;
+    // Destination indices memory descriptor.
+    memory_desc_t dst_indices_desc;
+    // The axis along which the largest values are selected. The number of
+    // selected values is the size of the destination along this axis.
+    int axis;
+};
+
+// A descriptor of an embedding bag operation.
+struct embedding_bag_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_embedding_bag.
+    primitive_kind_t primitive_kind;
+    // The kind of pooling applied to the rows of a bag. Possible values:
+    // #dnnl_reduction_sum, #dnnl_reduction_mean and #dnnl_reduction_max.
+    alg_kind_t alg_kind;
+    // Embedding table memory descriptor.
+    memory_desc_t src_desc;
+    // Indices memory descriptor.
+    memory_desc_t indices_desc;
+    // Offsets memory descriptor.
+    memory_desc_t offsets_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+};
+
 /// A descriptor of a Softmax operation.
 struct softmax_desc_t {
     // The kind of primitive. Used for self-identifying the primitive
@@ -614,6 +649,9 @@ struct op_desc_t {
         resampling_desc_t resampling;
         zero_pad_desc_t zero_pad;
         reduction_desc_t reduction;
+        topk_desc_t topk;
+        embedding_bag_desc_t embedding_bag;
+        sdpa_desc_t sdpa;
     };
 
 #define DECL_CTOR_AND_CONVERTERS(c_type) \
@@ -646,6 +684,9 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(resampling_desc_t);
     DECL_CTOR_AND_CONVERTERS(zero_pad_desc_t);
     DECL_CTOR_AND_CONVERTERS(reduction_desc_t);
+    DECL_CTOR_AND_CONVERTERS(topk_desc_t);
+    DECL_CTOR_AND_CONVERTERS(embedding_bag_desc_t);
+    DECL_CTOR_AND_CONVERTERS(sdpa_desc_t);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
     // special member functions hence the default destructor is implicitly
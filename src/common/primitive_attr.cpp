@@ -98,6 +98,20 @@ status_t zero_points_t::set(int arg, int mask) {
     return status::success;
 }
 
+status_t zero_points_t::set(int arg, int mask, int ndims, const dims_t groups,
+        data_type_t data_type) {
+    const bool is_default = ndims == 0 && data_type == data_type::s32;
+    if (arg != DNNL_ARG_WEIGHTS && !is_default) return status::unimplemented;
+
+    CHECK(set(arg, mask));
+    if (arg == DNNL_ARG_WEIGHTS) {
+        group_ndims_wei = ndims;
+        if (ndims > 0) utils::array_copy(group_dims_wei, groups, ndims);
+        data_type_wei = data_type;
+    }
+    return status::success;
+}
+
 } // namespace impl
 } // namespace dnnl
 
@@ -120,7 +134,16 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
             (bool)(~mask & (mask_name)), (mask_field).has_default_values()))
     CHECK_MASK(smask_t::oscale_runtime, output_scales_);
     CHECK_MASK(smask_t::scales, scales_);
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::scales_runtime_groups),
+            scales_.has_default_groups()));
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::scales_runtime_data_type),
+            scales_.has_default_data_type()));
     CHECK_MASK(smask_t::zero_points, zero_points_);
+    CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::zero_points_runtime_groups),
+            zero_points_.has_default_groups()));
+    CHECK_ARG(
+            IMPLICATION((bool)(~mask & smask_t::zero_points_runtime_data_type),
+                    zero_points_.has_default_data_type()));
     CHECK_MASK(smask_t::post_ops, post_ops_);
     CHECK_MASK(smask_t::rnn_data_qparams, rnn_data_qparams_);
     CHECK_MASK(smask_t::rnn_weights_qparams, rnn_weights_qparams_);
@@ -473,6 +496,19 @@ status_t dnnl_primitive_attr_set_scales_mask(
     return attr->scales_.set(arg, mask);
 }
 
+status_t dnnl_primitive_attr_set_scales(primitive_attr_t *attr, int arg,
+        int mask, int ndims, const dims_t group_dims, data_type_t data_type) {
+    bool ok = attr && mask >= 0 && arg >= 0 && ndims >= 0
+            && ndims <= DNNL_MAX_NDIMS && IMPLICATION(ndims > 0, group_dims)
+            && attr->output_scales_.has_default_values()
+            && utils::one_of(data_type, data_type::f32, data_type::bf16,
+                    data_type::f16);
+    if (!ok) return invalid_arguments;
+    for (int d = 0; d < ndims; d++)
+        if (group_dims[d] <= 0) return invalid_arguments;
+    return attr->scales_.set(arg, mask, ndims, group_dims, data_type);
+}
+
 status_t dnnl_primitive_attr_set_zero_points_mask(
         primitive_attr_t *attr, int arg, int mask) {
     bool ok = attr && mask >= 0;
@@ -481,6 +517,18 @@ status_t dnnl_primitive_attr_set_zero_points_mask(
     return attr->zero_points_.set(arg, mask);
 }
 
+status_t dnnl_primitive_attr_set_zero_points(primitive_attr_t *attr, int arg,
+        int mask, int ndims, const dims_t group_dims, data_type_t data_type) {
+    bool ok = attr && mask >= 0 && ndims >= 0 && ndims <= DNNL_MAX_NDIMS
+            && IMPLICATION(ndims > 0, group_dims)
+            && utils::one_of(data_type, data_type::s32, data_type::s8,
+                    data_type::u8, data_type::s4, data_type::u4);
+    if (!ok) return invalid_arguments;
+    for (int d = 0; d < ndims; d++)
+        if (group_dims[d] <= 0) return invalid_arguments;
+    return attr->zero_points_.set(arg, mask, ndims, group_dims, data_type);
+}
+
 status_t dnnl_primitive_attr_get_post_ops(
         const primitive_attr_t *attr, const post_ops_t **post_ops) {
     if (any_null(attr, post_ops)) return invalid_arguments;
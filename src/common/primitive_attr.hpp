@@ -184,29 +184,47 @@ struct runtime_scales_t : public c_compatible {
     // runtime_scales_t() = default;
     runtime_scales_t() {}
 
-    status_t set(int mask) {
+    status_t set(int mask) { return set(mask, 0, nullptr, data_type::f32); }
+
+    // Groups define the number of consecutive elements along the last
+    // `ndims` dimensions that share a single scale value.
+    status_t set(int mask, int ndims, const dims_t groups,
+            data_type_t data_type) {
         mask_ = mask;
         is_set_ = true;
+        ndims_ = ndims;
+        if (ndims > 0) utils::array_copy(group_dims_, groups, ndims);
+        data_type_ = data_type;
         return status::success;
     }
 
     bool operator==(const runtime_scales_t &rhs) const {
-        return mask_ == rhs.mask_ && is_set_ == rhs.is_set_;
+        return mask_ == rhs.mask_ && is_set_ == rhs.is_set_
+                && ndims_ == rhs.ndims_
+                && utils::array_cmp(group_dims_, rhs.group_dims_, ndims_)
+                && data_type_ == rhs.data_type_;
     }
 
     bool has_default_values() const { return !is_set_; }
+    bool has_default_groups() const { return ndims_ == 0; }
+    bool has_default_data_type() const { return data_type_ == data_type::f32; }
 
     bool defined() const { return has_default_values(); }
 
     void reset() {
         mask_ = 0;
         is_set_ = false;
+        ndims_ = 0;
+        data_type_ = data_type::f32;
     }
 
     // TODO: replace with `-1` to remove `is_set_`.
     // Hide `mask_` under `private:` to force interface usage.
     int mask_ = 0;
     bool is_set_ = false;
+    int ndims_ = 0;
+    dims_t group_dims_ = {};
+    data_type_t data_type_ = data_type::f32;
 };
 
 struct arg_scales_t : public c_compatible {
@@ -239,11 +257,29 @@ struct arg_scales_t : public c_compatible {
         return true;
     }
 
+    bool has_default_groups() const {
+        for (const auto &s : scales_)
+            if (!s.second.has_default_groups()) return false;
+        return true;
+    }
+
+    bool has_default_data_type() const {
+        for (const auto &s : scales_)
+            if (!s.second.has_default_data_type()) return false;
+        return true;
+    }
+
     status_t set(int arg, int mask) {
         if (!check_arg(arg)) return status::invalid_arguments;
         return scales_[arg].set(mask);
     }
 
+    status_t set(int arg, int mask, int ndims, const dims_t groups,
+            data_type_t data_type) {
+        if (!check_arg(arg)) return status::invalid_arguments;
+        return scales_[arg].set(mask, ndims, groups, data_type);
+    }
+
     status_t get(int arg, int *mask, bool *is_set) const {
         if (!check_arg(arg)) return status::invalid_arguments;
         const auto &s = get(arg);
@@ -267,11 +303,13 @@ struct arg_scales_t : public c_compatible {
             // new object.
             if (scales_.count(it->first) == 1) {
                 auto &entry = scales_[it->first];
-                bool exists = entry.mask_ == it->second.mask_;
+                bool exists = entry == it->second;
                 if (exists) continue;
             }
 
-            CHECK(set(it->first, it->second.mask_));
+            const auto &s = it->second;
+            CHECK(set(it->first, s.mask_, s.ndims_, s.group_dims_,
+                    s.data_type_));
         }
         return status::success;
     }
@@ -302,13 +340,23 @@ struct zero_points_t : public c_compatible {
     bool operator==(const zero_points_t &rhs) const {
         return mask_src == rhs.mask_src && mask_wei == rhs.mask_wei
                 && mask_dst == rhs.mask_dst && is_set_src == rhs.is_set_src
-                && is_set_wei == rhs.is_set_wei && is_set_dst == rhs.is_set_dst;
+                && is_set_wei == rhs.is_set_wei && is_set_dst == rhs.is_set_dst
+                && group_ndims_wei == rhs.group_ndims_wei
+                && utils::array_cmp(
+                        group_dims_wei, rhs.group_dims_wei, group_ndims_wei)
+                && data_type_wei == rhs.data_type_wei;
     }
 
     // arg-specific checks
     bool common(int arg) const { return get_mask(arg) == 0; }
     bool defined(int arg) const { return has_default_values(arg); }
     bool has_default_values(int arg) const { return is_set(arg) == false; }
+    bool has_default_groups(int arg) const {
+        return arg != DNNL_ARG_WEIGHTS || group_ndims_wei == 0;
+    }
+    bool has_default_data_type(int arg) const {
+        return get_data_type(arg) == data_type::s32;
+    }
 
     // same checks but for all supported arguments at once
     bool common() const { return check_all(&zero_points_t::common); }
@@ -316,16 +364,38 @@ struct zero_points_t : public c_compatible {
     bool has_default_values() const {
         return check_all(&zero_points_t::has_default_values);
     }
+    bool has_default_groups() const {
+        return check_all(&zero_points_t::has_default_groups);
+    }
+    bool has_default_data_type() const {
+        return check_all(&zero_points_t::has_default_data_type);
+    }
 
     status_t get(int arg, int *mask) const;
     int get(int arg) const; // Returns 0 if dimension is unset
 
+    // Groups and data types other than s32 are supported for weights only.
+    int get_groups_ndims(int arg) const {
+        return arg == DNNL_ARG_WEIGHTS ? group_ndims_wei : 0;
+    }
+    const dim_t *get_groups(int arg) const {
+        return arg == DNNL_ARG_WEIGHTS ? group_dims_wei : nullptr;
+    }
+    data_type_t get_data_type(int arg) const {
+        return arg == DNNL_ARG_WEIGHTS ? data_type_wei : data_type::s32;
+    }
+
     status_t set(int arg, int mask);
     status_t set(int arg) { return set(arg, 0); }
+    status_t set(int arg, int mask, int ndims, const dims_t groups,
+            data_type_t data_type);
 
 private:
     bool is_set_src = false, is_set_wei = false, is_set_dst = false;
     int mask_src = 0, mask_wei = 0, mask_dst = 0;
+    int group_ndims_wei = 0;
+    dims_t group_dims_wei = {};
+    data_type_t data_type_wei = data_type::s32;
 
     int get_mask(int arg) const {
         int mask = 0;
@@ -667,7 +737,12 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         sum_dt = 1u << 10,
         rnn_weights_projection_qparams = 1u << 11,
         gpu_attr = 1u << 12,
-        accumulation_mode = 1u << 13
+        accumulation_mode = 1u << 13,
+        scales_runtime_groups = (unsigned)scales_runtime | (1u << 14),
+        scales_runtime_data_type = (unsigned)scales_runtime | (1u << 15),
+        zero_points_runtime_groups = (unsigned)zero_points_runtime | (1u << 16),
+        zero_points_runtime_data_type
+        = (unsigned)zero_points_runtime | (1u << 17)
     };
 
     /** Returns true if the attributes have default values.
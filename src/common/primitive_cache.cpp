@@ -26,30 +26,60 @@
 namespace dnnl {
 namespace impl {
 
-// The cache uses LRU replacement policy
+// The cache uses LRU replacement policy. The cache is split into shards by
+// the key hash, each shard is an independent LRU cache with its own lock.
 struct primitive_cache_t {
     using key_t = primitive_hashing::key_t;
     using result_t = primitive_cache_iface_t::result_t;
     using create_func_t = result_t (&)(void *);
 
-    primitive_cache_t(int capacity) : cache_(capacity) {};
+    primitive_cache_t(int capacity, int nshards) {
+        assert(nshards > 0);
+        for (int i = 0; i < nshards; i++)
+            shards_.emplace_back(utils::make_unique<shard_t>(
+                    shard_capacity(capacity, i, nshards)));
+    }
 
     ~primitive_cache_t() = default;
 
     status_t set_capacity(int capacity) {
-        return cache_.set_capacity(capacity);
+        for (int i = 0; i < get_nshards(); i++)
+            CHECK(shards_[i]->set_capacity(
+                    shard_capacity(capacity, i, get_nshards())));
+        return status::success;
+    }
+    int get_capacity() const {
+        int capacity = 0;
+        for (const auto &s : shards_)
+            capacity += s->get_capacity();
+        return capacity;
+    }
+    int get_size() const {
+        int size = 0;
+        for (const auto &s : shards_)
+            size += s->get_size();
+        return size;
+    }
+
+    int get_nshards() const { return (int)shards_.size(); }
+    status_t get_stats(int shard, dnnl_primitive_cache_stats_t *stats) const {
+        if (shard < 0 || shard >= get_nshards())
+            return status::invalid_arguments;
+        auto s = shards_[shard]->get_stats();
+        stats->hits = s.hits;
+        stats->misses = s.misses;
+        stats->evictions = s.evictions;
+        return status::success;
     }
-    int get_capacity() const { return cache_.get_capacity(); }
-    int get_size() const { return cache_.get_size(); }
 
     std::shared_ptr<primitive_desc_t> get_pd(const key_t &key) {
-        result_t result = cache_.get(key);
+        result_t result = get_shard(key).get(key);
         return result.value != nullptr ? result.value->pd() : nullptr;
     }
 
     result_t get_or_create(
             const key_t &key, create_func_t create, void *create_context) {
-        return cache_.get_or_create(key, create, create_context);
+        return get_shard(key).get_or_create(key, create, create_context);
     }
 
 private:
@@ -58,24 +88,44 @@ private:
         key.op_desc_ = pd->op_desc();
         key.attr_ = pd->attr();
     }
+    using shard_t
+            = utils::lru_cache_t<key_t, primitive_t, result_t, update_key>;
+
+    // The capacity is distributed across the shards as evenly as possible.
+    static int shard_capacity(int capacity, int shard, int nshards) {
+        return capacity / nshards + (shard < capacity % nshards);
+    }
+
+    shard_t &get_shard(const key_t &key) {
+        // Avoid computing the hash twice in the default configuration.
+        if (shards_.size() == 1) return *shards_[0];
+        return *shards_[std::hash<key_t>()(key) % shards_.size()];
+    }
+
     // Used for testing.
     friend size_t DNNL_API set_primitive_cache_capacity_without_clearing(
             size_t capacity);
     void set_capacity_without_clearing(int capacity) {
-        cache_.set_capacity_without_clearing(capacity);
+        for (int i = 0; i < get_nshards(); i++)
+            shards_[i]->set_capacity_without_clearing(
+                    shard_capacity(capacity, i, get_nshards()));
     }
 
-    utils::lru_cache_t<key_t, primitive_t, result_t, update_key> cache_;
+    std::vector<std::unique_ptr<shard_t>> shards_;
 };
 
 primitive_cache_t &global_primitive_cache() {
 #ifndef DNNL_DISABLE_PRIMITIVE_CACHE
     static const int capacity
             = getenv_int_user("PRIMITIVE_CACHE_CAPACITY", 1024);
+    // Every shard must be able to hold at least one primitive.
+    static const int nshards = nstl::max(1,
+            nstl::min(capacity, getenv_int_user("PRIMITIVE_CACHE_SHARDS", 1)));
 #else
     static const int capacity = 0;
+    static const int nshards = 1;
 #endif
-    static primitive_cache_t cache(capacity);
+    static primitive_cache_t cache(capacity, nshards);
     return cache;
 }
 
@@ -147,6 +197,24 @@ dnnl::impl::status_t dnnl_get_primitive_cache_capacity(int *capacity) {
     return dnnl::impl::status::success;
 }
 
+dnnl::impl::status_t dnnl_get_primitive_cache_shards(int *shards) {
+    if (shards == nullptr) return dnnl::impl::status::invalid_arguments;
+    *shards = 0;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    *shards = dnnl::impl::global_primitive_cache().get_nshards();
+#endif
+    return dnnl::impl::status::success;
+}
+
+dnnl::impl::status_t dnnl_get_primitive_cache_stats(
+        int shard, dnnl_primitive_cache_stats_t *stats) {
+    if (stats == nullptr) return dnnl::impl::status::invalid_arguments;
+#ifndef DNNL_DISABLE_PRIMITIVE_CACHE
+    return dnnl::impl::global_primitive_cache().get_stats(shard, stats);
+#endif
+    return dnnl::impl::status::invalid_arguments;
+}
+
 dnnl::impl::status_t dnnl_set_primitive_cache_capacity(int capacity) {
     if (capacity < 0) return dnnl::impl::status::invalid_arguments;
 #ifndef DNNL_DISABLE_PRIMITIVE_CACHE
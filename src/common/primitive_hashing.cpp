@@ -69,6 +69,7 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
             CASE(group_normalization)
             CASE(inner_product)
@@ -84,7 +85,9 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
+            CASE(sdpa)
             default: assert(!"unknown primitive kind");
         }
 #undef CASE
@@ -213,6 +216,14 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
             seed = hash_combine(seed, p.first);
             // scales: mask
             seed = hash_combine(seed, p.second.mask_);
+            // scales: groups
+            const int ndims = p.second.ndims_;
+            seed = hash_combine(seed, ndims);
+            if (ndims > 0)
+                seed = get_array_hash(seed, p.second.group_dims_, ndims);
+            // scales: data type
+            seed = hash_combine(
+                    seed, static_cast<size_t>(p.second.data_type_));
         }
     }
     // zero_points
@@ -224,6 +235,15 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
             attr.zero_points_.get(arg, &mask);
             // zero_points: mask
             seed = hash_combine(seed, mask);
+            // zero_points: groups
+            const int ndims = attr.zero_points_.get_groups_ndims(arg);
+            seed = hash_combine(seed, ndims);
+            if (ndims > 0)
+                seed = get_array_hash(
+                        seed, attr.zero_points_.get_groups(arg), ndims);
+            // zero_points: data type
+            seed = hash_combine(seed,
+                    static_cast<size_t>(attr.zero_points_.get_data_type(arg)));
         }
     // post_ops: entry[:]
     for (int i = 0; i < attr.post_ops_.len(); i++) {
@@ -384,6 +404,20 @@ size_t get_desc_hash(const eltwise_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const embedding_bag_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for embedding bag desc
+    return seed;
+}
+
 size_t get_desc_hash(const gemm_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -677,6 +711,20 @@ size_t get_desc_hash(const sum_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const topk_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_indices_desc));
+    // Axis
+    seed = hash_combine(seed, desc.axis);
+    // Combined hash for topk desc
+    return seed;
+}
+
 size_t get_desc_hash(const zero_pad_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -684,6 +732,34 @@ size_t get_desc_hash(const zero_pad_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const sdpa_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.q_desc));
+    seed = hash_combine(seed, get_md_hash(desc.k_desc));
+    seed = hash_combine(seed, get_md_hash(desc.v_desc));
+    seed = hash_combine(seed, get_md_hash(desc.attn_mask_desc));
+    seed = hash_combine(seed, get_md_hash(desc.scale_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Scale and mask kinds
+    seed = hash_combine(seed, desc.invert_scale);
+    seed = hash_combine(seed, static_cast<size_t>(desc.mask_type));
+    // Quantization parameters
+    for (const auto *q : {&desc.q_quant, &desc.k_quant, &desc.v_quant,
+                 &desc.dst_quant, &desc.probs_quant, &desc.probs_dequant}) {
+        seed = hash_combine(seed, q->scale);
+        seed = hash_combine(seed, q->zero_point);
+    }
+    seed = hash_combine(seed, static_cast<size_t>(desc.probs_dt));
+    // Paged KV
+    seed = hash_combine(seed, get_md_hash(desc.kv_block_table_desc));
+    seed = hash_combine(seed, desc.kv_keys);
+    // Combined hash for sdpa desc
+    return seed;
+}
+
 } // namespace primitive_hashing
 } // namespace impl
 } // namespace dnnl
@@ -78,6 +78,7 @@ size_t get_desc_hash(const batch_normalization_desc_t &desc);
 size_t get_desc_hash(const binary_desc_t &desc);
 size_t get_desc_hash(const convolution_desc_t &desc);
 size_t get_desc_hash(const eltwise_desc_t &desc);
+size_t get_desc_hash(const embedding_bag_desc_t &desc);
 size_t get_desc_hash(const gemm_desc_t &desc);
 size_t get_desc_hash(const group_normalization_desc_t &desc);
 size_t get_desc_hash(const inner_product_desc_t &desc);
@@ -93,7 +94,9 @@ size_t get_desc_hash(const rnn_desc_t &desc);
 size_t get_desc_hash(const shuffle_desc_t &desc);
 size_t get_desc_hash(const softmax_desc_t &desc);
 size_t get_desc_hash(const sum_desc_t &desc);
+size_t get_desc_hash(const topk_desc_t &desc);
 size_t get_desc_hash(const zero_pad_desc_t &desc);
+size_t get_desc_hash(const sdpa_desc_t &desc);
 
 template <typename T>
 size_t get_array_hash(size_t seed, const T *v, int size) {
@@ -165,6 +168,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(embedding_bag)
             CASE(gemm)
             CASE(group_normalization)
             CASE(inner_product)
@@ -180,7 +184,9 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
+            CASE(sdpa)
             default: assert(!"unknown primitive_kind");
         }
             // clang-format on
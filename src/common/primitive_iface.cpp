@@ -17,6 +17,7 @@
 #include <string>
 
 #include "c_types_map.hpp"
+#include "cache_blob_pool.hpp"
 #include "engine.hpp"
 
 #if defined(DNNL_ENABLE_ITT_TASKS)
@@ -32,6 +33,7 @@
 #include "scratchpad_debug.hpp"
 #include "stack_checker.hpp"
 #include "stream.hpp"
+#include "trace.hpp"
 #include "utils.hpp"
 
 using namespace dnnl::impl;
@@ -60,10 +62,28 @@ namespace impl {
 
 status_t primitive_create(primitive_iface_t **primitive_iface,
         const primitive_desc_iface_t *primitive_desc_iface,
-        const cache_blob_t &cache_blob = cache_blob_t()) {
+        const cache_blob_t &user_cache_blob = cache_blob_t()) {
 
     std::pair<primitive_iface_t *, bool> p_iface;
 
+    // When a cache blob pool is active, take the cache blob from the pool if
+    // the user did not provide one, and record the primitive in the pool.
+    // Primitives that do not support cache blobs are not recorded.
+    cache_blob_t cache_blob = user_cache_blob;
+    auto *pool = cache_blob_pool_t::get_active();
+    if (pool) {
+        const auto &id = primitive_desc_iface->impl()->get_cache_blob_id(
+                primitive_desc_iface->engine());
+        if (id.empty()) {
+            pool = nullptr;
+        } else if (!cache_blob) {
+            const auto *blob = pool->find_blob(id);
+            if (blob)
+                cache_blob = cache_blob_t(
+                        const_cast<uint8_t *>(blob->data()), blob->size());
+        }
+    }
+
     if (get_verbose(verbose_t::create_profile,
                 prim_kind2_comp_kind(primitive_desc_iface->impl()->kind()))) {
         double start_ms = get_msec();
@@ -80,6 +100,7 @@ status_t primitive_create(primitive_iface_t **primitive_iface,
         CHECK(primitive_desc_iface->create_primitive_iface(
                 p_iface, cache_blob));
     }
+    if (pool) pool->record(p_iface.first);
     return safe_ptr_assign((*primitive_iface), p_iface.first);
 }
 
@@ -94,6 +115,15 @@ status_t primitive_execute(
         itt::primitive_task_start(primitive_iface->pd()->impl()->kind());
 #endif
 
+    // For asynchronous streams the event covers the submission only.
+    trace::scope_t trace_scope;
+    if (trace::is_enabled()) {
+        const auto kind = primitive_iface->pd()->impl()->kind();
+        trace_scope.start(kind == reorder ? trace::category_t::reorder
+                                          : trace::category_t::primitive,
+                prim_kind2str(kind), primitive_iface->pd()->info());
+    }
+
     if (get_verbose(verbose_t::exec_profile,
                 prim_kind2_comp_kind(primitive_iface->pd()->impl()->kind()))) {
         stream->wait();
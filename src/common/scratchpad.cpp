@@ -147,9 +147,12 @@ scratchpad_t *create_scratchpad(
     /*
      * TODO: global scratchpad should be able to handle memory
      * from different engines.
-     * lock global scratchpad to work with CPU engine only.
+     * lock global scratchpad to work with CPU engine only. Engines with a
+     * user-provided allocator own their scratchpads as the global one outlives
+     * them.
      */
-    if (use_global_scratchpad && engine->kind() == engine_kind_t::dnnl_cpu)
+    if (use_global_scratchpad && engine->kind() == engine_kind_t::dnnl_cpu
+            && !engine->has_host_allocator())
         return new global_scratchpad_t(engine, size);
     else
         return new concurrent_scratchpad_t(engine, size);
@@ -0,0 +1,174 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SDPA_PD_HPP
+#define COMMON_SDPA_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc.hpp"
+#include "common/sdpa_types.hpp"
+#include "common/utils.hpp"
+
+#define VDISPATCH_SDPA(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, sdpa, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+struct sdpa_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::sdpa;
+
+    typedef sdpa_pd_t base_class;
+    typedef sdpa_pd_t hint_class;
+
+    const sdpa_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(
+                    arg, DNNL_ARG_QUERIES, DNNL_ARG_KEYS, DNNL_ARG_VALUES))
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_ATTN_MASK && desc_.with_attn_mask())
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_SCALE && desc_.with_scale())
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_KV_BLOCK_TABLE && desc_.with_paged_kv())
+            return arg_usage_t::input;
+
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_QUERIES: return src_md(0);
+            case DNNL_ARG_KEYS: return src_md(1);
+            case DNNL_ARG_VALUES: return src_md(2);
+            case DNNL_ARG_ATTN_MASK: return src_md(3);
+            case DNNL_ARG_SCALE: return src_md(4);
+            case DNNL_ARG_KV_BLOCK_TABLE: return src_md(5);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.q_desc;
+            case 1: return &desc_.k_desc;
+            case 2: return &desc_.v_desc;
+            case 3:
+                return desc_.with_attn_mask() ? &desc_.attn_mask_desc
+                                              : &glob_zero_md;
+            case 4:
+                return desc_.with_scale() ? &desc_.scale_desc : &glob_zero_md;
+            case 5:
+                return desc_.with_paged_kv() ? &desc_.kv_block_table_desc
+                                             : &glob_zero_md;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        return index == 0 ? &desc_.dst_desc : &glob_zero_md;
+    }
+
+    int n_inputs() const override {
+        return 3 + desc_.with_attn_mask() + desc_.with_scale()
+                + desc_.with_paged_kv();
+    }
+    int n_outputs() const override { return 1; }
+
+    dim_t MB() const { return desc_.batch(); }
+    dim_t q_heads() const { return desc_.q_heads(); }
+    dim_t kv_heads() const { return desc_.kv_heads(); }
+    dim_t queries() const { return desc_.queries(); }
+    dim_t keys() const { return desc_.keys(); }
+    dim_t head_size() const { return desc_.head_size(); }
+    dim_t values() const { return desc_.values(); }
+
+    bool with_attn_mask() const { return desc_.with_attn_mask(); }
+    bool with_causal_mask() const { return desc_.with_causal_mask(); }
+    bool with_scale() const { return desc_.with_scale(); }
+    bool with_paged_kv() const { return desc_.with_paged_kv(); }
+    bool with_probs_quantization() const {
+        return desc_.probs_dt != data_type::undef;
+    }
+
+protected:
+    sdpa_desc_t desc_;
+
+    sdpa_pd_t(const sdpa_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd_pd)
+        : primitive_desc_t(attr, base_pkind), desc_(*adesc) {}
+
+    // Checks the shapes consistency. The memory descriptors are expected to
+    // be fully defined: the tensors are usually views of bigger ones.
+    bool check_shapes() const {
+        const auto &q = desc_.q_desc;
+        const auto &k = desc_.k_desc;
+        const auto &v = desc_.v_desc;
+        const auto &dst = desc_.dst_desc;
+        // The keys and values of paged KV are pools of pages.
+        const dim_t kv_mb = with_paged_kv() ? k.dims[0] : q.dims[0];
+        bool ok = utils::everyone_is(4, q.ndims, k.ndims, v.ndims, dst.ndims)
+                && q.dims[0] == dst.dims[0] && k.dims[0] == kv_mb
+                && v.dims[0] == kv_mb && q.dims[1] == dst.dims[1]
+                && k.dims[1] == v.dims[1]
+                && k.dims[1] > 0 && q.dims[1] % k.dims[1] == 0
+                && q.dims[2] == dst.dims[2] && q.dims[3] == k.dims[2]
+                && k.dims[3] == v.dims[2] && v.dims[3] == dst.dims[3];
+        if (!ok) return false;
+
+        if (with_attn_mask()) {
+            const auto &m = desc_.attn_mask_desc;
+            const dims_t full_dims
+                    = {MB(), q_heads(), queries(), keys()};
+            if (m.ndims != 4) return false;
+            for (int d = 0; d < 4; ++d)
+                if (!utils::one_of(m.dims[d], 1, full_dims[d])) return false;
+        }
+        if (with_scale()) {
+            memory_desc_wrapper scale_d(desc_.scale_desc);
+            if (scale_d.nelems() != 1) return false;
+        }
+        if (with_paged_kv()) {
+            // The block table covers all the keys of every sequence.
+            const auto &bt = desc_.kv_block_table_desc;
+            if (bt.ndims != 2 || bt.dims[0] != MB() || keys() <= 0
+                    || bt.dims[1] * desc_.kv_page_size() < keys())
+                return false;
+        }
+        return true;
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,45 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/sdpa_types.hpp"
+#include "common/sdpa_utils.hpp"
+#include "common/utils.hpp"
+
+using namespace dnnl::impl;
+
+// The SDPA primitive has no public API, the function is exported for the
+// internal tests only.
+dnnl_status_t DNNL_API sdpa_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t q_desc, const_dnnl_memory_desc_t k_desc,
+        const_dnnl_memory_desc_t v_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t attn_mask_desc,
+        const_dnnl_memory_desc_t scale_desc, bool invert_scale,
+        attn_mask_type_t mask_type,
+        const_dnnl_memory_desc_t kv_block_table_desc, dnnl_dim_t kv_keys,
+        const_dnnl_primitive_attr_t attr) {
+    sdpa_desc_t desc;
+    CHECK(create_sdpa_desc(&desc, q_desc, k_desc, v_desc, dst_desc,
+            attn_mask_desc, scale_desc, invert_scale, mask_type));
+    if (kv_block_table_desc)
+        CHECK(sdpa_desc_init_paged_kv(&desc, kv_block_table_desc, kv_keys));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&desc, nullptr, attr);
+}
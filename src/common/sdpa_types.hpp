@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SDPA_TYPES_HPP
+#define COMMON_SDPA_TYPES_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define DNNL_ARG_QUERIES DNNL_ARG_SRC_0
+#define DNNL_ARG_KEYS DNNL_ARG_SRC_1
+#define DNNL_ARG_VALUES DNNL_ARG_SRC_2
+#define DNNL_ARG_ATTN_MASK DNNL_ARG_SHIFT
+#define DNNL_ARG_KV_BLOCK_TABLE DNNL_ARG_SRC_3
+
+enum attn_mask_type_t {
+    dnnl_attn_mask_undef,
+    // The mask is passed as a tensor added to the scores.
+    dnnl_attn_mask_buffer,
+    // Causal mask aligned to the top left corner of the scores matrix: query
+    // `i` attends to keys `[0, i]`.
+    dnnl_attn_mask_top_left,
+    // Causal mask aligned to the bottom right corner of the scores matrix:
+    // query `i` attends to keys `[0, i + keys - queries]`.
+    dnnl_attn_mask_bottom_right,
+};
+
+namespace attn_mask_type {
+const attn_mask_type_t undef = dnnl_attn_mask_undef;
+const attn_mask_type_t buffer = dnnl_attn_mask_buffer;
+const attn_mask_type_t top_left = dnnl_attn_mask_top_left;
+const attn_mask_type_t bottom_right = dnnl_attn_mask_bottom_right;
+} // namespace attn_mask_type
+
+// Per-tensor quantization parameters: f32 = (x - zero_point) * scale.
+struct sdpa_quant_t {
+    float scale;
+    int zero_point;
+};
+
+// A descriptor of the scaled dot-product attention:
+//     dst = softmax(scale(Q * K) + mask) * V
+// All the tensors are 4D with the batch and head dimensions going first.
+struct sdpa_desc_t {
+    // The kind of primitive. Used for self identifying the primitive
+    // descriptor. Must be #primitive_kind::sdpa.
+    primitive_kind_t primitive_kind;
+    // Queries: [batch, q_heads, queries, head_size].
+    memory_desc_t q_desc;
+    // Transposed keys: [batch, kv_heads, head_size, keys].
+    memory_desc_t k_desc;
+    // Values: [batch, kv_heads, keys, values].
+    memory_desc_t v_desc;
+    // Attention mask broadcastable to [batch, q_heads, queries, keys]. Used
+    // with #attn_mask_type::buffer only.
+    memory_desc_t attn_mask_desc;
+    // Scalar scale. If not set, the scores are multiplied by
+    // 1 / sqrt(head_size).
+    memory_desc_t scale_desc;
+    // Destination: [batch, q_heads, queries, values].
+    memory_desc_t dst_desc;
+    // The scores are divided by the scale rather than multiplied by it.
+    bool invert_scale;
+    attn_mask_type_t mask_type;
+
+    // Quantization parameters of the integer queries, keys, values and
+    // destination.
+    sdpa_quant_t q_quant;
+    sdpa_quant_t k_quant;
+    sdpa_quant_t v_quant;
+    sdpa_quant_t dst_quant;
+    // If set to an integer data type, the probabilities are quantized to it
+    // with `probs_quant` and dequantized back with `probs_dequant` before the
+    // multiplication by the values.
+    data_type_t probs_dt;
+    sdpa_quant_t probs_quant;
+    sdpa_quant_t probs_dequant;
+
+    // Paged keys and values. If the block table is set, `k_desc` and
+    // `v_desc` describe a pool of pages: [pages, kv_heads, head_size,
+    // page_size] and [pages, kv_heads, page_size, values] respectively. The
+    // block table is an s32 [batch, max_pages] tensor with the indices of the
+    // pages of each sequence in the pool, and `kv_keys` is the number of keys.
+    // The indices of the pages holding the keys are checked against the pool
+    // at execution.
+    memory_desc_t kv_block_table_desc;
+    dim_t kv_keys;
+
+    dim_t batch() const { return q_desc.dims[0]; }
+    dim_t q_heads() const { return q_desc.dims[1]; }
+    dim_t kv_heads() const { return k_desc.dims[1]; }
+    dim_t queries() const { return q_desc.dims[2]; }
+    dim_t keys() const { return with_paged_kv() ? kv_keys : k_desc.dims[3]; }
+    dim_t head_size() const { return q_desc.dims[3]; }
+    dim_t values() const { return v_desc.dims[3]; }
+    // Number of query heads that share a key/value head.
+    dim_t q_per_kv_heads() const { return q_heads() / kv_heads(); }
+
+    bool with_attn_mask() const {
+        return mask_type == attn_mask_type::buffer;
+    }
+    bool with_causal_mask() const {
+        return mask_type == attn_mask_type::top_left
+                || mask_type == attn_mask_type::bottom_right;
+    }
+    bool with_scale() const { return scale_desc.ndims != 0; }
+    bool with_paged_kv() const { return kv_block_table_desc.ndims != 0; }
+    dim_t kv_page_size() const { return k_desc.dims[3]; }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SDPA_UTILS_HPP
+#define COMMON_SDPA_UTILS_HPP
+
+#include <memory>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc_iterator.hpp"
+#include "common/sdpa_pd.hpp"
+#include "common/sdpa_types.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Creates a floating-point SDPA descriptor. `attn_mask_md` and `scale_md` may
+// be nullptr. For integer tensors the quantization parameters are to be set
+// in the descriptor afterwards.
+static inline status_t create_sdpa_desc(sdpa_desc_t *sdpa_desc,
+        const memory_desc_t *q_md, const memory_desc_t *k_md,
+        const memory_desc_t *v_md, const memory_desc_t *dst_md,
+        const memory_desc_t *attn_mask_md, const memory_desc_t *scale_md,
+        bool invert_scale, attn_mask_type_t mask_type) {
+    if (utils::any_null(sdpa_desc, q_md, k_md, v_md, dst_md))
+        return status::invalid_arguments;
+    if ((mask_type == attn_mask_type::buffer) != (attn_mask_md != nullptr))
+        return status::invalid_arguments;
+
+    auto desc = sdpa_desc_t();
+    desc.primitive_kind = primitive_kind::sdpa;
+    desc.q_desc = *q_md;
+    desc.k_desc = *k_md;
+    desc.v_desc = *v_md;
+    desc.dst_desc = *dst_md;
+    if (attn_mask_md) desc.attn_mask_desc = *attn_mask_md;
+    if (scale_md) desc.scale_desc = *scale_md;
+    desc.invert_scale = invert_scale;
+    desc.mask_type = mask_type;
+    for (auto *q : {&desc.q_quant, &desc.k_quant, &desc.v_quant,
+                 &desc.dst_quant, &desc.probs_quant, &desc.probs_dequant}) {
+        q->scale = 1.f;
+        q->zero_point = 0;
+    }
+    desc.probs_dt = data_type::undef;
+
+    *sdpa_desc = desc;
+    return status::success;
+}
+
+// Switches an SDPA descriptor to a paged KV cache. `k_desc` and `v_desc` of
+// the descriptor describe the page pools and `block_table_md` maps the logical
+// pages of every batch entry to pool pages; `keys` is the number of valid keys.
+static inline status_t sdpa_desc_init_paged_kv(sdpa_desc_t *sdpa_desc,
+        const memory_desc_t *block_table_md, dim_t keys) {
+    if (utils::any_null(sdpa_desc, block_table_md) || keys <= 0)
+        return status::invalid_arguments;
+    sdpa_desc->kv_block_table_desc = *block_table_md;
+    sdpa_desc->kv_keys = keys;
+    return status::success;
+}
+
+static inline status_t create_sdpa_pd(
+        std::shared_ptr<primitive_desc_t> &sdpa_pd_, engine_t *engine,
+        const sdpa_desc_t *sdpa_desc, const primitive_attr_t *attr) {
+    primitive_attr_t sdpa_attr = *attr;
+
+    primitive_desc_iterator_t it(
+            engine, (op_desc_t *)sdpa_desc, &sdpa_attr, nullptr);
+
+    sdpa_pd_ = *(++it);
+    if (!sdpa_pd_) return status::unimplemented;
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
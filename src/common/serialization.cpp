@@ -36,6 +36,7 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(embedding_bag)
         CASE(gemm)
         CASE(group_normalization)
         CASE(inner_product)
@@ -48,9 +49,11 @@ status_t serialize_desc(
         CASE(reorder)
         CASE(resampling)
         CASE(rnn)
+        CASE(sdpa)
         CASE(shuffle)
         CASE(softmax)
         CASE(sum)
+        CASE(topk)
         default: return status::invalid_arguments;
     }
 #undef CASE
@@ -182,6 +185,10 @@ void serialize_attr(
         for (const auto &p : attr.scales_.scales_) {
             sstream.write(&p.first);
             sstream.write(&p.second.mask_);
+            sstream.write(&p.second.ndims_);
+            if (p.second.ndims_ > 0)
+                sstream.write(p.second.group_dims_, p.second.ndims_);
+            sstream.write(&p.second.data_type_);
         }
     }
     // zero_points
@@ -193,6 +200,14 @@ void serialize_attr(
             attr.zero_points_.get(arg, &mask);
             // zero_points: mask
             sstream.write(&mask);
+            // zero_points: groups
+            const int ndims = attr.zero_points_.get_groups_ndims(arg);
+            sstream.write(&ndims);
+            if (ndims > 0)
+                sstream.write(attr.zero_points_.get_groups(arg), ndims);
+            // zero_points: data type
+            const data_type_t dt = attr.zero_points_.get_data_type(arg);
+            sstream.write(&dt);
         }
 
     serialize_post_ops(sstream, attr.post_ops_);
@@ -549,6 +564,31 @@ void serialize_desc(
     sstream.write(&desc.softmax_axis);
 }
 
+void serialize_desc(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
+    // Kind
+    sstream.write(&desc.primitive_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.q_desc);
+    serialize_md(sstream, desc.k_desc);
+    serialize_md(sstream, desc.v_desc);
+    serialize_md(sstream, desc.attn_mask_desc);
+    serialize_md(sstream, desc.scale_desc);
+    serialize_md(sstream, desc.dst_desc);
+    // Scale and mask kinds
+    sstream.write(&desc.invert_scale);
+    sstream.write(&desc.mask_type);
+    // Quantization parameters
+    for (const auto *q : {&desc.q_quant, &desc.k_quant, &desc.v_quant,
+                 &desc.dst_quant, &desc.probs_quant, &desc.probs_dequant}) {
+        sstream.write(&q->scale);
+        sstream.write(&q->zero_point);
+    }
+    sstream.write(&desc.probs_dt);
+    // Paged KV
+    serialize_md(sstream, desc.kv_block_table_desc);
+    sstream.write(&desc.kv_keys);
+}
+
 void serialize_desc(serialization_stream_t &sstream, const sum_desc_t &desc) {
     // Kinds
     sstream.write(&desc.primitive_kind);
@@ -563,6 +603,29 @@ void serialize_desc(serialization_stream_t &sstream, const sum_desc_t &desc) {
         serialize_md(sstream, *desc.src_mds[i]);
 }
 
+void serialize_desc(serialization_stream_t &sstream, const topk_desc_t &desc) {
+    // Kind
+    sstream.write(&desc.primitive_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.dst_indices_desc);
+    // Axis
+    sstream.write(&desc.axis);
+}
+
+void serialize_desc(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.indices_desc);
+    serialize_md(sstream, desc.offsets_desc);
+    serialize_md(sstream, desc.dst_desc);
+}
+
 } // namespace serialization
 } // namespace impl
 } // namespace dnnl
@@ -59,11 +59,15 @@ void serialize_desc(
 void serialize_desc(
         serialization_stream_t &sstream, const resampling_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream, const rnn_desc_t &desc);
+void serialize_desc(serialization_stream_t &sstream, const sdpa_desc_t &desc);
 void serialize_desc(
         serialization_stream_t &sstream, const shuffle_desc_t &desc);
 void serialize_desc(
         serialization_stream_t &sstream, const softmax_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream, const sum_desc_t &desc);
+void serialize_desc(serialization_stream_t &sstream, const topk_desc_t &desc);
+void serialize_desc(
+        serialization_stream_t &sstream, const embedding_bag_desc_t &desc);
 
 status_t serialize_desc(
         serialization_stream_t &sstream, const op_desc_t *op_desc);
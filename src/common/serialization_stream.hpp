@@ -17,6 +17,7 @@
 #ifndef COMMON_SERIALIZATION_STREAM_HPP
 #define COMMON_SERIALIZATION_STREAM_HPP
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 #include <type_traits>
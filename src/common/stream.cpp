@@ -40,8 +40,10 @@ status_t dnnl_stream_create(
     bool args_ok = !utils::any_null(stream, engine);
     if (!args_ok) return invalid_arguments;
 
-    if (engine->kind() != engine_kind::gpu
-            && (flags & stream_flags::profiling)) {
+    // Profiling is supported on GPU engines and native CPU engines.
+    const bool profiling_supported = engine->kind() == engine_kind::gpu
+            || is_native_runtime(engine->runtime_kind());
+    if (!profiling_supported && (flags & stream_flags::profiling)) {
         return status::unimplemented;
     }
 
@@ -60,6 +60,11 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
         return dnnl::impl::status::unimplemented;
     }
 
+    virtual dnnl::impl::status_t get_profiling_impl_names(
+            int *num_entries, const char **names) const {
+        return dnnl::impl::status::unimplemented;
+    }
+
     virtual dnnl::impl::status_t notify_profiling_complete() const {
         return dnnl::impl::status::unimplemented;
     }
@@ -17,7 +17,9 @@
 #include "oneapi/dnnl/dnnl.h"
 
 #include "common/c_types_map.hpp"
+#include "common/engine.hpp"
 #include "common/stream.hpp"
+#include "common/utils.hpp"
 
 using namespace dnnl::impl;
 using namespace dnnl::impl::status;
@@ -32,10 +34,19 @@ using namespace dnnl::impl::status;
 #define INTERNAL_API_ATTRIBUTE(rtype) extern "C" rtype DNNL_API
 #endif
 
+namespace {
+// Profiling is supported on GPU engines and on CPU engines with a native
+// runtime.
+bool is_profiling_supported(const stream_t *stream) {
+    const auto *engine = stream->engine();
+    return engine->kind() == engine_kind::gpu
+            || is_native_runtime(engine->runtime_kind());
+}
+} // namespace
+
 INTERNAL_API_ATTRIBUTE(status_t) dnnl_reset_profiling(stream_t *stream) {
-    const auto eng_kind = stream->engine()->kind();
-    if (eng_kind != engine_kind::gpu) {
-        VERROR(common, common, "CPU engine does not support profiling");
+    if (!is_profiling_supported(stream)) {
+        VERROR(common, common, "engine does not support profiling");
         return status::unimplemented;
     }
     return stream->reset_profiling();
@@ -44,19 +55,27 @@ INTERNAL_API_ATTRIBUTE(status_t) dnnl_reset_profiling(stream_t *stream) {
 INTERNAL_API_ATTRIBUTE(status_t)
 dnnl_query_profiling_data(stream_t *stream, profiling_data_kind_t data_kind,
         int *num_entries, uint64_t *data) {
-    const auto eng_kind = stream->engine()->kind();
-    if (eng_kind != engine_kind::gpu) {
-        VERROR(common, common, "CPU engine does not support profiling");
+    if (!is_profiling_supported(stream)) {
+        VERROR(common, common, "engine does not support profiling");
         return status::unimplemented;
     }
     return stream->get_profiling_data(data_kind, num_entries, data);
 }
 
+INTERNAL_API_ATTRIBUTE(status_t)
+dnnl_query_profiling_impl_names(
+        stream_t *stream, int *num_entries, const char **names) {
+    if (!is_profiling_supported(stream)) {
+        VERROR(common, common, "engine does not support profiling");
+        return status::unimplemented;
+    }
+    return stream->get_profiling_impl_names(num_entries, names);
+}
+
 extern "C" status_t DNNL_API dnnl_impl_notify_profiling_complete(
         stream_t *stream) {
-    const auto eng_kind = stream->engine()->kind();
-    if (eng_kind != engine_kind::gpu) {
-        VERROR(common, common, "CPU engine does not support profiling");
+    if (!is_profiling_supported(stream)) {
+        VERROR(common, common, "engine does not support profiling");
         return status::unimplemented;
     }
     return stream->notify_profiling_complete();
@@ -0,0 +1,123 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "topk_pd.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+#define VCHECK_TOPK(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, topk, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_TOPK_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(primitive, create, check, topk, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+
+status_t topk_desc_init(topk_desc_t *topk_desc, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *dst_indices_desc,
+        int axis) {
+    VCHECK_TOPK(!any_null(src_desc, dst_desc, dst_indices_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_TOPK(src_desc->format_kind == format_kind::blocked,
+            VERBOSE_UNSUPPORTED_TAG_S, "src");
+    VCHECK_TOPK(one_of(dst_desc->format_kind, format_kind::blocked,
+                        format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+    VCHECK_TOPK(one_of(dst_indices_desc->format_kind, format_kind::blocked,
+                        format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst_indices");
+    VCHECK_TOPK(dst_indices_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "dst_indices");
+
+    const int ndims = src_desc->ndims;
+    VCHECK_TOPK(ndims > 0, VERBOSE_BAD_NDIMS, "src", ndims);
+    VCHECK_TOPK(ndims == dst_desc->ndims, VERBOSE_INCONSISTENT_NDIMS, "src",
+            "dst");
+    VCHECK_TOPK(ndims == dst_indices_desc->ndims, VERBOSE_INCONSISTENT_NDIMS,
+            "src", "dst_indices");
+    VCHECK_TOPK(0 <= axis && axis < ndims, VERBOSE_BAD_AXIS);
+
+    for (int d = 0; d < ndims; ++d) {
+        VCHECK_TOPK(dst_desc->dims[d] == dst_indices_desc->dims[d],
+                VERBOSE_INCONSISTENT_DIM, "dst", d, "dst_indices", d);
+        if (d == axis) continue;
+        VCHECK_TOPK(src_desc->dims[d] == dst_desc->dims[d],
+                VERBOSE_INCONSISTENT_DIM, "src", d, "dst", d);
+    }
+    // At least one value is selected, and not more than there are.
+    const dim_t k = dst_desc->dims[axis];
+    VCHECK_TOPK(1 <= k && k <= src_desc->dims[axis], VERBOSE_INCONSISTENT_DIM,
+            "src", axis, "dst", axis);
+    // Indices are stored as s32.
+    VCHECK_TOPK(src_desc->dims[axis] <= INT32_MAX, VERBOSE_BAD_DIM, "src",
+            axis);
+
+    VCHECK_TOPK(src_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG, "src");
+    VCHECK_TOPK(IMPLICATION(dst_desc->format_kind == format_kind::blocked,
+                        dst_desc->extra.flags == 0),
+            VERBOSE_UNSUPPORTED_MD_FLAG, "dst");
+    VCHECK_TOPK(
+            IMPLICATION(dst_indices_desc->format_kind == format_kind::blocked,
+                    dst_indices_desc->extra.flags == 0),
+            VERBOSE_UNSUPPORTED_MD_FLAG, "dst_indices");
+
+    const bool runtime_dims_or_strides
+            = memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(dst_desc).has_runtime_dims_or_strides()
+            || memory_desc_wrapper(dst_indices_desc)
+                       .has_runtime_dims_or_strides();
+    VCHECK_TOPK_UNIMPL(
+            !runtime_dims_or_strides, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+
+    auto td = topk_desc_t();
+    td.primitive_kind = primitive_kind::topk;
+    td.src_desc = *src_desc;
+    td.dst_desc = *dst_desc;
+    td.dst_indices_desc = *dst_indices_desc;
+    td.axis = axis;
+
+    *topk_desc = td;
+    return success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_topk_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *dst_indices_desc, int axis,
+        const primitive_attr_t *attr) {
+    auto topk_desc = topk_desc_t();
+    CHECK(topk_desc_init(
+            &topk_desc, src_desc, dst_desc, dst_indices_desc, axis));
+    VCHECK_TOPK_UNIMPL(attr == nullptr || attr->has_default_values(),
+            VERBOSE_UNSUPPORTED_ATTR);
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&topk_desc, nullptr, attr);
+}
@@ -0,0 +1,131 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TOPK_PD_HPP
+#define COMMON_TOPK_PD_HPP
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_TOPK(cond, msg, ...) \
+    VCONDCHECK(primitive, create, dispatch, topk, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t topk_desc_init(topk_desc_t *topk_desc, const memory_desc_t *src_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *dst_indices_desc,
+        int axis);
+
+struct topk_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::topk;
+
+    typedef topk_pd_t hint_class;
+
+    const topk_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::axis_s32: *(int *)result = axis(); break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return arg_usage_t::input;
+            case DNNL_ARG_DST:
+            case DNNL_ARG_DST_INDICES: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_DST_INDICES: return dst_md(1, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
+        return &glob_zero_md;
+    }
+    // Index 0 is the values, index 1 is the indices.
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        if (index == 1)
+            return user_input ? &desc()->dst_indices_desc : &dst_indices_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 1; }
+    int n_outputs() const override { return 2; }
+
+    int axis() const { return desc_.axis; }
+    // The number of selected values.
+    dim_t k() const { return desc_.dst_desc.dims[axis()]; }
+    dim_t axis_size() const { return desc_.src_desc.dims[axis()]; }
+    // The number of independent selections.
+    dim_t nrows() const {
+        return memory_desc_wrapper(desc_.src_desc).nelems() / axis_size();
+    }
+
+protected:
+    topk_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t dst_md_;
+    memory_desc_t dst_indices_md_;
+
+    topk_pd_t(const topk_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , src_md_(desc_.src_desc)
+        , dst_md_(desc_.dst_desc)
+        , dst_indices_md_(desc_.dst_indices_desc) {}
+
+    // Destination tensors with `any` format follow the layout of the source.
+    status_t set_default_params() {
+        if (src_md_.format_kind != format_kind::blocked)
+            return status::unimplemented;
+        if (dst_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_blocking_desc(
+                    dst_md_, src_md_.format_desc.blocking));
+        if (dst_indices_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_blocking_desc(
+                    dst_indices_md_, src_md_.format_desc.blocking));
+        return status::success;
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,226 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/trace.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace trace {
+
+namespace {
+
+struct event_t {
+    category_t cat;
+    std::string name;
+    std::string info;
+    double start_us;
+    double dur_us;
+};
+
+// Bounds the memory taken by the events of a long running process: once a
+// thread has recorded this many events, its later events are dropped and
+// only counted.
+constexpr size_t max_events_per_thread = 1 << 20;
+
+// Events of a single thread. Only the owning thread appends events, the
+// mutex protects them from a concurrent dump.
+struct thread_buffer_t {
+    thread_buffer_t(int tid) : tid(tid) {}
+
+    const int tid;
+    std::mutex mutex;
+    std::vector<event_t> events;
+    size_t n_dropped = 0;
+    // Names of the events open on the thread.
+    std::vector<std::string> names;
+};
+
+struct registry_t {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<thread_buffer_t>> buffers;
+};
+
+// The registry is never destroyed: threads of the runtime may still record
+// events when static objects are destroyed at exit.
+registry_t &registry() {
+    static registry_t *r = new registry_t();
+    return *r;
+}
+
+thread_buffer_t &thread_buffer() {
+    thread_local thread_buffer_t *buf = nullptr;
+    if (!buf) {
+        auto &r = registry();
+        std::lock_guard<std::mutex> guard(r.mutex);
+        r.buffers.emplace_back(new thread_buffer_t((int)r.buffers.size()));
+        buf = r.buffers.back().get();
+    }
+    return *buf;
+}
+
+double now_us() {
+    using namespace std::chrono;
+    static const auto origin = steady_clock::now();
+    return duration<double, std::micro>(steady_clock::now() - origin).count();
+}
+
+#if defined(DNNL_ENABLE_TRACE)
+const std::string &trace_file() {
+    // Paths are case sensitive, so getenv_string_user() is not used.
+    static const std::string file = []() {
+        const int len = 4096;
+        char buf[len];
+        return getenv("ONEDNN_TRACE_FILE", buf, len) > 0 ? std::string(buf)
+                                                         : std::string();
+    }();
+    return file;
+}
+
+void dump_at_exit() {
+    dump(trace_file().c_str());
+}
+#endif
+
+const char *category2str(category_t cat) {
+    switch (cat) {
+        case category_t::primitive: return "primitive";
+        case category_t::reorder: return "reorder";
+        case category_t::parallel: return "parallel";
+        case category_t::const_cache: return "const_cache";
+        case category_t::partition: return "partition";
+    }
+    return "unknown";
+}
+
+void write_json_string(FILE *fp, const std::string &s) {
+    fputc('"', fp);
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            fprintf(fp, "\\%c", c);
+        else if ((unsigned char)c < 0x20)
+            fprintf(fp, "\\u%04x", (unsigned)c);
+        else
+            fputc(c, fp);
+    }
+    fputc('"', fp);
+}
+
+} // namespace
+
+bool is_enabled() {
+#if defined(DNNL_ENABLE_TRACE)
+    static const bool enabled = []() {
+        if (trace_file().empty()) return false;
+        now_us(); // sets the time origin
+        std::atexit(dump_at_exit);
+        return true;
+    }();
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+std::string current_name() {
+    if (!is_enabled()) return std::string();
+    const auto &names = thread_buffer().names;
+    return names.empty() ? std::string() : names.back();
+}
+
+void scope_t::start(
+        category_t cat, const std::string &name, const char *info) {
+    if (started_ || !is_enabled()) return;
+    started_ = true;
+    cat_ = cat;
+    if (info) info_ = info;
+    thread_buffer().names.push_back(name);
+    start_us_ = now_us();
+}
+
+scope_t::~scope_t() {
+    if (!started_) return;
+    const double end_us = now_us();
+    auto &buf = thread_buffer();
+    std::lock_guard<std::mutex> guard(buf.mutex);
+    if (buf.events.size() < max_events_per_thread)
+        buf.events.push_back({cat_, std::move(buf.names.back()),
+                std::move(info_), start_us_, end_us - start_us_});
+    else
+        buf.n_dropped++;
+    buf.names.pop_back();
+}
+
+status_t dump(const char *path) {
+    if (!path || !*path) return status::invalid_arguments;
+    FILE *fp = fopen(path, "w");
+    if (!fp) return status::runtime_error;
+
+    fprintf(fp, "{\"traceEvents\":[");
+    bool first = true;
+    auto &r = registry();
+    std::lock_guard<std::mutex> guard(r.mutex);
+    for (const auto &buf : r.buffers) {
+        std::lock_guard<std::mutex> buf_guard(buf->mutex);
+        fprintf(fp,
+                "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                "\"tid\":%d,\"args\":{\"name\":\"thread %d\"",
+                first ? "" : ",", buf->tid, buf->tid);
+        if (buf->n_dropped)
+            fprintf(fp, ",\"dropped_events\":%zu", buf->n_dropped);
+        fprintf(fp, "}}");
+        first = false;
+        for (const auto &e : buf->events) {
+            fprintf(fp, ",\n{\"name\":");
+            write_json_string(fp, e.name);
+            fprintf(fp,
+                    ",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                    "\"pid\":0,\"tid\":%d",
+                    category2str(e.cat), e.start_us, e.dur_us, buf->tid);
+            if (!e.info.empty()) {
+                fprintf(fp, ",\"args\":{\"info\":");
+                write_json_string(fp, e.info);
+                fprintf(fp, "}");
+            }
+            fprintf(fp, "}");
+        }
+    }
+    fprintf(fp, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    return fclose(fp) == 0 ? status::success : status::runtime_error;
+}
+
+} // namespace trace
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_dump_trace(const char *path) {
+#if defined(DNNL_ENABLE_TRACE)
+    return dnnl::impl::trace::dump(path);
+#else
+    UNUSED(path);
+    return dnnl::impl::status::unimplemented;
+#endif
+}
@@ -0,0 +1,79 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_TRACE_HPP
+#define COMMON_TRACE_HPP
+
+#include <string>
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+// Execution timeline tracer. When the ONEDNN_TRACE_FILE environment variable
+// is set, the library records when each primitive execution, parallel region
+// task, constant cache fill and graph partition execution starts and ends on
+// every thread. The events are written in the Chrome trace event format at
+// exit or on a dnnl_dump_trace() call.
+namespace dnnl {
+namespace impl {
+namespace trace {
+
+enum class category_t {
+    primitive,
+    reorder,
+    parallel,
+    const_cache,
+    partition,
+};
+
+// Returns `true` if ONEDNN_TRACE_FILE is set.
+bool DNNL_API is_enabled();
+
+// Returns the name of the innermost event open on the calling thread or an
+// empty string. Used to label the work of the threads of a parallel region.
+std::string DNNL_API current_name();
+
+// Records an event lasting from start() to the destruction of the object on
+// the calling thread. Nothing is recorded if start() is not called.
+struct scope_t {
+    scope_t() = default;
+    scope_t(category_t cat, const std::string &name,
+            const char *info = nullptr) {
+        start(cat, name, info);
+    }
+    DNNL_API ~scope_t();
+
+    // @p info is an optional string stored in the event arguments.
+    void DNNL_API start(category_t cat, const std::string &name,
+            const char *info = nullptr);
+
+private:
+    bool started_ = false;
+    category_t cat_ = category_t::primitive;
+    std::string info_;
+    double start_us_ = 0;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scope_t);
+};
+
+// Writes the events recorded so far to @p path.
+status_t dump(const char *path);
+
+} // namespace trace
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -93,6 +93,11 @@ inline size_t data_type_size(data_type_t data_type) {
         case s32: return sizeof(prec_traits<s32>::type);
         case s8: return sizeof(prec_traits<s8>::type);
         case u8: return sizeof(prec_traits<u8>::type);
+        // 4-bit types occupy a whole byte when stored individually. Packed
+        // tensors take half of it per element, see
+        // memory_desc_wrapper::sub_byte_data_type_multiplier().
+        case s4: return sizeof(prec_traits<s4>::type);
+        case u4: return sizeof(prec_traits<u4>::type);
         case boolean: return sizeof(prec_traits<boolean>::type);
         case data_type::undef:
         default: assert(!"unknown data_type");
@@ -313,6 +318,9 @@ inline data_type_t default_accum_data_type(data_type_t src_dt,
     if (one_of(prop_kind, forward_training, forward_inference)) {
         if ((src_dt == u8 || src_dt == s8) && wei_dt == s8) return s32;
         if (one_of(f16, src_dt, wei_dt)) return f32;
+        // Weights decompression.
+        if (one_of(src_dt, f32, bf16) && one_of(wei_dt, s8, u8, s4, u4))
+            return f32;
     } else if (prop_kind == backward_data) {
         if (one_of(src_dt, f32, s32, s8, u8) && wei_dt == s8
                 && one_of(dst_dt, s8, u8, s32))
@@ -332,7 +340,7 @@ inline data_type_t default_accum_data_type(data_type_t src_dt,
 
 inline bool is_integral_dt(data_type_t dt) {
     using namespace data_type;
-    return utils::one_of(dt, s32, s8, u8);
+    return utils::one_of(dt, s32, s8, u8, s4, u4);
 }
 
 template <typename data_t>
@@ -730,6 +738,26 @@ inline bool operator==(
      return ret;
 }
 
+inline bool operator==(const topk_desc_t &lhs, const topk_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(dst_indices_desc)
+            && COMPARE_DESC_MEMBERS(axis);
+    return ret;
+}
+
+inline bool operator==(
+        const embedding_bag_desc_t &lhs, const embedding_bag_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(offsets_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc);
+    return ret;
+}
+
 inline bool operator==(const sum_desc_t &lhs, const sum_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && DEREF_AND_COMPARE_DESC_MEMBERS(dst_md)
@@ -750,6 +778,34 @@ inline bool operator==(const sum_desc_t &lhs, const sum_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(q_desc)
+            && COMPARE_DESC_MEMBERS(k_desc)
+            && COMPARE_DESC_MEMBERS(v_desc)
+            && COMPARE_DESC_MEMBERS(attn_mask_desc)
+            && COMPARE_DESC_MEMBERS(scale_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(invert_scale)
+            && COMPARE_DESC_MEMBERS(mask_type)
+            && COMPARE_FLOAT_DESC_MEMBERS(q_quant.scale)
+            && COMPARE_DESC_MEMBERS(q_quant.zero_point)
+            && COMPARE_FLOAT_DESC_MEMBERS(k_quant.scale)
+            && COMPARE_DESC_MEMBERS(k_quant.zero_point)
+            && COMPARE_FLOAT_DESC_MEMBERS(v_quant.scale)
+            && COMPARE_DESC_MEMBERS(v_quant.zero_point)
+            && COMPARE_FLOAT_DESC_MEMBERS(dst_quant.scale)
+            && COMPARE_DESC_MEMBERS(dst_quant.zero_point)
+            && COMPARE_DESC_MEMBERS(probs_dt)
+            && COMPARE_FLOAT_DESC_MEMBERS(probs_quant.scale)
+            && COMPARE_DESC_MEMBERS(probs_quant.zero_point)
+            && COMPARE_FLOAT_DESC_MEMBERS(probs_dequant.scale)
+            && COMPARE_DESC_MEMBERS(probs_dequant.zero_point)
+            && COMPARE_DESC_MEMBERS(kv_block_table_desc)
+            && COMPARE_DESC_MEMBERS(kv_keys);
+    return ret;
+}
+
 inline bool operator==(const zero_pad_desc_t &lhs, const zero_pad_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind);
     return ret;
@@ -1023,7 +1079,7 @@ inline bool memory_desc_sanity_check(int ndims, const dims_t dims,
 
     bool ok = dims != nullptr && 0 < ndims && ndims <= DNNL_MAX_NDIMS
             && utils::one_of(data_type, f8_e5m2, f8_e4m3, f16, bf16, f32, f64,
-                    s32, s8, u8);
+                    s32, s8, u8, s4, u4);
     if (!ok) return false;
 
     bool has_runtime_dims = false;
@@ -1068,9 +1124,12 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
         CASE_OP_DESC(rnn);
         CASE_OP_DESC(shuffle);
         CASE_OP_DESC(softmax);
+        CASE_OP_DESC(topk);
+        CASE_OP_DESC(embedding_bag);
 
         // Internal descs
         CASE_OP_DESC(zero_pad);
+        CASE_OP_DESC(sdpa);
         default: assert(!"unknown C primitive kind");
     }
 #undef CASE_OP_DESC
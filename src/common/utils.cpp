@@ -187,6 +187,15 @@ bool get_jit_dump() {
     return jit_dump.get();
 }
 
+static setting_t<bool> cpu_hugepages {false};
+bool get_cpu_hugepages() {
+    if (!cpu_hugepages.initialized()) {
+        static bool val = getenv_int_user("CPU_HUGEPAGES", cpu_hugepages.get());
+        cpu_hugepages.set(val);
+    }
+    return cpu_hugepages.get();
+}
+
 #if defined(DNNL_AARCH64) && (DNNL_AARCH64 == 1)
 static setting_t<unsigned> jit_profiling_flags {DNNL_JIT_PROFILE_LINUX_PERFMAP};
 #else
@@ -246,9 +255,43 @@ std::string get_jit_profiling_jitdumpdir() {
     return jitdumpdir;
 }
 
+static setting_t<std::string> jit_cache_dir;
+std::string get_jit_cache_dir() {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (!jit_cache_dir.initialized()) {
+        // Paths are case sensitive, so getenv_string_user() is not used.
+        const int len = 4096;
+        char buf[len];
+        static std::string val
+                = getenv("ONEDNN_JIT_CACHE_DIR", buf, len) > 0 ? buf : "";
+        jit_cache_dir.set(val);
+    }
+    return jit_cache_dir.get();
+#else
+    return std::string();
+#endif
+}
+
+static thread_local double jit_generation_time_ms = 0;
+void add_jit_generation_time(double ms) {
+    jit_generation_time_ms += ms;
+}
+
+double get_jit_generation_time() {
+    return jit_generation_time_ms;
+}
+
 } // namespace impl
 } // namespace dnnl
 
+extern "C" dnnl_status_t DNNL_API dnnl_impl_get_jit_generation_time(
+        double *ms) {
+    using namespace dnnl::impl;
+    if (!ms) return status::invalid_arguments;
+    *ms = get_jit_generation_time();
+    return status::success;
+}
+
 dnnl_status_t dnnl_set_jit_dump(int enabled) {
     using namespace dnnl::impl;
     jit_dump.set(enabled);
@@ -311,6 +354,17 @@ dnnl_cpu_isa_hints_t dnnl_get_cpu_isa_hints() {
     return isa_hint;
 }
 
+dnnl_status_t dnnl_set_cpu_hugepages(int enable) {
+    using namespace dnnl::impl;
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    cpu_hugepages.set(enable);
+    return status::success;
+#else
+    UNUSED(enable);
+    return status::unimplemented;
+#endif
+}
+
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
 #include "oneapi/dnnl/dnnl_threadpool_iface.hpp"
 namespace dnnl {
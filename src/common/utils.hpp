@@ -646,8 +646,17 @@ std::string getenv_string_user(const char *name);
 
 // Various getter for profiling info
 bool get_jit_dump();
+// Returns `true` if large CPU buffers use huge pages and first-touch placement.
+bool get_cpu_hugepages();
 unsigned get_jit_profiling_flags();
 std::string get_jit_profiling_jitdumpdir();
+// Returns the directory of the persistent JIT cache or an empty string if the
+// cache is disabled.
+std::string get_jit_cache_dir();
+// Accumulates the time in milliseconds the calling thread spends generating
+// JIT code. Lets benchdnn split the primitive creation time.
+void add_jit_generation_time(double ms);
+double get_jit_generation_time();
 FILE *fopen(const char *filename, const char *mode);
 int getpagesize();
 
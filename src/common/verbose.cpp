@@ -40,6 +40,7 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "embedding_bag_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
@@ -52,9 +53,11 @@
 #include "reorder_pd.hpp"
 #include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
+#include "sdpa_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
+#include "topk_pd.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "common/dnnl_thread.hpp"
@@ -81,17 +84,17 @@ static setting_t<uint32_t> verbose {0};
 void print_header(const filter_status_t &filter_status) {
     static std::atomic_flag version_printed = ATOMIC_FLAG_INIT;
     if (!version_printed.test_and_set()) {
-        printf("onednn_verbose,info,oneDNN v%d.%d.%d (commit %s)\n",
+        verbose_printf("onednn_verbose,info,oneDNN v%d.%d.%d (commit %s)\n",
                 dnnl_version()->major, dnnl_version()->minor,
                 dnnl_version()->patch, dnnl_version()->hash);
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
-        printf("onednn_verbose,info,cpu,runtime:%s,nthr:%d\n",
+        verbose_printf("onednn_verbose,info,cpu,runtime:%s,nthr:%d\n",
                 dnnl_runtime2str(dnnl_version()->cpu_runtime),
                 dnnl_get_max_threads());
-        printf("onednn_verbose,info,cpu,isa:%s\n",
+        verbose_printf("onednn_verbose,info,cpu,isa:%s\n",
                 cpu::platform::get_isa_info());
 #endif
-        printf("onednn_verbose,info,gpu,runtime:%s\n",
+        verbose_printf("onednn_verbose,info,gpu,runtime:%s\n",
                 dnnl_runtime2str(dnnl_version()->gpu_runtime));
 #if DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL
         gpu::ocl::print_verbose_header();
@@ -103,38 +106,39 @@ void print_header(const filter_status_t &filter_status) {
         graph::utils::print_verbose_header();
 #endif
 #ifdef DNNL_EXPERIMENTAL
-        printf("onednn_verbose,info,experimental features are enabled\n");
-        printf("onednn_verbose,info,use batch_normalization stats one pass is "
-               "%s\n",
+        verbose_printf(
+                "onednn_verbose,info,experimental features are enabled\n");
+        verbose_printf("onednn_verbose,info,use batch_normalization stats one "
+                       "pass is %s\n",
                 experimental::use_bnorm_stats_one_pass() ? "enabled"
                                                          : "disabled");
 #endif
 
 #ifdef DNNL_EXPERIMENTAL_SPARSE
-        printf("onednn_verbose,info,experimental functionality for sparse "
-               "domain is enabled\n");
+        verbose_printf("onednn_verbose,info,experimental functionality for "
+                       "sparse domain is enabled\n");
 #endif
 
-        printf("onednn_verbose,primitive,info,template:");
-        printf("%soperation,engine,primitive,implementation,prop_"
-               "kind,memory_descriptors,attributes,auxiliary,problem_desc,exec_"
-               "time\n",
+        verbose_printf("onednn_verbose,primitive,info,template:%soperation,"
+                       "engine,primitive,implementation,prop_kind,memory_"
+                       "descriptors,attributes,auxiliary,problem_desc,exec_"
+                       "time\n",
                 get_verbose_timestamp() ? "timestamp," : "");
 
 #ifdef ONEDNN_BUILD_GRAPH
-        printf("onednn_verbose,graph,info,template:");
-        printf("%soperation,engine,partition_id,partition_kind,op_names,"
-               "data_formats,logical_tensors,fpmath_mode,backend,exec_"
-               "time\n",
+        verbose_printf("onednn_verbose,graph,info,template:%soperation,"
+                       "engine,partition_id,partition_kind,op_names,data_"
+                       "formats,logical_tensors,fpmath_mode,backend,exec_"
+                       "time\n",
                 get_verbose_timestamp() ? "timestamp," : "");
 #endif
         if (filter_status.status == filter_status_t::flags::valid)
-            printf("onednn_verbose,common,info,filter format is enabled, "
-                   "hit components: %s\n",
+            verbose_printf("onednn_verbose,common,info,filter format is "
+                           "enabled, hit components: %s\n",
                     filter_status.components.c_str());
         else if (filter_status.status == filter_status_t::flags::invalid)
-            printf("onednn_verbose,common,error,filter format is ill-formed "
-                   "and is not applied, error: %s\n",
+            verbose_printf("onednn_verbose,common,error,filter format is "
+                           "ill-formed and is not applied, error: %s\n",
                     filter_status.err_msg.c_str());
     }
 }
@@ -217,6 +221,9 @@ uint32_t get_verbose(verbose_t::flag_kind verbosity_kind,
             REGEX_SEARCH(k, group_normalization, regexp, filter_status);
             REGEX_SEARCH(k, graph, regexp, filter_status);
             REGEX_SEARCH(k, gemm_api, regexp, filter_status);
+            REGEX_SEARCH(k, topk, regexp, filter_status);
+            REGEX_SEARCH(k, embedding_bag, regexp, filter_status);
+            REGEX_SEARCH(k, sdpa, regexp, filter_status);
 
             // filter enabled and at least one component is hit
             if (filter_status.components.length() != 0) {
@@ -271,6 +278,14 @@ bool get_verbose_timestamp() {
 #endif
 }
 
+const char *prim_kind2str(primitive_kind_t prim_kind) {
+    switch ((int)prim_kind) {
+        case primitive_kind::zero_pad: return "zero_pad";
+        case primitive_kind::sdpa: return "sdpa";
+        default: return dnnl_prim_kind2str(prim_kind);
+    }
+}
+
 #if defined(DISABLE_VERBOSE)
 void pd_info_t::init(
         dnnl::impl::engine_t *, const dnnl::impl::primitive_desc_t *) {}
@@ -289,13 +304,6 @@ std::ostream &operator<<(std::ostream &ss, const engine_t *engine) {
     return ss;
 }
 
-const char *prim_kind2str(primitive_kind_t prim_kind) {
-    switch ((int)prim_kind) {
-        case primitive_kind::zero_pad: return "zero_pad";
-        default: return dnnl_prim_kind2str(prim_kind);
-    }
-}
-
 std::ostream &operator<<(std::ostream &ss, primitive_kind_t prim_kind) {
     ss << prim_kind2str(prim_kind);
     return ss;
@@ -335,6 +343,7 @@ std::string normalization_flags2str(unsigned flags) {
     if (flags & normalization_flags::use_shift) s += "H";
     if (flags & normalization_flags::fuse_norm_relu) s += "R";
     if (flags & normalization_flags::fuse_norm_add_relu) s += "A";
+    if (flags & normalization_flags::rms_norm) s += "M";
     return s;
 }
 
@@ -530,6 +539,12 @@ std::string md2desc_str(const memory_desc_t *md) {
 
 std::ostream &operator<<(std::ostream &ss, const runtime_scales_t &oscale) {
     ss << oscale.mask_;
+    if (!oscale.has_default_data_type()) ss << ":" << oscale.data_type_;
+    if (!oscale.has_default_groups()) {
+        ss << ":";
+        for (int d = 0; d < oscale.ndims_; ++d)
+            ss << (d ? "x" : "") << oscale.group_dims_[d];
+    }
     return ss;
 }
 
@@ -640,6 +655,14 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
             zp.get(arg, &mask);
 
             ss << delim << arg2str(arg) << ":" << mask;
+            if (!zp.has_default_data_type(arg))
+                ss << ":" << zp.get_data_type(arg);
+            if (!zp.has_default_groups(arg)) {
+                const dim_t *groups = zp.get_groups(arg);
+                ss << ":";
+                for (int d = 0; d < zp.get_groups_ndims(arg); ++d)
+                    ss << (d ? "x" : "") << groups[d];
+            }
             delim = attr_delim;
         }
         ss << " ";
@@ -1271,6 +1294,41 @@ std::string init_info_rnn(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    ss << "q_" << pd->src_md(0);
+    ss << " k_" << pd->src_md(1);
+    ss << " v_" << pd->src_md(2);
+    if (pd->with_attn_mask()) ss << " msk_" << pd->src_md(3);
+    if (pd->with_paged_kv()) ss << " bt_" << pd->src_md(5);
+    ss << " dst_" << pd->dst_md();
+
+    const auto *desc = pd->desc();
+    ss << "," << pd->attr() << ",";
+    const char *mask_str = "none";
+    switch (desc->mask_type) {
+        case attn_mask_type::buffer: mask_str = "buffer"; break;
+        case attn_mask_type::top_left: mask_str = "causal_tl"; break;
+        case attn_mask_type::bottom_right: mask_str = "causal_br"; break;
+        default: break;
+    }
+    ss << "mask:" << mask_str;
+    if (pd->with_scale())
+        ss << " scale:" << (desc->invert_scale ? "inv" : "mul");
+    if (pd->with_probs_quantization()) ss << " probs:" << desc->probs_dt;
+    if (pd->with_paged_kv())
+        ss << " keys:" << desc->keys() << " page:" << desc->kv_page_size();
+    ss << ",";
+    ss << md2dim_str(pd->src_md(0)) << ":" << md2dim_str(pd->src_md(1)) << ":"
+       << md2dim_str(pd->src_md(2));
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_shuffle(const engine_t *e, const pd_t *pd) {
     std::stringstream ss;
@@ -1309,6 +1367,55 @@ std::string init_info_softmax(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_topk(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto dst_md = pd->invariant_dst_md();
+    auto dst_indices_md = pd->dst_md(1);
+
+    ss << "src_" << md2fmt_str(src_md, pd->invariant_src_user_format_kind());
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+    ss << " dst_indices_"
+       << md2fmt_str(dst_indices_md,
+                  pd->invariant_dst_user_format_kind(DNNL_ARG_DST_INDICES));
+
+    ss << "," << pd->attr() << ",";
+    ss << "axis:" << pd->axis() << " k:" << pd->k() << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(dst_md);
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_embedding_bag(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto indices_md = pd->src_md(1);
+    auto offsets_md = pd->src_md(2);
+    auto dst_md = pd->invariant_dst_md();
+
+    ss << "src_" << md2fmt_str(src_md, pd->invariant_src_user_format_kind());
+    ss << " indices_"
+       << md2fmt_str(indices_md, pd->invariant_src_user_format_kind(1));
+    ss << " offsets_"
+       << md2fmt_str(offsets_md, pd->invariant_src_user_format_kind(2));
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->alg_kind() << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(indices_md) << ":"
+       << md2dim_str(dst_md);
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_sum(const engine_t *e, const pd_t *pd) {
     std::stringstream ss;
@@ -1365,7 +1472,11 @@ std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::sum:
+        case primitive_kind::topk:
+        case primitive_kind::embedding_bag:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1397,7 +1508,11 @@ std::string rt_dims2fmt_str(primitive_kind_t prim_kind,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::sum:
+        case primitive_kind::topk:
+        case primitive_kind::embedding_bag:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1432,9 +1547,12 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(reorder);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
             CASE(sum);
+            CASE(topk);
+            CASE(embedding_bag);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
               break;
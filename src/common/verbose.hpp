@@ -73,8 +73,9 @@ struct const_expr_value {
         std::string stamp_; \
         if (dnnl::impl::get_verbose_timestamp()) \
             stamp_ = "," + std::to_string(stamp); \
-        printf("onednn_verbose%s," CONCAT2(VERBOSE_, apitype) "," CONCAT2( \
-                       VERBOSE_, logtype) "%s," msg "\n", \
+        dnnl::impl::verbose_printf( \
+                "onednn_verbose%s," CONCAT2(VERBOSE_, apitype) "," CONCAT2( \
+                        VERBOSE_, logtype) "%s," msg "\n", \
                 stamp_.c_str(), logsubtype, ##__VA_ARGS__); \
     } while (0)
 
@@ -113,7 +114,7 @@ struct const_expr_value {
             VFORMAT(get_msec(), apitype, error, "", #component "," msg, \
                     ##__VA_ARGS__); \
         } \
-        fflush(stdout); \
+        dnnl::impl::verbose_flush(); \
     } while (0)
 
 // Special syntactic sugar for logging performance
@@ -123,7 +124,7 @@ struct const_expr_value {
 #define VPROF(stamp, apitype, logtype, logsubtype, info, duration) \
     { \
         VFORMAT(stamp, apitype, logtype, logsubtype, "%s,%g", info, duration); \
-        fflush(stdout); \
+        dnnl::impl::verbose_flush(); \
     }
 
 struct verbose_t {
@@ -177,6 +178,9 @@ struct component_t {
         group_normalization = 1 << 21,
         graph = 1 << 22,
         gemm_api = 1 << 23,
+        topk = 1 << 24,
+        embedding_bag = 1 << 25,
+        sdpa = 1 << 26,
         all = (uint32_t)-1,
     };
 };
@@ -196,9 +200,28 @@ struct filter_status_t {
 
 inline component_t::flag_kind prim_kind2_comp_kind(
         const primitive_kind_t prim_kind) {
-    return static_cast<component_t::flag_kind>(1 << prim_kind | 1 << 0);
+    // The flags of primitive kinds added after the `graph` and `gemm_api`
+    // components and of the internal primitive kinds no longer match the
+    // primitive kind values.
+    uint32_t flag = component_t::none;
+    switch ((int)prim_kind) {
+        case primitive_kind::topk: flag = component_t::topk; break;
+        case primitive_kind::embedding_bag:
+            flag = component_t::embedding_bag;
+            break;
+        case primitive_kind::sdpa: flag = component_t::sdpa; break;
+        case primitive_kind::zero_pad: break;
+        default:
+            if (prim_kind > 0
+                    && prim_kind <= primitive_kind::group_normalization)
+                flag = 1u << prim_kind;
+            break;
+    }
+    return static_cast<component_t::flag_kind>(flag | component_t::primitive);
 }
 
+const char *prim_kind2str(primitive_kind_t prim_kind);
+
 uint32_t get_verbose(verbose_t::flag_kind kind = verbose_t::none,
         component_t::flag_kind filter_kind = component_t::all);
 
@@ -210,6 +233,17 @@ static inline uint32_t get_verbose_dev_mode(
 
 bool get_verbose_timestamp();
 
+// Prints a verbose message to stdout or, if ONEDNN_VERBOSE_OUTPUT is set,
+// records it in a buffer of the calling thread. The buffers are written to the
+// file by a background thread. Each call must print whole lines.
+#if defined(__GNUC__)
+__attribute__((format(printf, 1, 2)))
+#endif
+void verbose_printf(const char *fmt, ...);
+
+// Flushes stdout when the messages are not written to a file.
+void verbose_flush();
+
 /// A container for primitive desc verbose string.
 struct primitive_desc_t;
 struct pd_info_t {
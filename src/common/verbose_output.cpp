@@ -0,0 +1,286 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+
+// Asynchronous verbose output. When ONEDNN_VERBOSE_OUTPUT is set, a message is
+// formatted into a ring buffer owned by the calling thread and a background
+// thread writes the buffers to the file. A ring buffer has a single producer
+// (the owning thread) and a single consumer (the writer thread), so recording
+// a message takes no lock.
+namespace dnnl {
+namespace impl {
+
+namespace {
+
+enum class output_format_t { csv, binary };
+
+// Layout of a record in a ring buffer and of a record in the binary output.
+// The header is followed by `size` bytes of the message without the trailing
+// new line.
+struct record_header_t {
+    uint32_t size;
+    uint32_t tid;
+    double stamp_ms;
+};
+
+struct ring_buffer_t {
+    // Must be a power of 2.
+    static constexpr size_t capacity = size_t(1) << 20;
+
+    ring_buffer_t(uint32_t tid) : tid(tid), data(new char[capacity]) {}
+
+    size_t free_space() const {
+        return capacity - (head.load(std::memory_order_relaxed)
+                       - tail.load(std::memory_order_acquire));
+    }
+
+    // Copies @p size bytes starting at the byte @p pos of the stream.
+    void write(size_t pos, const void *src, size_t size) {
+        const size_t off = pos & (capacity - 1);
+        const size_t n = nstl::min(size, capacity - off);
+        std::memcpy(data.get() + off, src, n);
+        std::memcpy(data.get(), (const char *)src + n, size - n);
+    }
+
+    void read(size_t pos, void *dst, size_t size) const {
+        const size_t off = pos & (capacity - 1);
+        const size_t n = nstl::min(size, capacity - off);
+        std::memcpy(dst, data.get() + off, n);
+        std::memcpy((char *)dst + n, data.get(), size - n);
+    }
+
+    const uint32_t tid;
+    std::unique_ptr<char[]> data;
+    // Total number of bytes written and read. Only the owner advances `head`
+    // and only the writer thread advances `tail`.
+    std::atomic<size_t> head {0};
+    std::atomic<size_t> tail {0};
+    // Set while a thread owns the buffer, the buffers of finished threads are
+    // reused.
+    std::atomic<bool> owned {false};
+};
+
+struct writer_t {
+    writer_t(FILE *fp, output_format_t format) : fp(fp), format(format) {}
+
+    // Writes the records available in all the buffers. Must be called with
+    // `mutex` locked.
+    void drain() {
+        std::string msg;
+        for (auto &buf : buffers) {
+            size_t tail = buf->tail.load(std::memory_order_relaxed);
+            const size_t head = buf->head.load(std::memory_order_acquire);
+            while (tail != head) {
+                record_header_t hdr;
+                buf->read(tail, &hdr, sizeof(hdr));
+                msg.resize(hdr.size);
+                buf->read(tail + sizeof(hdr), &msg[0], hdr.size);
+                tail += sizeof(hdr) + hdr.size;
+                write(hdr, msg.data());
+            }
+            buf->tail.store(tail, std::memory_order_release);
+        }
+        fflush(fp);
+    }
+
+    void write(const record_header_t &hdr, const char *msg) {
+        if (format == output_format_t::binary)
+            fwrite(&hdr, sizeof(hdr), 1, fp);
+        fwrite(msg, 1, hdr.size, fp);
+        if (format == output_format_t::csv) fputc('\n', fp);
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!stopped) {
+            cv.wait_for(lock, std::chrono::milliseconds(100));
+            drain();
+        }
+    }
+
+    FILE *const fp;
+    const output_format_t format;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::unique_ptr<ring_buffer_t>> buffers;
+    // Set at exit, the messages are written synchronously afterwards.
+    std::atomic<bool> stopped {false};
+    std::thread thread;
+};
+
+// The writer is never destroyed: threads of the runtime may still print
+// messages when static objects are destroyed at exit.
+writer_t *writer() {
+    static writer_t *w = []() -> writer_t * {
+        // Paths are case sensitive, so getenv_string_user() is not used.
+        const int len = 4096;
+        char path[len];
+        if (getenv("ONEDNN_VERBOSE_OUTPUT", path, len) <= 0) return nullptr;
+
+        const auto format = getenv_string_user("VERBOSE_OUTPUT_FORMAT")
+                        == "binary"
+                ? output_format_t::binary
+                : output_format_t::csv;
+        FILE *fp = fopen(
+                path, format == output_format_t::binary ? "wb" : "w");
+        if (!fp) {
+            printf("onednn_verbose,common,error,cannot open verbose output "
+                   "file %s, printing to stdout\n",
+                    path);
+            return nullptr;
+        }
+
+        auto *w = new writer_t(fp, format);
+        w->thread = std::thread([w]() { w->run(); });
+        // The handler also runs when the library is unloaded, so the thread
+        // does not outlive the code it executes. On Windows the handler runs
+        // under the loader lock, which the exiting thread needs as well, so
+        // the thread is only signaled to stop there.
+        std::atexit([]() {
+            auto *w = writer();
+            {
+                std::lock_guard<std::mutex> guard(w->mutex);
+                w->stopped = true;
+            }
+            w->cv.notify_one();
+#ifdef _WIN32
+            w->thread.detach();
+#else
+            w->thread.join();
+#endif
+            std::lock_guard<std::mutex> guard(w->mutex);
+            w->drain();
+        });
+        return w;
+    }();
+    return w;
+}
+
+struct buffer_owner_t {
+    ~buffer_owner_t() {
+        if (buf) buf->owned.store(false, std::memory_order_release);
+    }
+    ring_buffer_t *buf = nullptr;
+};
+
+ring_buffer_t &thread_buffer(writer_t *w) {
+    thread_local buffer_owner_t owner;
+    if (!owner.buf) {
+        std::lock_guard<std::mutex> guard(w->mutex);
+        for (auto &buf : w->buffers) {
+            bool owned = false;
+            if (buf->owned.compare_exchange_strong(owned, true)) {
+                owner.buf = buf.get();
+                break;
+            }
+        }
+        if (!owner.buf) {
+            w->buffers.emplace_back(
+                    new ring_buffer_t((uint32_t)w->buffers.size()));
+            owner.buf = w->buffers.back().get();
+            owner.buf->owned = true;
+        }
+    }
+    return *owner.buf;
+}
+
+void record(writer_t *w, const char *msg, size_t size) {
+    // Messages longer than the buffer are truncated.
+    size = nstl::min(size, ring_buffer_t::capacity / 2);
+    auto &buf = thread_buffer(w);
+    const record_header_t hdr = {(uint32_t)size, buf.tid, get_msec()};
+    const size_t rec_size = sizeof(hdr) + size;
+
+    while (w->stopped.load(std::memory_order_relaxed)
+            || buf.free_space() < rec_size) {
+        std::lock_guard<std::mutex> guard(w->mutex);
+        if (w->stopped) {
+            w->write(hdr, msg);
+            return;
+        }
+        // The writer thread is behind, drain the buffers on the calling
+        // thread instead of dropping the message.
+        w->drain();
+    }
+
+    const size_t head = buf.head.load(std::memory_order_relaxed);
+    buf.write(head, &hdr, sizeof(hdr));
+    buf.write(head + sizeof(hdr), msg, size);
+    buf.head.store(head + rec_size, std::memory_order_release);
+
+    if (buf.free_space() < ring_buffer_t::capacity / 2) w->cv.notify_one();
+}
+
+} // namespace
+
+void verbose_printf(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    auto *w = writer();
+    if (!w) {
+        vprintf(fmt, args);
+        va_end(args);
+        return;
+    }
+
+    char stack_msg[1024];
+    va_list args_copy;
+    va_copy(args_copy, args);
+    const int len = vsnprintf(stack_msg, sizeof(stack_msg), fmt, args);
+    va_end(args);
+
+    if (len < 0) {
+        va_end(args_copy);
+        return;
+    }
+    const char *msg = stack_msg;
+    std::unique_ptr<char[]> heap_msg;
+    if ((size_t)len >= sizeof(stack_msg)) {
+        heap_msg.reset(new char[len + 1]);
+        vsnprintf(heap_msg.get(), len + 1, fmt, args_copy);
+        msg = heap_msg.get();
+    }
+    va_end(args_copy);
+
+    // The records are stored without the trailing new line, the writer
+    // thread adds it in the CSV format.
+    size_t size = (size_t)len;
+    if (size > 0 && msg[size - 1] == '\n') size--;
+    record(w, msg, size);
+}
+
+void verbose_flush() {
+    if (!writer()) fflush(stdout);
+}
+
+} // namespace impl
+} // namespace dnnl
@@ -20,6 +20,11 @@
 #include "cpu/ref_concat.hpp"
 #include "cpu/simple_concat.hpp"
 
+#if DNNL_X64
+#include "cpu/x64/jit_uni_concat.hpp"
+using namespace dnnl::impl::cpu::x64;
+#endif
+
 namespace dnnl {
 namespace impl {
 namespace cpu {
@@ -37,6 +42,7 @@ constexpr impl_list_item_t cpu_concat_impl_list[] = REG_CONCAT_P({
         INSTANCE(simple_concat_t<s32>)
         INSTANCE(simple_concat_t<bf16>)
         INSTANCE(simple_concat_t<f16>)
+        DNNL_X64_ONLY(INSTANCE(jit_uni_concat_t))
         INSTANCE(ref_concat_t)
         nullptr,
 });
@@ -58,6 +58,7 @@ DECLARE_IMPL_LIST(binary);
 DECLARE_IMPL_LIST(convolution);
 DECLARE_IMPL_LIST(deconvolution);
 DECLARE_IMPL_LIST(eltwise);
+DECLARE_IMPL_LIST(embedding_bag);
 DECLARE_IMPL_LIST(group_normalization);
 DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
@@ -68,8 +69,10 @@ DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
 DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
+DECLARE_IMPL_LIST(sdpa);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
+DECLARE_IMPL_LIST(topk);
 
 #undef DECLARE_IMPL_LIST
 
@@ -88,12 +91,13 @@ public:
 #define CASE(kind) \
     case primitive_kind::kind: \
         return get_##kind##_impl_list((const kind##_desc_t *)desc);
-        switch (desc->kind) {
+        switch ((int)desc->kind) {
             CASE(batch_normalization);
             CASE(binary);
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(embedding_bag);
             CASE(group_normalization);
             CASE(inner_product);
             CASE(layer_normalization);
@@ -104,8 +108,10 @@ public:
             CASE(reduction);
             CASE(resampling);
             CASE(rnn);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
+            CASE(topk);
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
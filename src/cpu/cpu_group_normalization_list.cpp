@@ -41,6 +41,7 @@ const std::map<pk_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map() {
             nullptr,
         }},
         {{backward}, REG_BWD_PK({
+            CPU_INSTANCE_X64(jit_uni_group_normalization_bwd_t)
             CPU_INSTANCE(ref_group_normalization_bwd_t)
             nullptr,
         })},
@@ -0,0 +1,68 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_memory_storage.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t cpu_memory_storage_t::init_allocate(size_t size) {
+    size_t alignment = platform::get_cache_line_size();
+    if (engine()->has_host_allocator()) {
+        void *ptr = engine()->host_allocate()(size, alignment);
+        if (!ptr) return status::out_of_memory;
+        data_ = decltype(data_)(ptr, engine()->host_deallocate());
+        return status::success;
+    }
+
+    const bool use_hugepages = get_cpu_hugepages() && size >= PAGE_2M;
+    if (use_hugepages) alignment = PAGE_2M;
+
+    void *ptr = malloc(size, (int)alignment);
+    if (!ptr) return status::out_of_memory;
+    data_ = decltype(data_)(ptr, destroy);
+
+    if (use_hugepages) {
+        platform::advise_hugepages(ptr, size);
+        first_touch(ptr, size);
+    }
+    return status::success;
+}
+
+void cpu_memory_storage_t::first_touch(void *ptr, size_t size) {
+    // Primitives split their work statically between the threads, so the
+    // buffer is split into contiguous chunks in the same way. A huge page is
+    // placed at its first access, hence the chunks are multiples of it.
+    const dim_t nchunks = utils::div_up(size, PAGE_2M);
+    parallel(0, [&](int ithr, int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(nchunks, nthr, ithr, start, end);
+        char *beg = (char *)ptr + start * PAGE_2M;
+        const char *lim = (char *)ptr + nstl::min(size, (size_t)end * PAGE_2M);
+        // Every small page is touched in case huge pages are not available.
+        for (char *p = beg; p < lim; p += PAGE_4K)
+            *(volatile char *)p = 0;
+    });
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
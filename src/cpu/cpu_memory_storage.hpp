@@ -85,12 +85,7 @@ public:
     }
 
 protected:
-    status_t init_allocate(size_t size) override {
-        void *ptr = malloc(size, platform::get_cache_line_size());
-        if (!ptr) return status::out_of_memory;
-        data_ = decltype(data_)(ptr, destroy);
-        return status::success;
-    }
+    status_t init_allocate(size_t size) override;
 
 private:
     std::unique_ptr<void, void (*)(void *)> data_;
@@ -99,6 +94,10 @@ private:
 
     static void release(void *ptr) {}
     static void destroy(void *ptr) { free(ptr); }
+
+    // Touches the pages of a buffer from the threads of the library so that
+    // the OS places them close to the threads accessing them.
+    static void first_touch(void *ptr, size_t size);
 };
 
 } // namespace cpu
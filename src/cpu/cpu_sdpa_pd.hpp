@@ -0,0 +1,197 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_SDPA_PD_HPP
+#define CPU_CPU_SDPA_PD_HPP
+
+#include <cmath>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/sdpa_pd.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+#include "common/verbose.hpp"
+#include "cpu/cpu_engine.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/simple_q10n.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_sdpa_pd_t : public sdpa_pd_t {
+    using sdpa_pd_t::sdpa_pd_t;
+
+    // Scores multiplier: either the user scale or 1 / sqrt(head_size).
+    float scale_value(float user_scale) const {
+        if (!with_scale()) return 1.f / std::sqrt((float)head_size());
+        return desc_.invert_scale ? 1.f / user_scale : user_scale;
+    }
+
+    // Returns the offset of the mask value for the given output point taking
+    // broadcasting into account.
+    dim_t attn_mask_off(dim_t mb, dim_t h, dim_t q, dim_t k) const {
+        const auto &m = desc_.attn_mask_desc;
+        const auto &strides = m.format_desc.blocking.strides;
+        dim_t off = m.offset0;
+        if (m.dims[0] > 1) off += mb * strides[0];
+        if (m.dims[1] > 1) off += h * strides[1];
+        if (m.dims[2] > 1) off += q * strides[2];
+        if (m.dims[3] > 1) off += k * strides[3];
+        return off;
+    }
+
+    // Returns the offset of an element of the keys or the values. `key_dim`
+    // is the index of the keys dimension: 3 for the keys and 2 for the
+    // values. With paged KV the sequence and the key select a page of the
+    // pool and a key within the page.
+    dim_t kv_off(const memory_desc_t &md, const int32_t *block_table, dim_t mb,
+            dim_t h, dim_t d2, dim_t d3, int key_dim) const {
+        const auto &strides = md.format_desc.blocking.strides;
+        if (with_paged_kv()) {
+            const auto &bt = desc_.kv_block_table_desc;
+            const auto &bt_strides = bt.format_desc.blocking.strides;
+            dim_t &key = key_dim == 3 ? d3 : d2;
+            const dim_t page_size = desc_.kv_page_size();
+            const dim_t page = key / page_size;
+            mb = block_table[bt.offset0 + mb * bt_strides[0]
+                    + page * bt_strides[1]];
+            key -= page * page_size;
+        }
+        return md.offset0 + mb * strides[0] + h * strides[1] + d2 * strides[2]
+                + d3 * strides[3];
+    }
+
+    // Checks that the pages of the block table holding the keys are within
+    // the pool.
+    status_t check_block_table(const int32_t *block_table) const {
+        if (!with_paged_kv()) return status::success;
+        const auto &bt = desc_.kv_block_table_desc;
+        const auto &bt_strides = bt.format_desc.blocking.strides;
+        const dim_t pages = desc_.k_desc.dims[0];
+        const dim_t used_pages = utils::div_up(keys(), desc_.kv_page_size());
+        for_(dim_t mb = 0; mb < MB(); mb++)
+        for (dim_t p = 0; p < used_pages; p++) {
+            const int32_t page = block_table[bt.offset0 + mb * bt_strides[0]
+                    + p * bt_strides[1]];
+            if (page < 0 || page >= pages) {
+                VERROR(primitive, sdpa,
+                        "block table page %d is out of the kv pool", page);
+                return status::invalid_arguments;
+            }
+        }
+        return status::success;
+    }
+
+    // Index of the last key the query attends to, may be negative.
+    dim_t causal_last_key(dim_t q) const {
+        return desc_.mask_type == attn_mask_type::top_left
+                ? q
+                : q + keys() - queries();
+    }
+
+    // Rounds the probability to the quantized data type and back.
+    float fake_quantize_probs(float p) const {
+        const auto &q = desc_.probs_quant;
+        const float v = p / q.scale + (float)q.zero_point;
+        const float r = desc_.probs_dt == data_type::u8
+                ? (float)saturate_and_round<uint8_t>(v)
+                : (float)saturate_and_round<int8_t>(v);
+        const auto &dq = desc_.probs_dequant;
+        return (r - (float)dq.zero_point) * dq.scale;
+    }
+
+protected:
+    bool is_int8(data_type_t dt) const {
+        return utils::one_of(dt, data_type::s8, data_type::u8);
+    }
+
+    bool data_types_ok() const {
+        using namespace data_type;
+        const auto q_dt = desc_.q_desc.data_type;
+        const auto k_dt = desc_.k_desc.data_type;
+        const auto v_dt = desc_.v_desc.data_type;
+        const auto dst_dt = desc_.dst_desc.data_type;
+        bool ok = utils::one_of(q_dt, f32, bf16, f16, s8, u8)
+                && utils::one_of(k_dt, f32, bf16, f16, s8, u8)
+                && utils::one_of(v_dt, f32, bf16, f16, s8, u8)
+                && utils::one_of(dst_dt, f32, bf16, f16, s8, u8)
+                && utils::one_of(desc_.probs_dt, undef, s8, u8);
+        for (auto dt : {q_dt, k_dt, v_dt, dst_dt})
+            ok = ok && platform::has_data_type_support(dt);
+        if (with_attn_mask())
+            ok = ok
+                    && utils::one_of(
+                            desc_.attn_mask_desc.data_type, f32, bf16, f16);
+        if (with_scale())
+            ok = ok
+                    && utils::one_of(
+                            desc_.scale_desc.data_type, f32, bf16, f16);
+        if (with_paged_kv())
+            ok = ok && desc_.kv_block_table_desc.data_type == s32;
+        for (const auto *q :
+                {&desc_.q_quant, &desc_.k_quant, &desc_.v_quant,
+                        &desc_.dst_quant, &desc_.probs_quant,
+                        &desc_.probs_dequant})
+            ok = ok && q->scale != 0.f;
+        return ok;
+    }
+
+    // The implementations work with plain strided tensors only.
+    status_t set_default_formats() {
+        for (auto *md : {&desc_.q_desc, &desc_.k_desc, &desc_.v_desc,
+                     &desc_.dst_desc}) {
+            memory_desc_wrapper mdw(md);
+            if (mdw.format_any())
+                CHECK(memory_desc_init_by_tag(*md, format_tag::abcd));
+        }
+        if (with_attn_mask()) {
+            memory_desc_wrapper mdw(desc_.attn_mask_desc);
+            if (mdw.format_any())
+                CHECK(memory_desc_init_by_tag(
+                        desc_.attn_mask_desc, format_tag::abcd));
+        }
+        if (with_paged_kv()) {
+            memory_desc_wrapper mdw(desc_.kv_block_table_desc);
+            if (mdw.format_any())
+                CHECK(memory_desc_init_by_tag(
+                        desc_.kv_block_table_desc, format_tag::ab));
+        }
+        return status::success;
+    }
+
+    bool formats_ok() const {
+        for (const auto *md : {&desc_.q_desc, &desc_.k_desc, &desc_.v_desc,
+                     &desc_.dst_desc, &desc_.attn_mask_desc,
+                     &desc_.kv_block_table_desc}) {
+            if (md == &desc_.attn_mask_desc && !with_attn_mask()) continue;
+            if (md == &desc_.kv_block_table_desc && !with_paged_kv()) continue;
+            memory_desc_wrapper mdw(md);
+            if (!mdw.is_blocking_desc() || mdw.has_runtime_dims_or_strides()
+                    || mdw.blocking_desc().inner_nblks != 0
+                    || mdw.has_zero_dim())
+                return false;
+        }
+        return true;
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,59 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/primitive_desc_iface.hpp"
+#include "common/primitive_iface.hpp"
+
+#include "cpu/cpu_stream.hpp"
+
+#if DNNL_X64
+#include "cpu/x64/amx_tile_configure.hpp"
+#endif
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t cpu_stream_t::wait() {
+#if DNNL_X64
+    return x64::amx_tile_release_deferred();
+#else
+    return status::success;
+#endif
+}
+
+status_t cpu_stream_t::enqueue_primitive(
+        const primitive_iface_t *primitive_iface, exec_ctx_t &ctx) {
+    if (!is_profiling_enabled())
+        return stream_t::enqueue_primitive(primitive_iface, ctx);
+
+    // Parallel regions complete before the execution returns, including on
+    // asynchronous threadpools where parallel() waits on a barrier for the
+    // submitted tasks, so the record covers the whole execution.
+    cpu_stream_profiler_t::record_t record;
+    record.start_nsec = cpu_stream_profiler_t::get_nsec();
+    status_t status = stream_t::enqueue_primitive(primitive_iface, ctx);
+    record.end_nsec = cpu_stream_profiler_t::get_nsec();
+    if (status != status::success) return status;
+
+    record.pd = primitive_iface->pd()->impl();
+    profiler_->register_record(std::move(record));
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -26,18 +26,58 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_stream_profiler.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 
 struct cpu_stream_t : public stream_t {
-    cpu_stream_t(engine_t *engine, unsigned flags) : stream_t(engine, flags) {}
+    cpu_stream_t(engine_t *engine, unsigned flags) : stream_t(engine, flags) {
+        if (is_profiling_enabled())
+            profiler_ = utils::make_unique<cpu_stream_profiler_t>();
+    }
     virtual ~cpu_stream_t() = default;
 
-    dnnl::impl::status_t wait() override {
-        // CPU execution is synchronous so return immediately
-        return dnnl::impl::status::success;
+    // CPU execution is synchronous, the only work left at this point is
+    // releasing the AMX tiles that primitives left configured.
+    dnnl::impl::status_t wait() override;
+
+    status_t enqueue_primitive(const primitive_iface_t *primitive_iface,
+            exec_ctx_t &ctx) override;
+
+    status_t reset_profiling() override {
+        if (!is_profiling_enabled()) return status::invalid_arguments;
+        profiler_->reset();
+        return status::success;
+    }
+
+    status_t get_profiling_data(profiling_data_kind_t data_kind,
+            int *num_entries, uint64_t *data) const override {
+        if (!is_profiling_enabled()) return status::invalid_arguments;
+        return profiler_->get_info(data_kind, num_entries, data);
+    }
+
+    status_t get_profiling_impl_names(
+            int *num_entries, const char **names) const override {
+        if (!is_profiling_enabled()) return status::invalid_arguments;
+        return profiler_->get_impl_names(num_entries, names);
+    }
+
+    // Moves the profiling records of @p other, a stream executed by other
+    // threads on behalf of this one, to this stream.
+    status_t take_profiling_records(cpu_stream_t &other) {
+        if (!is_profiling_enabled() || !other.is_profiling_enabled())
+            return status::invalid_arguments;
+        profiler_->take_records(*other.profiler_);
+        return status::success;
+    }
+
+    status_t notify_profiling_complete() const override {
+        // There are no asynchronous profiling events to wait for.
+        return status::success;
     }
 
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
@@ -55,6 +95,9 @@ struct cpu_stream_t : public stream_t {
         threadpool_utils::deactivate_threadpool();
     }
 #endif
+
+private:
+    std::unique_ptr<cpu_stream_profiler_t> profiler_;
 };
 
 } // namespace cpu
@@ -0,0 +1,164 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+
+#include "common/utils.hpp"
+
+#include "cpu/cpu_stream_profiler.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+uint64_t get_next_profiler_id() {
+    static std::atomic<uint64_t> next_id(1);
+    return next_id.fetch_add(1);
+}
+} // namespace
+
+cpu_stream_profiler_t::cpu_stream_profiler_t() : id_(get_next_profiler_id()) {}
+
+uint64_t cpu_stream_profiler_t::get_nsec() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+}
+
+cpu_stream_profiler_t::ring_buffer_t &
+cpu_stream_profiler_t::get_thread_buffer() {
+    // Fast path: the thread has already used this profiler.
+    thread_local uint64_t cached_id = 0;
+    thread_local ring_buffer_t *cached_buffer = nullptr;
+    if (cached_id == id_) return *cached_buffer;
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto &buffer = buffers_[std::this_thread::get_id()];
+    if (!buffer) buffer = utils::make_unique<ring_buffer_t>();
+    cached_id = id_;
+    cached_buffer = buffer.get();
+    return *buffer;
+}
+
+void cpu_stream_profiler_t::register_record(record_t &&record) {
+    auto &buffer = get_thread_buffer();
+    const uint64_t head = buffer.head.load(std::memory_order_relaxed);
+    buffer.records[head % ring_buffer_t::capacity] = std::move(record);
+    // Publish the record.
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void cpu_stream_profiler_t::reset() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (auto &kv : buffers_) {
+        auto &buffer = *kv.second;
+        const uint64_t head = buffer.head.load(std::memory_order_acquire);
+        buffer.tail = head;
+        // Release the primitive descriptors.
+        for (auto &r : buffer.records)
+            r.pd.reset();
+    }
+}
+
+void cpu_stream_profiler_t::take_records(cpu_stream_profiler_t &other) {
+    for (const auto *r : other.collect())
+        register_record(record_t(*r));
+    other.reset();
+}
+
+std::vector<const cpu_stream_profiler_t::record_t *>
+cpu_stream_profiler_t::collect() const {
+    std::vector<const record_t *> records;
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (const auto &kv : buffers_) {
+        const auto &buffer = *kv.second;
+        const uint64_t head = buffer.head.load(std::memory_order_acquire);
+        const uint64_t capacity = ring_buffer_t::capacity;
+        const uint64_t begin = nstl::max(
+                buffer.tail, head > capacity ? head - capacity : uint64_t(0));
+        for (uint64_t i = begin; i < head; i++)
+            records.push_back(&buffer.records[i % capacity]);
+    }
+    std::stable_sort(records.begin(), records.end(),
+            [](const record_t *a, const record_t *b) {
+                return a->start_nsec < b->start_nsec;
+            });
+    return records;
+}
+
+status_t cpu_stream_profiler_t::get_info(profiling_data_kind_t data_kind,
+        int *num_entries, uint64_t *data) const {
+    // Nothing is written unless the arguments are valid.
+    if (!num_entries) return status::invalid_arguments;
+    if (!utils::one_of(data_kind, profiling_data_kind::time,
+                profiling_data_kind::start_time,
+                profiling_data_kind::primitive_kind))
+        return status::invalid_arguments;
+    if (data && *num_entries < 0) return status::invalid_arguments;
+
+    const auto records = collect();
+    const int n_records = (int)records.size();
+    if (!data) {
+        *num_entries = n_records;
+        return status::success;
+    }
+
+    // On input @p num_entries is the capacity of @p data. The data is
+    // truncated to the capacity and the number of available entries is
+    // returned, so the caller can detect the truncation.
+    const int n = nstl::min(n_records, *num_entries);
+    *num_entries = n_records;
+    for (int i = 0; i < n; i++) {
+        const auto &r = *records[i];
+        switch ((int)data_kind) {
+            case profiling_data_kind::time:
+                data[i] = r.end_nsec - r.start_nsec;
+                break;
+            case profiling_data_kind::start_time: data[i] = r.start_nsec; break;
+            case profiling_data_kind::primitive_kind:
+                data[i] = (uint64_t)r.pd->kind();
+                break;
+            default: assert(!"unexpected profiling data kind");
+        }
+    }
+    return status::success;
+}
+
+status_t cpu_stream_profiler_t::get_impl_names(
+        int *num_entries, const char **names) const {
+    if (!num_entries) return status::invalid_arguments;
+    if (names && *num_entries < 0) return status::invalid_arguments;
+
+    const auto records = collect();
+    const int n_records = (int)records.size();
+    if (!names) {
+        *num_entries = n_records;
+        return status::success;
+    }
+
+    // See get_info().
+    const int n = nstl::min(n_records, *num_entries);
+    *num_entries = n_records;
+    for (int i = 0; i < n; i++)
+        names[i] = records[i]->pd->name();
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
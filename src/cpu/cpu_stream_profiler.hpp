@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_STREAM_PROFILER_HPP
+#define CPU_CPU_STREAM_PROFILER_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive_desc.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Collects start and end timestamps of primitive executions on a CPU stream.
+// Each thread executing primitives on the stream writes records into its own
+// ring buffer, so recording does not require any synchronization between the
+// threads. Querying and resetting the profiler is expected to happen when no
+// primitives are being executed on the stream.
+struct cpu_stream_profiler_t {
+    struct record_t {
+        uint64_t start_nsec = 0;
+        uint64_t end_nsec = 0;
+        // Keeps the primitive descriptor alive to be able to query the
+        // primitive kind and the implementation name.
+        std::shared_ptr<primitive_desc_t> pd;
+    };
+
+    cpu_stream_profiler_t();
+
+    // Returns a monotonic timestamp in nanoseconds.
+    static uint64_t get_nsec();
+
+    void register_record(record_t &&record);
+    void reset();
+    // Moves the records of @p other to the buffer of the calling thread.
+    void take_records(cpu_stream_profiler_t &other);
+
+    status_t get_info(profiling_data_kind_t data_kind, int *num_entries,
+            uint64_t *data) const;
+    status_t get_impl_names(int *num_entries, const char **names) const;
+
+private:
+    // Single-producer ring buffer. When the buffer is full the oldest records
+    // are overwritten.
+    struct ring_buffer_t {
+        static constexpr size_t capacity = 1024;
+
+        ring_buffer_t() : records(capacity), head(0), tail(0) {}
+
+        std::vector<record_t> records;
+        // Total number of records written by the owning thread.
+        std::atomic<uint64_t> head;
+        // Number of records to skip, updated on reset.
+        uint64_t tail;
+    };
+
+    ring_buffer_t &get_thread_buffer();
+    // Returns records from all the threads sorted by the start time.
+    std::vector<const record_t *> collect() const;
+
+    // Unique profiler identifier used to validate the thread local buffer
+    // cache, as profilers may be allocated at the same address.
+    const uint64_t id_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::thread::id, std::unique_ptr<ring_buffer_t>>
+            buffers_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_stream_profiler_t);
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -15,6 +15,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #include "common/bfloat16.hpp"
@@ -323,6 +325,142 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+namespace {
+
+// A single GEMM of a batch, dispatched on the data types.
+dnnl_status_t gemm_one(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const float *A, const dim_t *lda, const float *ao,
+        const float *B, const dim_t *ldb, const float *bo, const float *beta,
+        float *C, const dim_t *ldc, const float *co) {
+    return extended_sgemm(
+            transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+dnnl_status_t gemm_one(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const bfloat16_t *A, const dim_t *lda,
+        const bfloat16_t *ao, const bfloat16_t *B, const dim_t *ldb,
+        const bfloat16_t *bo, const float *beta, float *C, const dim_t *ldc,
+        const float *co) {
+    return gemm_bf16bf16f32(
+            transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <typename b_dt>
+dnnl_status_t gemm_one(const char *transa, const char *transb,
+        const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
+        const float *alpha, const int8_t *A, const dim_t *lda,
+        const int8_t *ao, const b_dt *B, const dim_t *ldb, const b_dt *bo,
+        const float *beta, int32_t *C, const dim_t *ldc, const int32_t *co) {
+    return gemm_s8x8s32<b_dt>(transa, transb, offsetc, M, N, K, alpha, A, lda,
+            ao, B, ldb, bo, beta, C, ldc, co);
+}
+
+} // namespace
+
+template <typename a_dt, typename b_dt, typename c_dt>
+dnnl_status_t gemm_batch(const char *transa, const char *transb,
+        const char *offsetc, dim_t M, dim_t N, dim_t K, float alpha,
+        gemm_batch_operand_t<const a_dt> A, dim_t lda, a_dt ao,
+        gemm_batch_operand_t<const b_dt> B, dim_t ldb, b_dt bo, float beta,
+        gemm_batch_operand_t<c_dt> C, dim_t ldc, const c_dt *co, dim_t batch) {
+    if (batch < 0 || utils::any_null(transa, transb))
+        return dnnl_invalid_arguments;
+    if (batch == 0) return dnnl_success;
+    if (A.is_null() || B.is_null() || C.is_null())
+        return dnnl_invalid_arguments;
+    // Packed matrices are per-GEMM objects and can't be batched.
+    if (!utils::one_of(*transa, 'N', 'n', 'T', 't')
+            || !utils::one_of(*transb, 'N', 'n', 'T', 't'))
+        return dnnl_invalid_arguments;
+    dnnl_status_t status = check_gemm_input(transa, transb, &M, &N, &K,
+            A.get(0), &lda, B.get(0), &ldb, C.get(0), &ldc, &alpha, &beta,
+            false);
+    if (status != dnnl_success) return status;
+
+    const bool is_trans_a = utils::one_of(*transa, 'T', 't');
+    const bool is_trans_b = utils::one_of(*transb, 'T', 't');
+    const bool with_co = offsetc && co;
+    const bool co_by_row = with_co && utils::one_of(*offsetc, 'C', 'c');
+    const bool co_by_col = with_co && utils::one_of(*offsetc, 'R', 'r');
+
+    // Computes the columns [n, n + n_sz) of the rows [m, m + m_sz) of C.
+    auto gemm_slice = [&](dim_t ibatch, dim_t m, dim_t m_sz, dim_t n,
+                              dim_t n_sz) {
+        const a_dt *a = A.get(ibatch) + (is_trans_a ? m * lda : m);
+        const b_dt *b = B.get(ibatch) + (is_trans_b ? n : n * ldb);
+        c_dt *c = C.get(ibatch) + n * ldc + m;
+        const c_dt *c_off = co_by_row ? co + m : (co_by_col ? co + n : co);
+        return gemm_one(transa, transb, offsetc, &m_sz, &n_sz, &K, &alpha, a,
+                &lda, &ao, b, &ldb, &bo, &beta, c, &ldc, c_off);
+    };
+
+    // Small outputs are computed by the threading of a single GEMM that may
+    // also split the K dimension, otherwise the batch, columns and rows of
+    // all the matrices are split between the threads at once as in the
+    // GEMM-based matmul.
+    const int nthr = dnnl_get_current_num_threads();
+    const dim_t work_per_batch = M * N;
+    const dim_t work_amount = batch * work_per_batch;
+    if (nthr == 1 || work_amount < (dim_t)nthr * 256) {
+        for (dim_t ibatch = 0; ibatch < batch; ++ibatch) {
+            status = gemm_slice(ibatch, 0, M, 0, N);
+            if (status != dnnl_success) return status;
+        }
+        return dnnl_success;
+    }
+
+    std::atomic<dnnl_status_t> st(dnnl_success);
+    parallel(nthr, [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        dim_t iwork = start;
+        while (iwork < end) {
+            dim_t ibatch {0}, n {0}, m {0};
+            utils::nd_iterator_init(iwork, ibatch, batch, n, N, m, M);
+
+            const dim_t rem_work = end - iwork;
+            dim_t m_sz {0}, n_sz {0};
+            if (rem_work >= work_per_batch && n == 0 && m == 0) {
+                // parallel over batch
+                m_sz = M;
+                n_sz = N;
+            } else if (rem_work >= M && m == 0) {
+                // parallel over columns
+                m_sz = M;
+                n_sz = nstl::min(N - n, rem_work / M);
+            } else {
+                // parallel over rows
+                m_sz = nstl::min(M - m, rem_work);
+                n_sz = 1;
+            }
+
+            const dnnl_status_t st_thr = gemm_slice(ibatch, m, m_sz, n, n_sz);
+            if (st_thr != dnnl_success) {
+                st = st_thr;
+                return;
+            }
+            iwork += m_sz * n_sz;
+        }
+    });
+    return st;
+}
+
+#define INST(a_dt, b_dt, c_dt) \
+    template dnnl_status_t gemm_batch<a_dt, b_dt, c_dt>(const char *transa, \
+            const char *transb, const char *offsetc, dim_t M, dim_t N, \
+            dim_t K, float alpha, gemm_batch_operand_t<const a_dt> A, \
+            dim_t lda, a_dt ao, gemm_batch_operand_t<const b_dt> B, \
+            dim_t ldb, b_dt bo, float beta, gemm_batch_operand_t<c_dt> C, \
+            dim_t ldc, const c_dt *co, dim_t batch);
+INST(float, float, float)
+INST(bfloat16_t, bfloat16_t, float)
+INST(int8_t, uint8_t, int32_t)
+INST(int8_t, int8_t, int32_t)
+#undef INST
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
@@ -69,6 +69,37 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
         const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
         const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
 
+// Matrices of a batched GEMM, either an array of pointers or a base pointer
+// and a stride (in elements) between the matrices.
+template <typename data_t>
+struct gemm_batch_operand_t {
+    gemm_batch_operand_t(data_t *base, dim_t stride)
+        : base_(base), ptrs_(nullptr), stride_(stride) {}
+    gemm_batch_operand_t(data_t *const *ptrs)
+        : base_(nullptr), ptrs_(ptrs), stride_(0) {}
+
+    bool is_null() const { return !base_ && !ptrs_; }
+    data_t *get(dim_t ibatch) const {
+        return ptrs_ ? ptrs_[ibatch] : base_ + ibatch * stride_;
+    }
+
+private:
+    data_t *base_;
+    data_t *const *ptrs_;
+    dim_t stride_;
+};
+
+// Computes @p batch column-major GEMMs of the same shape. The work of the
+// whole batch is split between the threads at once; the offsets @p ao, @p bo,
+// @p co and @p offsetc are used by the integer variants only and are shared
+// by all the matrices.
+template <typename a_dt, typename b_dt, typename c_dt>
+dnnl_status_t gemm_batch(const char *transa, const char *transb,
+        const char *offsetc, dim_t M, dim_t N, dim_t K, float alpha,
+        gemm_batch_operand_t<const a_dt> A, dim_t lda, a_dt ao,
+        gemm_batch_operand_t<const b_dt> B, dim_t ldb, b_dt bo, float beta,
+        gemm_batch_operand_t<c_dt> C, dim_t ldc, const c_dt *co, dim_t batch);
+
 #if defined(USE_CBLAS)
 #define GEMM_IMPL_STR "x64:gemm:blas"
 #elif DNNL_X64
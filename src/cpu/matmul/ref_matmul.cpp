@@ -42,8 +42,14 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
     CHECK(status);
 
+    // With weights decompression the weights scales are applied to the
+    // weights directly and may have a non-f32 data type and groups.
+    const bool with_wei_decompression = pd()->with_wei_decompression();
+    const auto *wei_scales_attr
+            = with_wei_decompression ? nullptr : pd()->attr();
+
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
-    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER_ATTR(wei_scales_attr, wei_scales, DNNL_ARG_WEIGHTS);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
 
     const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
@@ -72,6 +78,53 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const int bia_mask
             = utils::get_dims_mask(dst_d.dims(), bia_d.dims(), ndims);
 
+    // weights decompression section
+    const auto &attr_wei_scales
+            = pd()->attr()->scales_.get(DNNL_ARG_WEIGHTS);
+    const auto &attr_zero_points = pd()->attr()->zero_points_;
+    const bool with_wei_decomp_scales
+            = with_wei_decompression && !attr_wei_scales.has_default_values();
+    const bool with_wei_decomp_zero_points = with_wei_decompression
+            && !attr_zero_points.has_default_values(DNNL_ARG_WEIGHTS);
+    const void *wei_decomp_scales = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+    const void *wei_decomp_zero_points = CTX_IN_MEM(
+            const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
+    if (with_wei_decomp_scales && !wei_decomp_scales)
+        return status::invalid_arguments;
+    if (with_wei_decomp_zero_points && !wei_decomp_zero_points)
+        return status::invalid_arguments;
+
+    dim_t scales_group_k = K, scales_group_n = N;
+    if (with_wei_decomp_scales)
+        pd()->wei_qparam_groups(attr_wei_scales.mask_, attr_wei_scales.ndims_,
+                attr_wei_scales.group_dims_, scales_group_k, scales_group_n);
+    dim_t zp_group_k = K, zp_group_n = N;
+    if (with_wei_decomp_zero_points)
+        pd()->wei_qparam_groups(attr_zero_points.get(DNNL_ARG_WEIGHTS),
+                attr_zero_points.get_groups_ndims(DNNL_ARG_WEIGHTS),
+                attr_zero_points.get_groups(DNNL_ARG_WEIGHTS), zp_group_k,
+                zp_group_n);
+
+    // Quantization parameters are stored as a dense [K / group_k,
+    // N / group_n] array.
+    auto decompress = [&](float w, dim_t k, dim_t n) {
+        if (with_wei_decomp_zero_points) {
+            const dim_t off = (k / zp_group_k) * (N / zp_group_n)
+                    + n / zp_group_n;
+            w -= io::load_int_value(
+                    attr_zero_points.get_data_type(DNNL_ARG_WEIGHTS),
+                    wei_decomp_zero_points, off);
+        }
+        if (with_wei_decomp_scales) {
+            const dim_t off = (k / scales_group_k) * (N / scales_group_n)
+                    + n / scales_group_n;
+            w *= io::load_float_value(
+                    attr_wei_scales.data_type_, wei_decomp_scales, off);
+        }
+        return w;
+    };
+
     // mm kernel
     auto ker = [&](const dims_t dst_dims_idx, dim_t m, dim_t n) {
         float acc = 0;
@@ -90,8 +143,9 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
             const auto weights_off = weights_d.off_v(weights_dims_idx);
             const float s
                     = io::load_float_value(src_d.data_type(), src, src_off);
-            const float w = io::load_float_value(
+            float w = io::load_float_value(
                     weights_d.data_type(), weights, weights_off);
+            if (with_wei_decompression) w = decompress(w, k, n);
             acc += s * w;
         }
         return acc;
@@ -109,8 +163,8 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const auto &attr_scales = pd()->attr()->scales_;
     const bool with_src_scales
             = !attr_scales.get(DNNL_ARG_SRC).has_default_values();
-    const bool with_wei_scales
-            = !attr_scales.get(DNNL_ARG_WEIGHTS).has_default_values();
+    const bool with_wei_scales = !with_wei_decompression
+            && !attr_scales.get(DNNL_ARG_WEIGHTS).has_default_values();
     const bool with_dst_scales
             = !attr_scales.get(DNNL_ARG_DST).has_default_values();
     const dim_t wei_scale_stride
@@ -49,11 +49,21 @@ struct ref_matmul_t : public primitive_t {
             const auto bia_type = weights_md(1)->data_type;
             const auto dst_type = dst_md(0)->data_type;
 
+            const bool is_wei_decomp = with_wei_decompression();
+            auto skip_mask = smask_t::scales_runtime | smask_t::post_ops
+                    | smask_t::sum_dt;
+            if (is_wei_decomp)
+                skip_mask |= smask_t::scales_runtime_groups
+                        | smask_t::scales_runtime_data_type
+                        | smask_t::zero_points_runtime_groups
+                        | smask_t::zero_points_runtime_data_type;
+
             bool ok = is_dense_format_kind()
                     && utils::one_of(src_type, f32, bf16, f16, f8_e5m2, f8_e4m3)
-                    && utils::one_of(wei_type, f32, bf16, f16, f8_e5m2, f8_e4m3)
+                    && utils::one_of(wei_type, f32, bf16, f16, f8_e5m2, f8_e4m3,
+                            s8, u8, s4, u4)
                     && utils::one_of(dst_type, f32, bf16, f16, f8_e5m2, f8_e4m3)
-                    && src_type == wei_type
+                    && (src_type == wei_type || is_wei_decomp)
                     && IMPLICATION(src_type == f32, dst_type == f32)
                     && IMPLICATION(src_type == bf16,
                             utils::one_of(dst_type, f32, bf16))
@@ -73,9 +83,10 @@ struct ref_matmul_t : public primitive_t {
                             // data type for fp8?
                             )
                     && platform::has_data_type_support(src_type)
-                    && attr()->has_default_values(smask_t::scales_runtime
-                                    | smask_t::post_ops | smask_t::sum_dt,
-                            dst_type)
+                    && attr()->has_default_values(skip_mask, dst_type)
+                    && attr()->zero_points_.has_default_values(DNNL_ARG_SRC)
+                    && attr()->zero_points_.has_default_values(DNNL_ARG_DST)
+                    && IMPLICATION(is_wei_decomp, attr_wei_decompression_ok())
                     && attr_.post_ops_.check_sum_consistency(dst_type,
                             /* is_int8 */ false)
                     && ref_post_ops_t::primitive_kind_ok(attr()->post_ops_)
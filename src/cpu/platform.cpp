@@ -18,6 +18,12 @@
 
 #include <thread>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "common/utils.hpp"
+
 #include "cpu/platform.hpp"
 
 #if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
@@ -282,6 +288,21 @@ size_t get_timestamp() {
 #endif
 }
 
+void advise_hugepages(void *ptr, size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // madvise() requires a page aligned address, only the pages fully covered
+    // by the buffer are advised.
+    const uintptr_t page = PAGE_4K;
+    const uintptr_t beg = utils::rnd_up((uintptr_t)ptr, page);
+    const uintptr_t end = utils::rnd_dn((uintptr_t)ptr + size, page);
+    // The advice is a hint, a failure is not an error.
+    if (end > beg) ::madvise((void *)beg, end - beg, MADV_HUGEPAGE);
+#else
+    UNUSED(ptr);
+    UNUSED(size);
+#endif
+}
+
 } // namespace platform
 } // namespace cpu
 } // namespace impl
@@ -182,6 +182,10 @@ int get_vector_register_size();
 
 size_t get_timestamp();
 
+// Advises the OS to back the pages of [ptr, ptr + size) with transparent huge
+// pages. Does nothing on systems without such a facility.
+void advise_hugepages(void *ptr, size_t size);
+
 } // namespace platform
 
 // XXX: find a better place for these values?
@@ -42,6 +42,8 @@ inline int load_int_value(data_type_t dt, const void *ptr, dim_t idx) {
         CASE(s32);
         CASE(s8);
         CASE(u8);
+        case s4: return static_cast<int>(int4_t::extract(ptr, idx));
+        case u4: return static_cast<int>(uint4_t::extract(ptr, idx));
         default: assert(!"bad data_type");
     }
 
@@ -67,6 +69,8 @@ inline float load_float_value(data_type_t dt, const void *ptr, dim_t idx) {
         CASE(s32);
         CASE(s8);
         CASE(u8);
+        case s4: return static_cast<float>(int4_t::extract(ptr, idx));
+        case u4: return static_cast<float>(uint4_t::extract(ptr, idx));
         default: assert(!"bad data_type");
     }
 
@@ -0,0 +1,135 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_sdpa_t::execute(const exec_ctx_t &ctx) const {
+    const auto q = CTX_IN_MEM(const void *, DNNL_ARG_QUERIES);
+    const auto k = CTX_IN_MEM(const void *, DNNL_ARG_KEYS);
+    const auto v = CTX_IN_MEM(const void *, DNNL_ARG_VALUES);
+    const auto mask = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    const auto scale = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    const auto block_table
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_KV_BLOCK_TABLE);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    CHECK(pd()->check_block_table(block_table));
+
+    const auto *desc = pd()->desc();
+    const memory_desc_wrapper q_d(desc->q_desc);
+    const memory_desc_wrapper k_d(desc->k_desc);
+    const memory_desc_wrapper v_d(desc->v_desc);
+    const memory_desc_wrapper dst_d(desc->dst_desc);
+    const auto mask_dt = desc->attn_mask_desc.data_type;
+
+    const dim_t MB = pd()->MB();
+    const dim_t HQ = pd()->q_heads();
+    const dim_t SQ = pd()->queries();
+    const dim_t SK = pd()->keys();
+    const dim_t D = pd()->head_size();
+    const dim_t DV = pd()->values();
+    const dim_t q_per_kv = desc->q_per_kv_heads();
+
+    const float scale_val = pd()->scale_value(pd()->with_scale()
+                    ? io::load_float_value(desc->scale_desc.data_type, scale, 0)
+                    : 1.f);
+
+    auto load = [](const memory_desc_wrapper &md, const void *ptr, dim_t off,
+                        const sdpa_quant_t &quant) {
+        const float val = io::load_float_value(md.data_type(), ptr, off);
+        if (!utils::one_of(md.data_type(), data_type::s8, data_type::u8))
+            return val;
+        return (val - (float)quant.zero_point) * quant.scale;
+    };
+
+    auto scratch = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_sdpa_scores);
+
+    parallel_nd_ext(pd()->nthr_, MB, HQ, SQ,
+            [&](int ithr, int, dim_t mb, dim_t h, dim_t i) {
+        float *s = scratch + ithr * SK;
+        const dim_t h_kv = h / q_per_kv;
+
+        const dim_t last_key = pd()->with_causal_mask()
+                ? nstl::min(pd()->causal_last_key(i), SK - 1)
+                : SK - 1;
+
+        float max_s = -INFINITY;
+        for (dim_t j = 0; j <= last_key; ++j) {
+            float acc = 0.f;
+            for (dim_t d = 0; d < D; ++d)
+                acc += load(q_d, q, q_d.off(mb, h, i, d), desc->q_quant)
+                        * load(k_d, k,
+                                pd()->kv_off(desc->k_desc, block_table, mb,
+                                        h_kv, d, j, 3),
+                                desc->k_quant);
+            acc *= scale_val;
+            if (pd()->with_attn_mask())
+                acc += io::load_float_value(
+                        mask_dt, mask, pd()->attn_mask_off(mb, h, i, j));
+            s[j] = acc;
+            max_s = nstl::max(max_s, acc);
+        }
+
+        // A query that attends to no keys produces zeros.
+        const bool empty_row = last_key < 0 || max_s == -INFINITY;
+        float sum = 0.f;
+        if (!empty_row) {
+            for (dim_t j = 0; j <= last_key; ++j) {
+                s[j] = ::expf(s[j] - max_s);
+                sum += s[j];
+            }
+            for (dim_t j = 0; j <= last_key; ++j) {
+                s[j] /= sum;
+                if (pd()->with_probs_quantization())
+                    s[j] = pd()->fake_quantize_probs(s[j]);
+            }
+        }
+
+        for (dim_t dv = 0; dv < DV; ++dv) {
+            float acc = 0.f;
+            if (!empty_row)
+                for (dim_t j = 0; j <= last_key; ++j)
+                    acc += s[j]
+                            * load(v_d, v,
+                                    pd()->kv_off(desc->v_desc, block_table,
+                                            mb, h_kv, j, dv, 2),
+                                    desc->v_quant);
+            if (utils::one_of(
+                        dst_d.data_type(), data_type::s8, data_type::u8))
+                acc = acc / desc->dst_quant.scale
+                        + (float)desc->dst_quant.zero_point;
+            io::store_float_value(
+                    dst_d.data_type(), acc, dst, dst_d.off(mb, h, i, dv));
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
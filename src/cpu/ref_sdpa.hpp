@@ -0,0 +1,73 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_SDPA_HPP
+#define CPU_REF_SDPA_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Computes the attention one query at a time. Only a row of scores is kept in
+// memory.
+struct ref_sdpa_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_sdpa_t);
+
+        status_t init(engine_t *engine) {
+            VDISPATCH_SDPA(check_shapes(), VERBOSE_INCONSISTENT_PRB);
+            VDISPATCH_SDPA(data_types_ok(), VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(attr()->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SDPA(set_default_formats() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SDPA(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+            nthr_ = dnnl_get_max_threads();
+            auto scratchpad = scratchpad_registry().registrar();
+            scratchpad.template book<float>(
+                    memory_tracking::names::key_sdpa_scores, nthr_ * keys());
+
+            return status::success;
+        }
+
+        int nthr_; // To not exceed the limit in execute used for set up.
+    };
+
+    ref_sdpa_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
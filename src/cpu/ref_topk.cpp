@@ -0,0 +1,81 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_topk_t::execute(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto dst_indices = CTX_OUT_MEM(int32_t *, DNNL_ARG_DST_INDICES);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper dst_indices_d(pd()->dst_md(1));
+
+    const int ndims = src_d.ndims();
+    const int axis = pd()->axis();
+    const dim_t k = pd()->k();
+    const dim_t axis_size = pd()->axis_size();
+    const data_type_t src_dt = src_d.data_type();
+    const data_type_t dst_dt = dst_d.data_type();
+
+    dims_t outer_dims;
+    utils::array_copy(outer_dims, src_d.dims(), ndims);
+    outer_dims[axis] = 1;
+
+    using entry_t = std::pair<float, dim_t>;
+    // Larger values first, equal values are ordered by index.
+    const auto greater = [](const entry_t &a, const entry_t &b) {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    };
+
+    parallel_nd(pd()->nrows(), [&](dim_t r) {
+        dims_t pos;
+        utils::l_dims_by_l_offset(pos, r, outer_dims, ndims);
+
+        std::vector<entry_t> row(axis_size);
+        for (dim_t i = 0; i < axis_size; ++i) {
+            pos[axis] = i;
+            row[i] = {io::load_float_value(src_dt, src, src_d.off_v(pos)), i};
+        }
+        std::partial_sort(row.begin(), row.begin() + k, row.end(), greater);
+
+        for (dim_t i = 0; i < k; ++i) {
+            pos[axis] = i;
+            io::store_float_value(dst_dt, row[i].first, dst, dst_d.off_v(pos));
+            dst_indices[dst_indices_d.off_v(pos)] = (int32_t)row[i].second;
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_TOPK_HPP
+#define CPU_REF_TOPK_HPP
+
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_topk_t : public primitive_t {
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_topk_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            const data_type_t src_dt = src_md()->data_type;
+            VDISPATCH_TOPK(utils::one_of(src_dt, f32, bf16, f16, s8, u8),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(platform::has_data_type_support(src_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_TOPK(dst_md()->data_type == src_dt,
+                    VERBOSE_INCONSISTENT_DT, "src", "dst");
+            VDISPATCH_TOPK(attr()->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_TOPK(set_default_params() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+    };
+
+    ref_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
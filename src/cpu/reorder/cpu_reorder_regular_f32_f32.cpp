@@ -72,6 +72,7 @@ const impl_list_map_t &regular_f32_f32_impl_list_map() {
         }},
         {{f32, f32, 4}, {
             CPU_REORDER_INSTANCE(rnn_weights_reorder_t<f32, f32>)
+            DNNL_X64_ONLY(CPU_REORDER_INSTANCE(x64::brgemm_wino_weights_reorder_t))
 
             REG_FAST_DIRECT_COPY_F32_F32
 
@@ -29,6 +29,8 @@
 
  */
 
+#include <atomic>
+
 #include "common/dnnl_thread.hpp"
 #include "common/stream.hpp"
 
@@ -155,6 +157,17 @@ rnn_gemm_sig(ref_rnn_fwd_s8s8_t::packed_gemm) {
 }
 
 //*************** Grid computations strategy: linear ***************//
+namespace {
+// Returns the part of a buffer of @p size bytes split between @p n_lanes
+// wavefront lanes that belongs to @p lane.
+template <typename T>
+T *lane_slice(T *buf, size_t size, int n_lanes, int lane) {
+    if (buf == nullptr || n_lanes == 1) return buf;
+    return reinterpret_cast<T *>(
+            reinterpret_cast<char *>(buf) + lane * (size / n_lanes));
+}
+} // namespace
+
 template <prop_kind_t aprop, data_type_t src_type, data_type_t weights_type,
         data_type_t acc_type>
 rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
@@ -252,7 +265,202 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
                   return dnnl_success;
               };
 
+    // Executes the cell of the j-th layer and i-th iteration in execution
+    // order. Cells executed concurrently use the scratch buffers of their
+    // wavefront lane.
+    const auto compute_cell = [&](int dir, int j, int i, int lane) {
+        const int lay = (aprop == prop_kind::forward) ? j : rnn.n_layer - j - 1;
+        const int iter
+                = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
+
+        // We set parameters to the cell execution call
+
+        // dst_layer is equal to dst_iter. To avoid
+        // duplication of memory access we hence use only
+        // dst_layer and set dst_iter to nullptr, unless we
+        // cannot for one of the following condition:
+        // - in the last layer and last iteration, we need to
+        //   copy ht in two tensors (dst_layer and dst_iter)
+        dst_layer_t *cell_dst_layer
+                = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
+        dst_iter_t *cell_dst_iter = nullptr;
+        const src_layer_t *cell_src_layer
+                = &(ws_states_layer(lay, dir, iter + 1, 0));
+        const src_iter_t *cell_src_iter
+                = &(ws_states_iter(lay + 1, dir, iter, 0));
+
+        void *cell_dst_iter_c = const_cast<void *>(
+                ws_states_iter_c(lay + 1, dir, iter + 1, 0));
+        const void *cell_src_iter_c
+                = ws_states_iter_c(lay + 1, dir, iter, 0);
+
+        // the cell_position is used only when skip_data_copy is
+        // supported currently supported only for forward
+        cell_position_t cell_position = middle_cell;
+        if (iter == 0) cell_position |= first_iter;
+        if (lay == 0) cell_position |= first_layer;
+        if (iter == rnn.n_iter - 1) cell_position |= last_iter;
+        if (lay == rnn.n_layer - 1) cell_position |= last_layer;
+
+        // The dst_* paths should be before the src_* paths as
+        // the later will override cell_src_layer and
+        // cell_src_iter appropriately for 1st layer and 1st
+        // iter.
+        const bool last_iter_skip_copy
+                = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
+        if (last_iter_skip_copy) {
+            cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
+            cell_src_layer
+                    = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
+        }
+
+        if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
+            // Note: for last layer and last iter, the output is in dst_layer
+            // and still need to be copied to dst_iter
+            cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
+            cell_dst_iter = last_iter_skip_copy
+                    ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
+                    : nullptr;
+            cell_src_iter = (iter != 0)
+                    ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
+                    : cell_src_iter;
+        }
+        if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
+            cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
+
+        if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
+            cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
+
+        // because the c state is always f32 and require no
+        // conversion, we can always skip to copy for the 1st
+        // and last iteration
+        if (iter == 0 && src_iter_c_) {
+            cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
+                    src_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_first_iter;
+        }
+        if (iter == rnn.n_iter - 1 && dst_iter_c_) {
+            cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
+                    dst_iter_c_mdw.off(lay, dir, 0, 0));
+            cell_position |= c_state_last_iter;
+        }
+        const size_t sg_start_idx = rnn.n_iter_scratch_gates == 1
+                ? static_cast<size_t>(0)
+                : static_cast<size_t>(iter) * rnn.scratch_gates_nld
+                        * rnn.scratch_gates_ld;
+        const auto lane_scratch_gates = lane_slice(scratch_gates_,
+                rnn.scratch_gates_size, rnn.n_wavefront_lanes, lane);
+        const auto cell_scratch_gates = &lane_scratch_gates[sg_start_idx];
+        const auto cell_scratch_cell = lane_slice(scratch_cell_,
+                rnn.scratch_cell_size, rnn.n_wavefront_lanes, lane);
+
+        dst_iter_t *proj_ht = nullptr;
+        if (rnn.is_lstm_projection) {
+            if (rnn.is_training)
+                proj_ht = &(ws_ht(lay, dir, iter, 0));
+            else
+                proj_ht = lane_slice(scratch_ht_, rnn.scratch_ht_size,
+                        rnn.n_wavefront_lanes, lane);
+        }
+
+#if DNNL_X64
+        // The brgemm buffers are booked per thread and a cell executed by a
+        // wavefront lane runs on a single thread (see cell_nthr()), whatever
+        // the threading runtime, so the lane uses a single slot.
+        const auto cell_amx_scratchpad = amx_scratchpad
+                ? amx_scratchpad + lane * rnn.m_block * rnn.n_block
+                : nullptr;
+        const auto cell_addr_batch = addr_batch_global
+                ? addr_batch_global
+                        + lane * ref_rnn_brgemm_t::addr_batch_size_per_thr(rnn)
+                : nullptr;
+        CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), cell_scratch_cell,
+                scratch_gates_blocked_, scratch_src_layer_,
+                scratch_src_iter_, cell_dst_iter, cell_amx_scratchpad,
+                cell_addr_batch));
+#else
+        CHECK((this->*cell_func)(rnn, cell_position, cell_dst_layer,
+                cell_dst_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
+                SAFE_PTR(diff_augru_attention, iter, 0, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
+                SAFE_PTR(weights_layer, lay, dir, 0),
+                SAFE_PTR(weights_iter, lay, dir, 0),
+                SAFE_PTR(weights_projection, lay, dir),
+                SAFE_PTR(weights_peephole, lay, dir, 0),
+                w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
+                            : nullptr,
+                bias(lay, dir), cell_src_layer,
+                SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
+                cell_src_iter_c,
+                SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
+                SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
+                SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
+                SAFE_PTR(diff_weights_layer, lay, dir, 0),
+                SAFE_PTR(diff_weights_iter, lay, dir, 0),
+                SAFE_PTR(diff_weights_projection, lay, dir, 0),
+                SAFE_PTR(diff_weights_peephole, lay, dir, 0),
+                SAFE_PTR(diff_bias, lay, dir, 0),
+                SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
+                proj_ht, scratch_diff_ht_,
+                SAFE_PTR(ws_grid, lay, dir, iter, 0), cell_scratch_cell,
+                cell_dst_iter, amx_scratchpad));
+#endif
+        return dnnl_success;
+    };
+
     // We run the grid of computation
+    if (rnn.n_wavefront_lanes > 1) {
+        // The cells of the anti-diagonal lay + iter == d only depend on the
+        // cells of the anti-diagonal d - 1, each of them is executed by a
+        // single thread.
+        assert(aprop == prop_kind::forward && !rnn.merge_gemm_layer);
+        for_(int dir = 0; dir < rnn.n_dir; dir++)
+        for (int d = 0; d < rnn.n_layer + rnn.n_iter - 1; d++) {
+            const int lay_start = nstl::max(0, d - rnn.n_iter + 1);
+            const int lay_end = nstl::min(rnn.n_layer, d + 1);
+            const int ncells = lay_end - lay_start;
+            std::atomic<dnnl_status_t> st(dnnl_success);
+            parallel(nstl::min(ncells, rnn.n_wavefront_lanes),
+                    [&](const int ithr, const int nthr) {
+                        for (int c = ithr; c < ncells; c += nthr) {
+                            const int lay = lay_start + c;
+                            const dnnl_status_t st_cell
+                                    = compute_cell(dir, lay, d - lay, ithr);
+                            if (st_cell != dnnl_success) st = st_cell;
+                        }
+                    });
+            CHECK(st);
+        }
+        return dnnl_success;
+    }
+
     for_(int dir = 0; dir < rnn.n_dir; dir++)
     for (int j = 0; j < rnn.n_layer; j++) {
         const int lay = (aprop == prop_kind::forward) ? j : rnn.n_layer - j - 1;
@@ -262,155 +470,8 @@ rnn_grid_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
 
         // TODO: enable merging projection gemm in bwd lstm projection
 
-        for (int i = 0; i < rnn.n_iter; i++) {
-            const int iter
-                    = (aprop == prop_kind::forward) ? i : rnn.n_iter - i - 1;
-
-            // We set parameters to the cell execution call
-
-            // dst_layer is equal to dst_iter. To avoid
-            // duplication of memory access we hence use only
-            // dst_layer and set dst_iter to nullptr, unless we
-            // cannot for one of the following condition:
-            // - in the last layer and last iteration, we need to
-            //   copy ht in two tensors (dst_layer and dst_iter)
-            dst_layer_t *cell_dst_layer
-                    = &(ws_states_layer(lay + 1, dir, iter + 1, 0));
-            dst_iter_t *cell_dst_iter = nullptr;
-            const src_layer_t *cell_src_layer
-                    = &(ws_states_layer(lay, dir, iter + 1, 0));
-            const src_iter_t *cell_src_iter
-                    = &(ws_states_iter(lay + 1, dir, iter, 0));
-
-            void *cell_dst_iter_c = const_cast<void *>(
-                    ws_states_iter_c(lay + 1, dir, iter + 1, 0));
-            const void *cell_src_iter_c
-                    = ws_states_iter_c(lay + 1, dir, iter, 0);
-
-            // the cell_position is used only when skip_data_copy is
-            // supported currently supported only for forward
-            cell_position_t cell_position = middle_cell;
-            if (iter == 0) cell_position |= first_iter;
-            if (lay == 0) cell_position |= first_layer;
-            if (iter == rnn.n_iter - 1) cell_position |= last_iter;
-            if (lay == rnn.n_layer - 1) cell_position |= last_layer;
-
-            // The dst_* paths should be before the src_* paths as
-            // the later will override cell_src_layer and
-            // cell_src_iter appropriately for 1st layer and 1st
-            // iter.
-            const bool last_iter_skip_copy
-                    = rnn.skip_dst_iter_copy() && (cell_position & last_iter);
-            if (last_iter_skip_copy) {
-                cell_dst_layer = dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0);
-                cell_src_layer
-                        = dst_iter_ + dst_iter_mdw.off(lay - 1, dir, 0, 0);
-            }
-
-            if (rnn.skip_dst_layer_copy() && (cell_position & last_layer)) {
-                // Note: for last layer and last iter, the output is in dst_layer
-                // and still need to be copied to dst_iter
-                cell_dst_layer = dst_layer_ + dst_layer_mdw.off(iter, 0, 0);
-                cell_dst_iter = last_iter_skip_copy
-                        ? dst_iter_ + dst_iter_mdw.off(lay, dir, 0, 0)
-                        : nullptr;
-                cell_src_iter = (iter != 0)
-                        ? dst_layer_ + dst_layer_mdw.off(iter - 1, 0, 0)
-                        : cell_src_iter;
-            }
-            if (rnn.skip_src_iter_copy() && (cell_position & first_iter))
-                cell_src_iter = src_iter_ + src_iter_mdw.off(lay, dir, 0, 0);
-
-            if (rnn.skip_src_layer_copy() && (cell_position & first_layer))
-                cell_src_layer = src_layer_ + src_layer_mdw.off(iter, 0, 0);
-
-            // because the c state is always f32 and require no
-            // conversion, we can always skip to copy for the 1st
-            // and last iteration
-            if (iter == 0 && src_iter_c_) {
-                cell_src_iter_c = inc_ptr(src_iter_c_, rnn.src_iter_c_dt,
-                        src_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_first_iter;
-            }
-            if (iter == rnn.n_iter - 1 && dst_iter_c_) {
-                cell_dst_iter_c = inc_ptr(dst_iter_c_, rnn.dst_iter_c_dt,
-                        dst_iter_c_mdw.off(lay, dir, 0, 0));
-                cell_position |= c_state_last_iter;
-            }
-            const size_t sg_start_idx = rnn.n_iter_scratch_gates == 1
-                    ? static_cast<size_t>(0)
-                    : static_cast<size_t>(iter) * rnn.scratch_gates_nld
-                            * rnn.scratch_gates_ld;
-            const auto cell_scratch_gates = &scratch_gates_[sg_start_idx];
-
-            dst_iter_t *proj_ht = nullptr;
-            if (rnn.is_lstm_projection) {
-                if (rnn.is_training)
-                    proj_ht = &(ws_ht(lay, dir, iter, 0));
-                else
-                    proj_ht = scratch_ht_;
-            }
-
-#if DNNL_X64
-            CHECK((this->*cell_func)(ctx, rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    scratch_gates_blocked_, scratch_src_layer_,
-                    scratch_src_iter_, cell_dst_iter, amx_scratchpad,
-                    addr_batch_global));
-#else
-            CHECK((this->*cell_func)(rnn, cell_position, cell_dst_layer,
-                    cell_dst_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay, dir, iter, 0),
-                    SAFE_PTR(diff_augru_attention, iter, 0, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter, 0),
-                    SAFE_PTR(weights_layer, lay, dir, 0),
-                    SAFE_PTR(weights_iter, lay, dir, 0),
-                    SAFE_PTR(weights_projection, lay, dir),
-                    SAFE_PTR(weights_peephole, lay, dir, 0),
-                    w_proj_comp ? w_proj_comp + (j * rnn.n_dir + dir) * rnn.dic
-                                : nullptr,
-                    bias(lay, dir), cell_src_layer,
-                    SAFE_PTR(augru_attention, iter, 0, 0), cell_src_iter,
-                    cell_src_iter_c,
-                    SAFE_PTR(ws_diff_states_layer, lay + 1, dir, iter, 0),
-                    SAFE_PTR(ws_diff_states_iter, lay, dir, iter + 1, 0),
-                    SAFE_PTR(ws_diff_states_iter_c, lay, dir, iter + 1, 0),
-                    SAFE_PTR(diff_weights_layer, lay, dir, 0),
-                    SAFE_PTR(diff_weights_iter, lay, dir, 0),
-                    SAFE_PTR(diff_weights_projection, lay, dir, 0),
-                    SAFE_PTR(diff_weights_peephole, lay, dir, 0),
-                    SAFE_PTR(diff_bias, lay, dir, 0),
-                    SAFE_PTR(ws_gates, lay, dir, iter, 0), cell_scratch_gates,
-                    proj_ht, scratch_diff_ht_,
-                    SAFE_PTR(ws_grid, lay, dir, iter, 0), scratch_cell_,
-                    cell_dst_iter, amx_scratchpad));
-#endif
-        }
+        for (int i = 0; i < rnn.n_iter; i++)
+            CHECK(compute_cell(dir, j, i, 0));
 
         CHECK(compute_merged_layer_part_if_applicable(
                 prop_kind::backward, dir, lay));
@@ -494,6 +494,7 @@ struct _ref_rnn_common_t : public primitive_t {
             status_t st = init_brgemm(engine);
             if (st != status::success) {
                 rnn_.is_brgemm = false;
+                rnn_.n_wavefront_lanes = 1;
                 st = init_ref(engine);
             }
             if (st == status::success) {
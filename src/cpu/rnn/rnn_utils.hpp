@@ -379,6 +379,13 @@ struct rnn_conf_t {
          force_nocopy = false, use_layer_packed_gemm = false,
          use_iter_packed_gemm = false, use_projection_packed_gemm = false;
     int n_iter_scratch_gates = 0;
+    // Number of cells of a layer x iteration anti-diagonal executed
+    // concurrently, each with its own copy of the cell scratch buffers.
+    // 1 means the grid is executed cell by cell.
+    int n_wavefront_lanes = 1;
+    // A cell executed by a wavefront lane runs on the thread of the lane: the
+    // per-thread brgemm buffers of the other threads belong to other lanes.
+    dim_t cell_nthr() const { return n_wavefront_lanes > 1 ? 1 : nthr; }
 
     bool diff_weights_overwrite = false;
 
@@ -1117,9 +1124,9 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
     rnn.scratch_gates_size = sizeof(typename T::scratch_t)
             * rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
-            * rnn.scratch_gates_ld;
-    rnn.scratch_ht_size
-            = sizeof(typename T::ht_t) * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
+            * rnn.scratch_gates_ld * rnn.n_wavefront_lanes;
+    rnn.scratch_ht_size = sizeof(typename T::ht_t) * rnn.scratch_ht_nld
+            * rnn.scratch_ht_ld * rnn.n_wavefront_lanes;
     rnn.scratch_diff_ht_size = rnn.is_training ? sizeof(typename T::gemm_acc_t)
                     * rnn.scratch_diff_ht_nld * rnn.scratch_diff_ht_ld
                                                : (size_t)0;
@@ -1135,6 +1142,7 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
                                     * rnn.ws_states_layer_ld
                                     * sizeof(typename T::gemm_acc_t)
                             : 0);
+    rnn.scratch_cell_size *= rnn.n_wavefront_lanes;
     /// workspace needed for lbr GRU
     rnn.ws_per_cell = (size_t)rnn.is_lbr * rnn.mb * rnn.dhc
             * sizeof(typename T::gemm_acc_t);
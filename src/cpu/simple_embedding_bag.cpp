@@ -0,0 +1,250 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/simple_embedding_bag.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+using namespace data_type;
+
+namespace {
+
+// The number of indices between a row being prefetched and being pooled.
+constexpr dim_t prefetch_distance = 8;
+
+void prefetch(const void *ptr, size_t size) {
+#if defined(__GNUC__)
+    const char *p = static_cast<const char *>(ptr);
+    for (size_t i = 0; i < size; i += platform::get_cache_line_size())
+        __builtin_prefetch(p + i);
+#else
+    UNUSED(ptr);
+    UNUSED(size);
+#endif
+}
+
+// Returns row `row` of the table converted to f32 and dequantized. The row is
+// converted into `buf` unless the table is f32.
+const float *load_row(data_type_t dt, const void *src, dim_t row, dim_t len,
+        float scale, int zero_point, float *buf) {
+    const dim_t off = row * len;
+    switch (dt) {
+        case f32: return static_cast<const float *>(src) + off;
+        case bf16:
+            cvt_bfloat16_to_float(
+                    buf, static_cast<const bfloat16_t *>(src) + off, len);
+            return buf;
+        case f16:
+            cvt_float16_to_float(
+                    buf, static_cast<const float16_t *>(src) + off, len);
+            return buf;
+        case s8: {
+            const int8_t *s = static_cast<const int8_t *>(src) + off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; ++i)
+                buf[i] = (float)(s[i] - zero_point) * scale;
+            return buf;
+        }
+        case u8: {
+            const uint8_t *s = static_cast<const uint8_t *>(src) + off;
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; ++i)
+                buf[i] = (float)(s[i] - zero_point) * scale;
+            return buf;
+        }
+        default:
+            // Int4 rows may start in the middle of a byte.
+            for (dim_t i = 0; i < len; ++i)
+                buf[i] = (float)(io::load_int_value(dt, src, off + i)
+                                 - zero_point)
+                        * scale;
+            return buf;
+    }
+}
+
+} // namespace
+
+bool simple_embedding_bag_t::pd_t::attr_qparams_ok() const {
+    const bool is_int = utils::one_of(src_md()->data_type, s8, u8, s4, u4);
+
+    const auto &scales = attr()->scales_;
+    bool ok = scales.has_default_values({DNNL_ARG_SRC});
+    if (!scales.get(DNNL_ARG_SRC).has_default_values())
+        ok = ok && is_int
+                && utils::one_of(scales.get(DNNL_ARG_SRC).mask_, 0, 1);
+
+    const auto &zero_points = attr()->zero_points_;
+    ok = ok && zero_points.has_default_values(DNNL_ARG_WEIGHTS)
+            && zero_points.has_default_values(DNNL_ARG_DST);
+    if (!zero_points.has_default_values(DNNL_ARG_SRC))
+        ok = ok && is_int
+                && utils::one_of(zero_points.get(DNNL_ARG_SRC), 0, 1);
+    return ok;
+}
+
+status_t simple_embedding_bag_t::pd_t::init(engine_t *engine) {
+    using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+    const data_type_t src_dt = src_md()->data_type;
+    const data_type_t dst_dt = dst_md()->data_type;
+    VDISPATCH_EMBEDDING_BAG(
+            utils::one_of(src_dt, f32, bf16, f16, s8, u8, s4, u4),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(
+            utils::one_of(dst_dt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(platform::has_data_type_support(src_dt)
+                    && platform::has_data_type_support(dst_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_EMBEDDING_BAG(
+            attr()->has_default_values(skip_mask_t::scales_runtime
+                    | skip_mask_t::zero_points_runtime),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_EMBEDDING_BAG(attr_qparams_ok(), VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VDISPATCH_EMBEDDING_BAG(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+
+    using namespace format_tag;
+    VDISPATCH_EMBEDDING_BAG(memory_desc_matches_tag(*src_md(0), ab)
+                    && memory_desc_matches_tag(*src_md(1), a)
+                    && memory_desc_matches_tag(*src_md(2), a)
+                    && memory_desc_matches_tag(*dst_md(), ab),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    nthr_ = dnnl_get_max_threads();
+    init_scratchpad();
+
+    return status::success;
+}
+
+void simple_embedding_bag_t::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    // A converted table row and a destination row accumulator per thread,
+    // padded to avoid false sharing.
+    const dim_t len = utils::rnd_up(emb_dim(), 16);
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_embedding_bag_acc, 2 * len * nthr_);
+}
+
+status_t simple_embedding_bag_t::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_INDICES);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_OFFSETS);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+    DEFINE_ZERO_POINTS_BUFFER(src_zero_points, DNNL_ARG_SRC);
+
+    const auto *attr = pd()->attr();
+    const bool row_scales = attr->scales_.get(DNNL_ARG_SRC).mask_ != 0;
+    const bool row_zero_points = attr->zero_points_.get(DNNL_ARG_SRC) != 0;
+
+    const data_type_t src_dt = pd()->src_md()->data_type;
+    const data_type_t dst_dt = pd()->dst_md()->data_type;
+    const alg_kind_t alg = pd()->alg_kind();
+    const dim_t len = pd()->emb_dim();
+    const dim_t n_indices = pd()->n_indices();
+    const dim_t n_bags = pd()->n_bags();
+    // Rows are addressed in bits to account for int4 tables.
+    const dim_t bits = utils::one_of(src_dt, s4, u4)
+            ? 4
+            : 8 * (dim_t)types::data_type_size(src_dt);
+    const size_t row_bytes = utils::div_up(len * bits, 8);
+    const auto prefetch_row = [&](dim_t row) {
+        prefetch(static_cast<const char *>(src) + row * len * bits / 8,
+                row_bytes);
+    };
+
+    const dim_t pad_len = utils::rnd_up(len, 16);
+    float *scratch = ctx.get_scratchpad_grantor().template get<float>(
+            key_embedding_bag_acc);
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(n_bags, nthr, ithr, start, end);
+        if (start == end) return;
+
+        float *buf = scratch + 2 * pad_len * ithr;
+        float *acc_buf = buf + pad_len;
+
+        for (dim_t b = start; b < end; ++b) {
+            const dim_t first = offsets[b];
+            const dim_t last = b + 1 < n_bags ? offsets[b + 1] : n_indices;
+            float *acc = dst_dt == f32 ? static_cast<float *>(dst) + b * len
+                                       : acc_buf;
+
+            const dim_t warmup = nstl::min(first + prefetch_distance, last);
+            for (dim_t i = first; i < warmup; ++i)
+                prefetch_row(indices[i]);
+
+            for (dim_t i = first; i < last; ++i) {
+                if (i + prefetch_distance < last)
+                    prefetch_row(indices[i + prefetch_distance]);
+
+                const dim_t row = indices[i];
+                const float *r = load_row(src_dt, src, row, len,
+                        src_scales[row_scales ? row : 0],
+                        src_zero_points[row_zero_points ? row : 0], buf);
+                if (i == first) {
+                    utils::array_copy(acc, r, len);
+                } else if (alg == alg_kind::reduction_max) {
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t d = 0; d < len; ++d)
+                        acc[d] = nstl::max(acc[d], r[d]);
+                } else {
+                    PRAGMA_OMP_SIMD()
+                    for (dim_t d = 0; d < len; ++d)
+                        acc[d] += r[d];
+                }
+            }
+
+            // Empty bags produce zeros.
+            if (first >= last) {
+                utils::array_set(acc, 0.f, len);
+            } else if (alg == alg_kind::reduction_mean) {
+                const float inv_count = 1.f / (last - first);
+                PRAGMA_OMP_SIMD()
+                for (dim_t d = 0; d < len; ++d)
+                    acc[d] *= inv_count;
+            }
+
+            if (dst_dt != f32)
+                types::cvt_from_float(dst_dt,
+                        static_cast<char *>(dst)
+                                + b * len * types::data_type_size(dst_dt),
+                        acc, len);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
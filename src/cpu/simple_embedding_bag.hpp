@@ -0,0 +1,60 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_EMBEDDING_BAG_HPP
+#define CPU_SIMPLE_EMBEDDING_BAG_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_embedding_bag_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Embedding bag over a plain table. Bags are distributed between threads and
+// the rows of a bag are prefetched a few indices ahead of their use.
+struct simple_embedding_bag_t : public primitive_t {
+    struct pd_t : public cpu_embedding_bag_pd_t {
+        using cpu_embedding_bag_pd_t::cpu_embedding_bag_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_embedding_bag_t);
+
+        status_t init(engine_t *engine);
+
+        int nthr_ = 0;
+
+    private:
+        bool attr_qparams_ok() const;
+        void init_scratchpad();
+    };
+
+    simple_embedding_bag_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -14,6 +14,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
 #include "cpu/x64/amx_tile_configure.hpp"
 #include "cpu/x64/jit_generator.hpp"
 
@@ -26,16 +31,38 @@ struct jit_amx_tilecfg_t : public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_amx_tilecfg_t)
 
     // TODO: Need to check status
-    jit_amx_tilecfg_t()
+    jit_amx_tilecfg_t(bool lazy)
         : jit_generator(
-                jit_name(), nullptr, MAX_CODE_SIZE, true, avx512_core_amx) {
+                jit_name(), nullptr, MAX_CODE_SIZE, true, avx512_core_amx)
+        , lazy_(lazy) {
         create_kernel();
     }
 
     void tile_configure(const char *palette) const { (*this)(palette); }
 
 private:
+    const bool lazy_;
+
     void generate() override {
+        if (lazy_) {
+            // Storing and comparing the current configuration is much
+            // cheaper than ldtilecfg, which also zeroes the tiles. Reading
+            // it back from the hardware rather than caching the last palette
+            // keeps it correct if the tiles were configured or released
+            // outside of this function.
+            Xbyak::Label load;
+            sub(rsp, AMX_PALETTE_SIZE);
+            sttilecfg(ptr[rsp]);
+            for (size_t i = 0; i < AMX_PALETTE_SIZE; i += sizeof(uint64_t)) {
+                mov(rax, ptr[rsp + i]);
+                cmp(rax, ptr[abi_param1 + i]);
+                jne(load, T_NEAR);
+            }
+            add(rsp, AMX_PALETTE_SIZE);
+            ret();
+            L(load);
+            add(rsp, AMX_PALETTE_SIZE);
+        }
         ldtilecfg(ptr[abi_param1]);
         ret();
     }
@@ -60,8 +87,53 @@ private:
     }
 };
 
+namespace {
+// Number of threads that left their tiles configured in
+// amx_tile_maybe_release(). The threads of other teams or streams may still
+// have a pending release after a thread released its own, so the count is
+// only decremented by the release of a thread or when a thread exits.
+std::atomic<int> n_tile_release_pending {0};
+// Incremented every time a thread defers a release. A deferred release that
+// leaves pending releases behind (those of the threads outside of the team)
+// records the value, so that the next calls do not start a parallel region
+// until a thread defers a release again.
+std::atomic<size_t> tile_release_epoch {0};
+std::atomic<size_t> tile_release_drained_epoch {0};
+
+struct tile_release_state_t {
+    bool pending = false;
+    ~tile_release_state_t() {
+        if (pending) n_tile_release_pending--;
+    }
+};
+thread_local tile_release_state_t tile_release_state;
+
+// Only the OpenMP runtime lets the deferred release reach every thread of the
+// team. The workers of the other runtimes would keep their tiles configured
+// until they exit, so the release is never deferred there.
+bool is_tile_release_deferred() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    static const bool deferred
+            = getenv_int_user("AMX_DEFER_TILE_RELEASE", 1) != 0;
+    return deferred;
+#else
+    return false;
+#endif
+}
+
+void release_if_pending() {
+    if (tile_release_state.pending) amx_tile_release();
+}
+} // namespace
+
 status_t amx_tile_configure(const char palette[AMX_PALETTE_SIZE]) {
-    static const jit_amx_tilecfg_t tilecfg;
+    static const jit_amx_tilecfg_t tilecfg(false);
+    tilecfg.tile_configure(palette);
+    return status::success;
+};
+
+status_t amx_tile_lazy_configure(const char palette[AMX_PALETTE_SIZE]) {
+    static const jit_amx_tilecfg_t tilecfg(true);
     tilecfg.tile_configure(palette);
     return status::success;
 };
@@ -69,9 +141,42 @@ status_t amx_tile_configure(const char palette[AMX_PALETTE_SIZE]) {
 status_t amx_tile_release() {
     static const jit_amx_tilerelease_t tilerls;
     tilerls.tile_release();
+    if (tile_release_state.pending) {
+        tile_release_state.pending = false;
+        n_tile_release_pending--;
+    }
     return status::success;
 };
 
+status_t amx_tile_maybe_release() {
+    if (!is_tile_release_deferred()) return amx_tile_release();
+    if (!tile_release_state.pending) {
+        tile_release_state.pending = true;
+        n_tile_release_pending++;
+        tile_release_epoch++;
+    }
+    return status::success;
+}
+
+status_t amx_tile_release_deferred() {
+    const int n_pending = n_tile_release_pending;
+    if (n_pending == 0) return status::success;
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    // Each thread of the OpenMP team runs the function exactly once. The
+    // region is skipped when the only pending release is the one of the
+    // calling thread, or when no thread deferred a release since the last
+    // region, i.e. the pending releases belong to threads outside of the team.
+    const size_t epoch = tile_release_epoch;
+    const bool only_self = n_pending == 1 && tile_release_state.pending;
+    if (!only_self && epoch != tile_release_drained_epoch) {
+        parallel(0, [](int, int) { release_if_pending(); });
+        tile_release_drained_epoch = epoch;
+    }
+#endif
+    release_if_pending();
+    return status::success;
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
@@ -26,7 +26,22 @@ namespace x64 {
 
 static constexpr size_t AMX_PALETTE_SIZE = 64;
 status_t DNNL_API amx_tile_configure(const char palette[AMX_PALETTE_SIZE]);
+// Same as amx_tile_configure() but does nothing if @p palette is already the
+// tile configuration of the calling thread.
+status_t DNNL_API amx_tile_lazy_configure(
+        const char palette[AMX_PALETTE_SIZE]);
 status_t DNNL_API amx_tile_release();
+// Called by primitives at the end of the execution on each thread that used
+// the tiles. With the OpenMP runtime and unless
+// ONEDNN_AMX_DEFER_TILE_RELEASE=0, the tiles are left configured so that the
+// next execution with the same palette skips the configuration, and are
+// released later by amx_tile_release_deferred(). With other runtimes the
+// tiles are released immediately.
+status_t DNNL_API amx_tile_maybe_release();
+// Releases the tiles left configured by amx_tile_maybe_release() on all the
+// threads of the OpenMP team. The pending releases of the threads outside of
+// the team are kept for their own call.
+status_t DNNL_API amx_tile_release_deferred();
 
 } // namespace x64
 } // namespace cpu
@@ -118,9 +118,13 @@ struct brgemm_palette_container_t {
     bool insert(int idx, const brgemm_t *brg);
     bool insert(int idx, const brgemm_t &brg) { return insert(idx, &brg); }
 
+    // The first configuration on a thread (idx < 0) may find the palette
+    // left configured by a previous execution, see amx_tile_maybe_release().
     inline void maybe_tile_configure(bool is_amx, int &idx, int new_idx) const {
         if (idx == new_idx) return;
-        if (is_amx && (idx < 0 || refs_[idx] != refs_[new_idx]))
+        if (is_amx && idx < 0)
+            amx_tile_lazy_configure(refs_[new_idx]->data());
+        else if (is_amx && refs_[idx] != refs_[new_idx])
             amx_tile_configure(refs_[new_idx]->data());
         idx = new_idx;
     }
@@ -96,6 +96,151 @@ struct jit_brgemm_kernel_t : public jit_generator {
 
     brgemm_t brg;
 
+    bool serialize_cache_key(serialization_stream_t &key) const override {
+        // Post-ops depend on the primitive attributes, and the sum is applied
+        // using the addresses of the descriptor fields.
+        if (brg.with_eltwise || brg.with_binary || brg.with_sum) return false;
+
+        // All non-pointer fields of the descriptor, including the derived
+        // ones, see brgemm_cmp().
+#define WRITE_BRG_FIELD(x) key.write(&brg.x)
+        WRITE_BRG_FIELD(bcast_dim);
+        WRITE_BRG_FIELD(load_dim);
+        WRITE_BRG_FIELD(reduce_dim);
+        WRITE_BRG_FIELD(LDA);
+        WRITE_BRG_FIELD(LDB);
+        WRITE_BRG_FIELD(LDC);
+        WRITE_BRG_FIELD(LDD);
+        WRITE_BRG_FIELD(isa_user);
+        WRITE_BRG_FIELD(isa_impl);
+        WRITE_BRG_FIELD(alpha);
+        WRITE_BRG_FIELD(beta);
+        WRITE_BRG_FIELD(dt_a);
+        WRITE_BRG_FIELD(dt_c);
+        WRITE_BRG_FIELD(dt_b);
+        WRITE_BRG_FIELD(dt_d);
+        WRITE_BRG_FIELD(dt_bias);
+        WRITE_BRG_FIELD(stride_a);
+        WRITE_BRG_FIELD(stride_b);
+        WRITE_BRG_FIELD(layout);
+        WRITE_BRG_FIELD(type);
+        WRITE_BRG_FIELD(is_dgmm);
+        WRITE_BRG_FIELD(req_cal_comp_pads);
+        WRITE_BRG_FIELD(req_comp_pads_with_bcast);
+        WRITE_BRG_FIELD(with_scales);
+        WRITE_BRG_FIELD(zp_type_a);
+        WRITE_BRG_FIELD(zp_type_b);
+        WRITE_BRG_FIELD(zp_type_c);
+        WRITE_BRG_FIELD(is_oc_scale);
+        WRITE_BRG_FIELD(with_dst_scales);
+        WRITE_BRG_FIELD(brgattr.max_bs);
+        WRITE_BRG_FIELD(brgattr.max_top_vpad);
+        WRITE_BRG_FIELD(brgattr.max_bottom_vpad);
+        WRITE_BRG_FIELD(brgattr.max_top_bpad);
+        WRITE_BRG_FIELD(brgattr.max_bottom_bpad);
+        WRITE_BRG_FIELD(brgattr.hint_expected_A_size);
+        WRITE_BRG_FIELD(brgattr.hint_expected_B_size);
+        WRITE_BRG_FIELD(brgattr.hint_expected_C_size);
+        WRITE_BRG_FIELD(brgattr.hint_innermost_loop);
+        WRITE_BRG_FIELD(brgattr.hint_loop_order);
+        WRITE_BRG_FIELD(brgattr.hint_prefetching);
+        WRITE_BRG_FIELD(brgattr.hint_prfA.dist1);
+        WRITE_BRG_FIELD(brgattr.hint_prfA.dist2);
+        WRITE_BRG_FIELD(brgattr.hint_prfB.dist1);
+        WRITE_BRG_FIELD(brgattr.hint_prfB.dist2);
+        WRITE_BRG_FIELD(brgattr.hint_prfC.dist1);
+        WRITE_BRG_FIELD(brgattr.hint_prfC.dist2);
+        WRITE_BRG_FIELD(brgattr.wary_tail_read);
+        WRITE_BRG_FIELD(brgattr.generate_skip_accumulation);
+        WRITE_BRG_FIELD(brgattr.bd_mask_level);
+        WRITE_BRG_FIELD(brgattr.use_uker);
+        WRITE_BRG_FIELD(brgattr.use_interleave_stores);
+        WRITE_BRG_FIELD(brgattr.fpmath_mode);
+        WRITE_BRG_FIELD(brgattr.LDA2);
+        WRITE_BRG_FIELD(brgattr.LDB2);
+        WRITE_BRG_FIELD(brgattr.LDC2_M);
+        WRITE_BRG_FIELD(brgattr.LDC2_N);
+        WRITE_BRG_FIELD(brgattr.var_bs);
+        WRITE_BRG_FIELD(brgattr.postops_only);
+        WRITE_BRG_FIELD(brgattr.bs_group);
+        WRITE_BRG_FIELD(brgattr.hint_bd_block);
+        WRITE_BRG_FIELD(brgattr.hint_ld_block);
+        WRITE_BRG_FIELD(brgattr.hint_bd_block2);
+        WRITE_BRG_FIELD(brgattr.hint_ld_block2);
+        WRITE_BRG_FIELD(brgattr.hint_ununroll_bd_loop);
+        WRITE_BRG_FIELD(brgattr.hint_load_nt_A);
+        WRITE_BRG_FIELD(brgattr.hint_load_nt_B);
+        WRITE_BRG_FIELD(brgattr.K_koef);
+        WRITE_BRG_FIELD(LDA2);
+        WRITE_BRG_FIELD(LDB2);
+        WRITE_BRG_FIELD(LDC2_M);
+        WRITE_BRG_FIELD(LDC2_N);
+        WRITE_BRG_FIELD(is_blocked);
+        WRITE_BRG_FIELD(bdb);
+        WRITE_BRG_FIELD(bd_block);
+        WRITE_BRG_FIELD(bdb_tail);
+        WRITE_BRG_FIELD(bdb2);
+        WRITE_BRG_FIELD(bd_block2);
+        WRITE_BRG_FIELD(bdb2_tail);
+        WRITE_BRG_FIELD(ldb);
+        WRITE_BRG_FIELD(ld_block);
+        WRITE_BRG_FIELD(ldb_tail);
+        WRITE_BRG_FIELD(ldb2);
+        WRITE_BRG_FIELD(ld_block2);
+        WRITE_BRG_FIELD(ldb2_tail);
+        WRITE_BRG_FIELD(rdb);
+        WRITE_BRG_FIELD(rd_block);
+        WRITE_BRG_FIELD(rdb_tail);
+        WRITE_BRG_FIELD(rd_step);
+        WRITE_BRG_FIELD(ld_step);
+        WRITE_BRG_FIELD(typesize_A);
+        WRITE_BRG_FIELD(typesize_B);
+        WRITE_BRG_FIELD(typesize_C);
+        WRITE_BRG_FIELD(typesize_D);
+        WRITE_BRG_FIELD(typesize_bias);
+        WRITE_BRG_FIELD(is_ymm);
+        WRITE_BRG_FIELD(is_zmm);
+        WRITE_BRG_FIELD(is_tmm);
+        WRITE_BRG_FIELD(is_int8);
+        WRITE_BRG_FIELD(is_int8_tmm);
+        WRITE_BRG_FIELD(is_bf16);
+        WRITE_BRG_FIELD(is_bf16_tmm);
+        WRITE_BRG_FIELD(is_bf16_emu);
+        WRITE_BRG_FIELD(is_f16);
+        WRITE_BRG_FIELD(is_f16_tmm);
+        WRITE_BRG_FIELD(is_f32);
+        WRITE_BRG_FIELD(is_bf32);
+        WRITE_BRG_FIELD(has_int8_vnni);
+        WRITE_BRG_FIELD(load_nt_A);
+        WRITE_BRG_FIELD(load_nt_B);
+        WRITE_BRG_FIELD(embd_bcst);
+        WRITE_BRG_FIELD(with_bias);
+        WRITE_BRG_FIELD(req_s8s8_compensation);
+        WRITE_BRG_FIELD(with_weights_scale_adjust);
+        WRITE_BRG_FIELD(innermost_loop);
+        WRITE_BRG_FIELD(is_M_tail);
+        WRITE_BRG_FIELD(interleave_tilestores_);
+        WRITE_BRG_FIELD(prfA.dist1);
+        WRITE_BRG_FIELD(prfA.dist2);
+        WRITE_BRG_FIELD(prfB.dist1);
+        WRITE_BRG_FIELD(prfB.dist2);
+        WRITE_BRG_FIELD(prfC.dist1);
+        WRITE_BRG_FIELD(prfC.dist2);
+        WRITE_BRG_FIELD(is_runtime_lda);
+        WRITE_BRG_FIELD(is_runtime_ldb);
+        WRITE_BRG_FIELD(is_runtime_ldc);
+        WRITE_BRG_FIELD(is_runtime_ldd);
+#undef WRITE_BRG_FIELD
+        if (brg.brgattr.bd_mask_level > 0)
+            key.write(brg.brgattr.bd_mask, brg.bcast_dim);
+        if (brg.type == brgemm_static_offs)
+            for (int i = 0; i < brg.brgattr.max_bs; i++) {
+                key.write(&brg.brgattr.static_offsets[i].offset.A);
+                key.write(&brg.brgattr.static_offsets[i].offset.B);
+            }
+        return true;
+    }
+
 private:
     using Vmm =
             typename utils::conditional<std::is_same<Wmm, Xbyak::Tmm>::value,
@@ -541,7 +541,7 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
             last_g = g; \
             nd_iterator_step(__VA_ARGS__); \
         } \
-        if (is_amx) amx_tile_release(); \
+        if (is_amx) amx_tile_maybe_release(); \
     });
 
         if (jcp.loop_order == loop_ndhwgc)
@@ -580,7 +580,7 @@ status_t brgemm_1x1_convolution_fwd_t<isa>::execute_forward_all(
             } \
             nd_iterator_step(__VA_ARGS__); \
         } \
-        if (is_amx) amx_tile_release(); \
+        if (is_amx) amx_tile_maybe_release(); \
     });
 
         if (jcp.loop_order == loop_ndhwgc)
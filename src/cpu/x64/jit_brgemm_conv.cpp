@@ -1450,7 +1450,7 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
             else
                 assert(!"Unknown loop order");
         }
-        if (is_amx) { amx_tile_release(); }
+        if (is_amx) { amx_tile_maybe_release(); }
     });
 
     if (_pd->wants_zero_pad_dst()) ctx.memory(DNNL_ARG_DST)->zero_pad(ctx);
@@ -862,7 +862,7 @@ status_t brgemm_convolution_bwd_strided_t<isa, is_deconv>::execute(
             else
                 assert(!"Unknown loop order");
         }
-        if (is_amx) { amx_tile_release(); }
+        if (is_amx) { amx_tile_maybe_release(); }
     });
 
     return status::success;
@@ -1476,7 +1476,7 @@ void brgemm_convolution_bwd_weights_t::execute_backward_weights(
             default: assert(!"Invalid harness type");
         }
 
-        amx_tile_release();
+        amx_tile_maybe_release();
     });
 
     if (!jcp.global_transpose) {
@@ -500,7 +500,7 @@ status_t brgemm_inner_product_fwd_t<isa>::execute_forward(
                     break;
             }
         }
-        if (is_amx) amx_tile_release();
+        if (is_amx) amx_tile_maybe_release();
     });
 
     if (jbgp.nthr_ic_b > 1) {
@@ -966,7 +966,7 @@ void brgemm_inner_product_bwd_data_t<isa>::execute_backward_data(
             nd_iterator_step(osc, os_chunks, kd, jbgp.kd, kh, jbgp.kh, kw,
                     jbgp.kw, icb, jbgp.nb_ic);
         }
-        if (is_amx) amx_tile_release();
+        if (is_amx) amx_tile_maybe_release();
     });
 
     if (jbgp.nthr_oc_b > 1) {
@@ -1657,7 +1657,7 @@ void brgemm_inner_product_bwd_weights_t<isa>::compute_diff_weights_and_bias(
                         osc_idx, osc_work);
         };
     }
-    if (jbgp.is_amx) amx_tile_release();
+    if (jbgp.is_amx) amx_tile_maybe_release();
 }
 
 template <cpu_isa_t isa>
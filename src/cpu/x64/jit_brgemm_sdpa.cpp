@@ -0,0 +1,602 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+using namespace Xbyak;
+
+namespace {
+
+// Per-thread chunks of the scratchpad are aligned to a cache line.
+size_t thr_chunk_size(dim_t nelems, size_t data_size) {
+    return rnd_up((size_t)nelems * data_size, (size_t)64);
+}
+
+// Reads the elements of a plain tensor converting them to f32.
+struct tensor_reader_t {
+    tensor_reader_t(const memory_desc_t &md, const void *ptr,
+            const sdpa_quant_t &quant)
+        : ptr_(ptr)
+        , dt_(md.data_type)
+        , offset0_(md.offset0)
+        , strides_(md.format_desc.blocking.strides)
+        , is_int8_(one_of(md.data_type, s8, u8))
+        , scale_(quant.scale)
+        , zero_point_((float)quant.zero_point) {}
+
+    dim_t off(dim_t d0, dim_t d1, dim_t d2, dim_t d3) const {
+        return offset0_ + d0 * strides_[0] + d1 * strides_[1]
+                + d2 * strides_[2] + d3 * strides_[3];
+    }
+
+    float operator()(dim_t off) const {
+        const float v = io::load_float_value(dt_, ptr_, off);
+        return is_int8_ ? (v - zero_point_) * scale_ : v;
+    }
+
+private:
+    const void *ptr_;
+    data_type_t dt_;
+    dim_t offset0_;
+    const dim_t *strides_;
+    bool is_int8_;
+    float scale_;
+    float zero_point_;
+};
+
+// Computes the exponents of a row of `len` scores: updates the running
+// maximum of the row, stores exp(score - max) and the sum of the exponents.
+// The row length is a multiple of the simd width, the scores of the padded
+// keys are expected to be -inf. A row of -inf produces NaNs, the caller
+// handles it.
+struct sdpa_softmax_call_params_t {
+    const float *src;
+    void *dst;
+    float *max;
+    float *sum;
+};
+
+template <cpu_isa_t isa>
+struct jit_sdpa_softmax_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sdpa_softmax_kernel_t)
+
+    using call_params_t = sdpa_softmax_call_params_t;
+
+    jit_sdpa_softmax_kernel_t(dim_t len, data_type_t dst_dt)
+        : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , len_(len)
+        , dst_dt_(dst_dt) {}
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    static constexpr int vlen = cpu_isa_traits<isa>::vlen;
+    static constexpr int simd_w = vlen / sizeof(float);
+    // The exponent injector takes its auxiliary registers starting from the
+    // first one.
+    static constexpr int vsrc_start_idx = 4;
+
+    const dim_t len_;
+    const data_type_t dst_dt_;
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector_;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_exp_injector_table = rax;
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_max = r10;
+    Reg64 reg_sum = r11;
+
+    Opmask injector_mask = Opmask(1);
+
+    Vmm vtmp = Vmm(is_superset(isa, avx512_core) ? 29 : 13);
+    Vmm vsum = Vmm(is_superset(isa, avx512_core) ? 30 : 14);
+    Vmm vmax = Vmm(is_superset(isa, avx512_core) ? 31 : 15);
+
+    // Reduces `vsrc` over its lanes, the result is in every lane.
+    void horizontal_op(const Vmm &vsrc, bool is_max) {
+        auto op = [&]() {
+            if (is_max)
+                uni_vmaxps(vsrc, vsrc, vtmp);
+            else
+                uni_vaddps(vsrc, vsrc, vtmp);
+        };
+        if (is_superset(isa, avx512_core)) {
+            const Zmm zsrc(vsrc.getIdx()), ztmp(vtmp.getIdx());
+            vshuff32x4(ztmp, zsrc, zsrc, 0x4E); // 256-bit shuffle
+            op();
+            vshuff32x4(ztmp, zsrc, zsrc, 0xB1); // 128/256-bit shuffle
+            op();
+        } else {
+            const Ymm ysrc(vsrc.getIdx()), ytmp(vtmp.getIdx());
+            vperm2f128(ytmp, ysrc, ysrc, 0x1); // 128/256-bit shuffle
+            op();
+        }
+        uni_vshufps(vtmp, vsrc, vsrc, 0x4E); // 64/128-bit shuffle
+        op();
+        uni_vshufps(vtmp, vsrc, vsrc, 0xB1); // 32/64-bit shuffle
+        op();
+    }
+
+    void store(const Vmm &v, int i) {
+        if (dst_dt_ == bf16) {
+            assert(is_superset(isa, avx512_core));
+            const Ymm ydst(v.getIdx());
+            vcvtneps2bf16(ydst, Zmm(v.getIdx()));
+            vmovdqu16(ptr[reg_dst + i * vlen / 2], ydst);
+        } else {
+            uni_vmovups(ptr[reg_dst + i * vlen], v);
+        }
+    }
+
+    void generate() override {
+        exp_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
+                alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, false,
+                reg_exp_injector_table, injector_mask));
+
+        const int n_vecs = (int)(len_ / simd_w);
+        assert(len_ % simd_w == 0 && vsrc_start_idx + n_vecs <= vtmp.getIdx());
+
+        preamble();
+        exp_injector_->load_table_addr();
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_max, ptr[reg_param + PARAM_OFF(max)]);
+        mov(reg_sum, ptr[reg_param + PARAM_OFF(sum)]);
+#undef PARAM_OFF
+
+        uni_vbroadcastss(vmax, ptr[reg_max]);
+        for (int i = 0; i < n_vecs; i++)
+            uni_vmaxps(vmax, vmax, ptr[reg_src + i * vlen]);
+        horizontal_op(vmax, true);
+        uni_vmovss(ptr[reg_max], Xmm(vmax.getIdx()));
+
+        for (int i = 0; i < n_vecs; i++) {
+            const Vmm v(vsrc_start_idx + i);
+            uni_vmovups(v, ptr[reg_src + i * vlen]);
+            uni_vsubps(v, v, vmax);
+        }
+        exp_injector_->compute_vector_range(
+                vsrc_start_idx, vsrc_start_idx + n_vecs);
+
+        uni_vxorps(vsum, vsum, vsum);
+        for (int i = 0; i < n_vecs; i++) {
+            const Vmm v(vsrc_start_idx + i);
+            uni_vaddps(vsum, vsum, v);
+            store(v, i);
+        }
+        horizontal_op(vsum, false);
+        uni_vmovss(ptr[reg_sum], Xmm(vsum.getIdx()));
+
+        postamble();
+        exp_injector_->prepare_table();
+    }
+};
+
+} // namespace
+
+status_t brgemm_sdpa_t::pd_t::init(engine_t *engine) {
+    VDISPATCH_SDPA(check_shapes(), VERBOSE_INCONSISTENT_PRB);
+    VDISPATCH_SDPA(data_types_ok(), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(
+            set_default_formats() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_SDPA(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    const bool is_bf16 = everyone_is(bf16, desc_.q_desc.data_type,
+            desc_.k_desc.data_type, desc_.v_desc.data_type);
+    if (is_bf16 && mayiuse(avx512_core_bf16)) {
+        isa_ = avx512_core_bf16;
+        comp_dt_ = bf16;
+    } else if (mayiuse(avx512_core)) {
+        isa_ = avx512_core;
+        comp_dt_ = f32;
+    } else if (mayiuse(avx2)) {
+        isa_ = avx2;
+        comp_dt_ = f32;
+    }
+    VDISPATCH_SDPA(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+
+    // The bf16 matrices are packed in the VNNI layout, pairs of elements along
+    // the reduction dimension are adjacent. The rows of scores are padded to
+    // the simd width of avx512 for the softmax kernel.
+    const dim_t vnni_granularity = comp_dt_ == bf16 ? 2 : 1;
+    m_blk_ = nstl::min<dim_t>(32, queries());
+    n_blk_ = nstl::min<dim_t>(64, rnd_up(keys(), 16));
+    d_p_ = rnd_up(head_size(), vnni_granularity);
+
+    const dim_t m_tail = queries() % m_blk_;
+    const dim_t n_tail = keys() % n_blk_;
+    for_(int i_m = 0; i_m < 2; i_m++)
+    for (int i_n = 0; i_n < 2; i_n++) {
+        const dim_t M = i_m ? m_tail : m_blk_;
+        const dim_t N = i_n ? n_tail : n_blk_;
+        const int idx = get_brg_idx(i_m, i_n);
+        if (M == 0 || N == 0) continue;
+        CHECK(init_brgemm(&brg_qk_[idx], M, N, d_p_, d_p_, n_blk_, n_blk_,
+                /* beta = */ 0.f));
+        CHECK(init_brgemm(&brg_pv_[idx], M, values(),
+                rnd_up(N, vnni_granularity), n_blk_, values(), values(),
+                /* beta = */ 1.f));
+    }
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+status_t brgemm_sdpa_t::pd_t::init_brgemm(brgemm_t *brg, dim_t M, dim_t N,
+        dim_t K, dim_t LDA, dim_t LDB, dim_t LDC, float beta) {
+    CHECK(brgemm_desc_init(brg, isa_, brgemm_addr, comp_dt_, comp_dt_, false,
+            false, brgemm_row_major, 1.f, beta, LDA, LDB, LDC, M, N, K));
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+    return brgemm_desc_set_attr(brg, brgattr);
+}
+
+void brgemm_sdpa_t::pd_t::init_scratchpad() {
+    nthr_ = dnnl_get_max_threads();
+
+    const size_t comp_dt_size = types::data_type_size(comp_dt_);
+    // The packed blocks of the keys and the values of all the heads.
+    const dim_t nb_kv = MB() * kv_heads() * div_up(keys(), n_blk_);
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<char>(key_sdpa_q_tile,
+            nthr_ * thr_chunk_size(m_blk_ * d_p_, comp_dt_size));
+    scratchpad.template book<char>(key_sdpa_k_tile,
+            nb_kv * thr_chunk_size(d_p_ * n_blk_, comp_dt_size));
+    scratchpad.template book<char>(key_sdpa_v_tile,
+            nb_kv * thr_chunk_size(n_blk_ * values(), comp_dt_size));
+    scratchpad.template book<char>(key_sdpa_scores,
+            nthr_ * thr_chunk_size(m_blk_ * n_blk_, sizeof(float)));
+    // f32 probabilities are multiplied in place of the scores.
+    if (comp_dt_ != f32)
+        scratchpad.template book<char>(key_sdpa_probs,
+                nthr_ * thr_chunk_size(m_blk_ * n_blk_, comp_dt_size));
+    scratchpad.template book<char>(key_sdpa_acc,
+            nthr_ * thr_chunk_size(m_blk_ * values(), sizeof(float)));
+    scratchpad.template book<char>(key_sdpa_stats,
+            nthr_ * thr_chunk_size(2 * m_blk_, sizeof(float)));
+}
+
+status_t brgemm_sdpa_t::init(engine_t *engine) {
+    for (int idx = 0; idx < 4; idx++) {
+        const auto &brg_qk = pd()->brg_qk_[idx];
+        if (brg_qk.bcast_dim * brg_qk.load_dim == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg_qk));
+        CHECK(safe_ptr_assign(brg_qk_kernels_[idx], ker));
+
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_pv_[idx]));
+        CHECK(safe_ptr_assign(brg_pv_kernels_[idx], ker));
+    }
+
+    // The two pass algorithm quantizes the f32 probabilities after the
+    // kernel.
+    const data_type_t probs_dt
+            = pd()->with_probs_quantization() ? f32 : pd()->comp_dt_;
+    if (is_superset(pd()->isa_, avx512_core))
+        CHECK(safe_ptr_assign(softmax_kernel_,
+                new jit_sdpa_softmax_kernel_t<avx512_core>(
+                        pd()->n_blk_, probs_dt)));
+    else
+        CHECK(safe_ptr_assign(softmax_kernel_,
+                new jit_sdpa_softmax_kernel_t<avx2>(pd()->n_blk_, probs_dt)));
+    return softmax_kernel_->create_kernel();
+}
+
+status_t brgemm_sdpa_t::execute(const exec_ctx_t &ctx) const {
+    const auto *desc = pd()->desc();
+
+    const tensor_reader_t q(desc->q_desc,
+            CTX_IN_MEM(const void *, DNNL_ARG_QUERIES), desc->q_quant);
+    const tensor_reader_t k(desc->k_desc,
+            CTX_IN_MEM(const void *, DNNL_ARG_KEYS), desc->k_quant);
+    const tensor_reader_t v(desc->v_desc,
+            CTX_IN_MEM(const void *, DNNL_ARG_VALUES), desc->v_quant);
+    const auto mask = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    const auto scale = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    const auto block_table
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_KV_BLOCK_TABLE);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    CHECK(pd()->check_block_table(block_table));
+
+    const auto mask_dt = desc->attn_mask_desc.data_type;
+    const auto &k_strides = desc->k_desc.format_desc.blocking.strides;
+    const auto &v_strides = desc->v_desc.format_desc.blocking.strides;
+    const auto dst_dt = desc->dst_desc.data_type;
+    const auto &dst_strides = desc->dst_desc.format_desc.blocking.strides;
+    const dim_t dst_offset0 = desc->dst_desc.offset0;
+    const bool is_int8_dst = one_of(dst_dt, s8, u8);
+
+    const dim_t MB = pd()->MB();
+    const dim_t HQ = pd()->q_heads();
+    const dim_t SQ = pd()->queries();
+    const dim_t SK = pd()->keys();
+    const dim_t D = pd()->head_size();
+    const dim_t DV = pd()->values();
+    const dim_t q_per_kv = desc->q_per_kv_heads();
+
+    const dim_t m_blk = pd()->m_blk_;
+    const dim_t n_blk = pd()->n_blk_;
+    const dim_t d_p = pd()->d_p_;
+    const dim_t nb_q = div_up(SQ, m_blk);
+    const bool is_bf16 = pd()->comp_dt_ == bf16;
+    const size_t comp_dt_size = types::data_type_size(pd()->comp_dt_);
+    // With the probabilities quantization the softmax statistics have to be
+    // known before the multiplication by the values, hence the keys are
+    // traversed twice.
+    const bool two_pass = pd()->with_probs_quantization();
+
+    const float scale_val = pd()->scale_value(pd()->with_scale()
+                    ? io::load_float_value(desc->scale_desc.data_type, scale, 0)
+                    : 1.f);
+
+    const dim_t HKV = pd()->kv_heads();
+    const dim_t nb_kv = div_up(SK, n_blk);
+    const size_t k_blk_size = thr_chunk_size(d_p * n_blk, comp_dt_size);
+    const size_t v_blk_size = thr_chunk_size(n_blk * DV, comp_dt_size);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    char *q_tile_base = scratchpad.template get<char>(key_sdpa_q_tile);
+    char *k_packed = scratchpad.template get<char>(key_sdpa_k_tile);
+    char *v_packed = scratchpad.template get<char>(key_sdpa_v_tile);
+    char *scores_base = scratchpad.template get<char>(key_sdpa_scores);
+    char *probs_base = is_bf16 ? scratchpad.template get<char>(key_sdpa_probs)
+                               : nullptr;
+    char *acc_base = scratchpad.template get<char>(key_sdpa_acc);
+    char *stats_base = scratchpad.template get<char>(key_sdpa_stats);
+
+    auto store_comp = [&](void *base, dim_t idx, float val) {
+        if (is_bf16)
+            static_cast<bfloat16_t *>(base)[idx] = val;
+        else
+            static_cast<float *>(base)[idx] = val;
+    };
+
+    // The keys and the values are packed once, the blocks are shared by all
+    // the query blocks and by the query heads of a group.
+    parallel_nd(MB, HKV, nb_kv, [&](dim_t mb, dim_t h_kv, dim_t kb) {
+        const dim_t blk = (mb * HKV + h_kv) * nb_kv + kb;
+        void *k_tile = k_packed + blk * k_blk_size;
+        void *v_tile = v_packed + blk * v_blk_size;
+        const dim_t j0 = kb * n_blk;
+        const dim_t n_cur = nstl::min(n_blk, SK - j0);
+        const dim_t n_cur_p = is_bf16 ? rnd_up(n_cur, 2) : n_cur;
+
+        for (dim_t c = 0; c < n_cur; c++) {
+            // The keys are read directly from the pages of paged KV.
+            const dim_t k_off = pd()->kv_off(
+                    desc->k_desc, block_table, mb, h_kv, 0, j0 + c, 3);
+            for (dim_t d = 0; d < d_p; d++) {
+                const float val = d < D ? k(k_off + d * k_strides[2]) : 0.f;
+                const dim_t idx = is_bf16 ? (d / 2) * n_blk * 2 + c * 2 + d % 2
+                                          : d * n_blk + c;
+                store_comp(k_tile, idx, val);
+            }
+        }
+
+        for (dim_t c = 0; c < n_cur_p; c++) {
+            const dim_t v_off = c < n_cur
+                    ? pd()->kv_off(
+                            desc->v_desc, block_table, mb, h_kv, j0 + c, 0, 2)
+                    : 0;
+            for (dim_t dv = 0; dv < DV; dv++) {
+                const float val
+                        = c < n_cur ? v(v_off + dv * v_strides[3]) : 0.f;
+                const dim_t idx = is_bf16 ? (c / 2) * DV * 2 + dv * 2 + c % 2
+                                          : c * DV + dv;
+                store_comp(v_tile, idx, val);
+            }
+        }
+    });
+
+    parallel_nd_ext(pd()->nthr_, MB, HQ, nb_q,
+            [&](int ithr, int, dim_t mb, dim_t h, dim_t qb) {
+        void *q_tile = q_tile_base
+                + ithr * thr_chunk_size(m_blk * d_p, comp_dt_size);
+        float *scores = reinterpret_cast<float *>(scores_base
+                + ithr * thr_chunk_size(m_blk * n_blk, sizeof(float)));
+        char *probs = is_bf16 ? probs_base
+                        + ithr * thr_chunk_size(m_blk * n_blk, comp_dt_size)
+                              : reinterpret_cast<char *>(scores);
+        float *acc = reinterpret_cast<float *>(acc_base
+                + ithr * thr_chunk_size(m_blk * DV, sizeof(float)));
+        float *row_max = reinterpret_cast<float *>(stats_base
+                + ithr * thr_chunk_size(2 * m_blk, sizeof(float)));
+        float *row_sum = row_max + m_blk;
+
+        const dim_t h_kv = h / q_per_kv;
+        const char *k_head = k_packed + (mb * HKV + h_kv) * nb_kv * k_blk_size;
+        const char *v_head = v_packed + (mb * HKV + h_kv) * nb_kv * v_blk_size;
+        const dim_t i0 = qb * m_blk;
+        const dim_t m_cur = nstl::min(m_blk, SQ - i0);
+        const bool m_tail = m_cur != m_blk;
+
+        // Keys past the causal boundary of the last query are skipped.
+        const dim_t k_end = pd()->with_causal_mask()
+                ? nstl::max<dim_t>(0,
+                        nstl::min(SK,
+                                pd()->causal_last_key(i0 + m_cur - 1) + 1))
+                : SK;
+        const dim_t nb_k = div_up(k_end, n_blk);
+
+        for (dim_t r = 0; r < m_cur; r++) {
+            for (dim_t d = 0; d < D; d++)
+                store_comp(q_tile, r * d_p + d, q(q.off(mb, h, i0 + r, d)));
+            for (dim_t d = D; d < d_p; d++)
+                store_comp(q_tile, r * d_p + d, 0.f);
+            row_max[r] = -INFINITY;
+            row_sum[r] = 0.f;
+        }
+        for (dim_t i = 0; i < m_cur * DV; i++)
+            acc[i] = 0.f;
+
+        // Computes the scaled and masked scores of the key block into
+        // `scores`. The scores of the padded keys are set to -inf.
+        auto compute_scores = [&](dim_t kb, dim_t n_cur) {
+            const dim_t j0 = kb * n_blk;
+            const int brg_idx = pd_t::get_brg_idx(m_tail, n_cur != n_blk);
+            brgemm_batch_element_t batch;
+            batch.ptr.A = q_tile;
+            batch.ptr.B = k_head + kb * k_blk_size;
+            brgemm_kernel_execute(
+                    brg_qk_kernels_[brg_idx].get(), 1, &batch, scores);
+
+            for (dim_t r = 0; r < m_cur; r++) {
+                const dim_t i = i0 + r;
+                const dim_t last_key = pd()->with_causal_mask()
+                        ? pd()->causal_last_key(i)
+                        : SK - 1;
+                float *s = scores + r * n_blk;
+                for (dim_t c = 0; c < n_cur; c++) {
+                    const dim_t j = j0 + c;
+                    float val = s[c] * scale_val;
+                    if (pd()->with_attn_mask())
+                        val += io::load_float_value(mask_dt, mask,
+                                pd()->attn_mask_off(mb, h, i, j));
+                    s[c] = j > last_key ? -INFINITY : val;
+                }
+                for (dim_t c = n_cur; c < n_blk; c++)
+                    s[c] = -INFINITY;
+            }
+        };
+
+        // Stores exp(score - max) of the row into `dst` updating the maximum
+        // of the row in `max`, the sum of the exponents is stored in `sum`.
+        auto compute_exp = [&](dim_t r, void *dst, float *max, float *sum) {
+            sdpa_softmax_call_params_t p;
+            p.src = scores + r * n_blk;
+            p.dst = dst;
+            p.max = max;
+            p.sum = sum;
+            (*softmax_kernel_)(&p);
+        };
+
+        // Accumulates the product of the probabilities and the values of the
+        // key block.
+        auto accumulate_values = [&](dim_t kb, dim_t n_cur) {
+            const int brg_idx = pd_t::get_brg_idx(m_tail, n_cur != n_blk);
+            brgemm_batch_element_t batch;
+            batch.ptr.A = probs;
+            batch.ptr.B = v_head + kb * v_blk_size;
+            brgemm_kernel_execute(
+                    brg_pv_kernels_[brg_idx].get(), 1, &batch, acc);
+        };
+
+        if (two_pass) {
+            for (dim_t kb = 0; kb < nb_k; kb++) {
+                const dim_t n_cur = nstl::min(n_blk, SK - kb * n_blk);
+                compute_scores(kb, n_cur);
+                for (dim_t r = 0; r < m_cur; r++) {
+                    const float m_old = row_max[r];
+                    float sum = 0.f;
+                    compute_exp(r, scores + r * n_blk, &row_max[r], &sum);
+                    if (row_max[r] == -INFINITY) continue;
+                    row_sum[r] = row_sum[r] * ::expf(m_old - row_max[r]) + sum;
+                }
+            }
+        }
+
+        for (dim_t kb = 0; kb < nb_k; kb++) {
+            const dim_t n_cur = nstl::min(n_blk, SK - kb * n_blk);
+            const dim_t n_cur_p = is_bf16 ? rnd_up(n_cur, 2) : n_cur;
+            compute_scores(kb, n_cur);
+
+            for (dim_t r = 0; r < m_cur; r++) {
+                float *s = scores + r * n_blk;
+                const dim_t p_off = r * n_blk;
+                if (two_pass) {
+                    // The maximum of the row is final and isn't changed.
+                    float m = row_max[r], sum = 0.f;
+                    compute_exp(r, s, &m, &sum);
+                    const float inv_sum
+                            = row_sum[r] > 0.f ? 1.f / row_sum[r] : 0.f;
+                    for (dim_t c = 0; c < n_cur; c++) {
+                        const float p = row_sum[r] > 0.f ? s[c] * inv_sum : 0.f;
+                        store_comp(probs, p_off + c,
+                                pd()->fake_quantize_probs(p));
+                    }
+                    for (dim_t c = n_cur; c < n_cur_p; c++)
+                        store_comp(probs, p_off + c, 0.f);
+                } else {
+                    const float m_old = row_max[r];
+                    float sum = 0.f;
+                    compute_exp(r, probs + p_off * comp_dt_size, &row_max[r],
+                            &sum);
+                    if (row_max[r] == -INFINITY) {
+                        // All the keys so far are masked out.
+                        for (dim_t c = 0; c < n_blk; c++)
+                            store_comp(probs, p_off + c, 0.f);
+                    } else {
+                        const float alpha = ::expf(m_old - row_max[r]);
+                        row_sum[r] = row_sum[r] * alpha + sum;
+                        if (alpha != 1.f)
+                            for (dim_t dv = 0; dv < DV; dv++)
+                                acc[r * DV + dv] *= alpha;
+                    }
+                }
+            }
+
+            accumulate_values(kb, n_cur);
+        }
+
+        for (dim_t r = 0; r < m_cur; r++) {
+            // A query that attends to no keys produces zeros.
+            const float factor = two_pass ? 1.f
+                    : row_sum[r] > 0.f    ? 1.f / row_sum[r]
+                                          : 0.f;
+            for (dim_t dv = 0; dv < DV; dv++) {
+                float val = acc[r * DV + dv] * factor;
+                if (is_int8_dst)
+                    val = val / desc->dst_quant.scale
+                            + (float)desc->dst_quant.zero_point;
+                const dim_t off = dst_offset0 + mb * dst_strides[0]
+                        + h * dst_strides[1] + (i0 + r) * dst_strides[2]
+                        + dv * dst_strides[3];
+                io::store_float_value(dst_dt, val, dst, off);
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
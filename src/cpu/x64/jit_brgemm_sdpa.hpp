@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SDPA_HPP
+#define CPU_X64_JIT_BRGEMM_SDPA_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Flash attention style implementation. Each thread computes a block of
+// queries of a head and iterates over blocks of keys keeping the running
+// maximum and sum of the exponents of the scores per query. The scores are
+// only materialized for a pair of query and key blocks.
+//
+// The keys and the values are packed once per head before the main loop, the
+// queries are packed per block. The matrix multiplications are done with
+// brgemm kernels on the packed blocks: bf16 tensors are multiplied in bf16
+// with f32 accumulation, the other data types are converted to f32 while
+// packing. The exponents of a block of scores are computed by a jit kernel
+// that also updates the statistics of the row.
+struct brgemm_sdpa_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brg:", isa_, ""), brgemm_sdpa_t);
+
+        status_t init(engine_t *engine);
+
+        // Indices of the kernels: the first one is for full blocks, the
+        // second one is for the tail.
+        static int get_brg_idx(bool m_tail, bool n_tail) {
+            return 2 * m_tail + n_tail;
+        }
+
+        cpu_isa_t isa_ = isa_undef;
+        // Data type the matrices are multiplied in.
+        data_type_t comp_dt_ = data_type::undef;
+        dim_t m_blk_ = 0; // queries per block
+        dim_t n_blk_ = 0; // keys per block, a multiple of the simd width
+        dim_t d_p_ = 0; // head size padded for the VNNI layout
+        int nthr_ = 0;
+
+        // S = Q * K: [m_blk, d_p] x [d_p, n_blk].
+        brgemm_t brg_qk_[4];
+        // O += P * V: [m_blk, n_blk] x [n_blk, values].
+        brgemm_t brg_pv_[4];
+
+    private:
+        status_t init_brgemm(brgemm_t *brg, dim_t M, dim_t N, dim_t K,
+                dim_t LDA, dim_t LDB, dim_t LDC, float beta);
+        void init_scratchpad();
+    };
+
+    brgemm_sdpa_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_qk_kernels_[4];
+    std::unique_ptr<brgemm_kernel_t> brg_pv_kernels_[4];
+    std::unique_ptr<jit_generator> softmax_kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,452 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace wino = brgemm_wino_conv_utils;
+
+namespace {
+
+constexpr int max_alpha = 8;
+constexpr int max_m = 6;
+constexpr dim_t max_oc_block = 64;
+// Input channels transformed at once.
+constexpr dim_t ic_chunk = 64;
+
+// Per-thread chunks of the scratchpad are aligned to a cache line.
+size_t thr_chunk_size(dim_t nelems, size_t data_size) {
+    return rnd_up((size_t)nelems * data_size, (size_t)64);
+}
+
+void load_floats(
+        float *out, data_type_t dt, const void *base, dim_t off, dim_t n) {
+    if (dt == bf16) {
+        cvt_bfloat16_to_float(
+                out, static_cast<const bfloat16_t *>(base) + off, n);
+        return;
+    }
+    const float *in = static_cast<const float *>(base) + off;
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < n; i++)
+        out[i] = in[i];
+}
+
+void store_floats(
+        void *base, data_type_t dt, dim_t off, const float *in, dim_t n) {
+    if (dt == bf16) {
+        cvt_float_to_bfloat16(static_cast<bfloat16_t *>(base) + off, in, n);
+        return;
+    }
+    float *out = static_cast<float *>(base) + off;
+    PRAGMA_OMP_SIMD()
+    for (dim_t i = 0; i < n; i++)
+        out[i] = in[i];
+}
+
+} // namespace
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init(engine_t *engine) {
+    using namespace format_tag;
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    const auto src_type = src_md(0)->data_type;
+    const auto wei_type = weights_md(0)->data_type;
+    const auto bia_type = weights_md(1)->data_type;
+    const auto dst_type = dst_md(0)->data_type;
+
+    VDISPATCH_CONV(is_fwd(), VERBOSE_BAD_PROPKIND);
+    VDISPATCH_CONV(one_of(desc()->alg_kind, alg_kind::convolution_winograd,
+                           alg_kind::convolution_auto),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_CONV(ndims() == 4, VERBOSE_BAD_NDIMS, "src", ndims());
+    VDISPATCH_CONV(!with_groups(), VERBOSE_BAD_PARAM, "groups");
+    VDISPATCH_CONV(KH() == 3 && KW() == 3, VERBOSE_BAD_PARAM, "kernel");
+    VDISPATCH_CONV(KSH() == 1 && KSW() == 1, VERBOSE_BAD_PARAM, "strides");
+    VDISPATCH_CONV(KDH() == 0 && KDW() == 0, VERBOSE_BAD_PARAM, "dilates");
+    // Larger padding would make the tiles at the borders mostly zeros.
+    VDISPATCH_CONV(padT() <= 1 && padB() <= 1 && padL() <= 1 && padR() <= 1,
+            VERBOSE_BAD_PARAM, "padding");
+
+    const bool is_f32 = everyone_is(f32, src_type, wei_type, dst_type);
+    const bool is_bf16 = everyone_is(bf16, src_type, wei_type)
+            && one_of(dst_type, bf16, f32);
+    VDISPATCH_CONV(is_f32 || is_bf16, VERBOSE_UNSUPPORTED_DT_CFG);
+    VDISPATCH_CONV(one_of(bia_type, data_type::undef, f32, src_type),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+
+    if (is_bf16 && mayiuse(avx512_core_amx))
+        isa_ = avx512_core_amx;
+    else if (is_bf16 && mayiuse(avx512_core_bf16))
+        isa_ = avx512_core_bf16;
+    else if (is_f32 && mayiuse(avx512_core))
+        isa_ = avx512_core;
+    VDISPATCH_CONV(isa_ != isa_undef, VERBOSE_UNSUPPORTED_ISA);
+    comp_dt_ = src_type;
+
+    VDISPATCH_CONV(attr()->has_default_values(
+                           smask_t::post_ops | smask_t::sum_dt, dst_type),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_CONV(attr()->post_ops_.check_sum_consistency(
+                           dst_type, /* is_int8 */ false)
+                    && ref_post_ops_t::primitive_kind_ok(attr()->post_ops_),
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    // The descriptor is only updated once the implementation is known to
+    // handle the problem.
+    VDISPATCH_CONV(IMPLICATION(desc()->alg_kind == alg_kind::convolution_auto,
+                           is_wino_profitable()),
+            VERBOSE_BAD_ALGORITHM);
+
+    VDISPATCH_CONV(set_default_formats_common(nhwc, any, nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_CONV(memory_desc_wrapper(src_md_).matches_tag(nhwc)
+                    && memory_desc_wrapper(dst_md_).matches_tag(nhwc),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    wino::init_weights_conf(wc_, pick_tile_size(), OC(), IC(), wei_type);
+    if (weights_md_.format_kind == format_kind::any) {
+        wino::init_weights_md(weights_md_, wc_);
+    } else if (weights_md_.format_kind == format_kind::wino) {
+        memory_desc_t expected_md = weights_md_;
+        wino::init_weights_md(expected_md, wc_);
+        VDISPATCH_CONV(weights_md_ == expected_md, VERBOSE_UNSUPPORTED_TAG_S,
+                "weights");
+    } else {
+        VDISPATCH_CONV(memory_desc_wrapper(weights_md_).is_blocking_desc(),
+                VERBOSE_UNSUPPORTED_TAG_S, "weights");
+    }
+    wei_is_wino_ = weights_md_.format_kind == format_kind::wino;
+
+    VDISPATCH_CONV(set_default_alg_kind(alg_kind::convolution_winograd),
+            VERBOSE_BAD_ALGORITHM);
+    VDISPATCH_CONV(attr_.set_default_formats(dst_md(0)) == status::success,
+            VERBOSE_UNSUPPORTED_POSTOP);
+
+    oh_tiles_ = div_up(OH(), wc_.m);
+    ow_tiles_ = div_up(OW(), wc_.m);
+    tiles_ = MB() * oh_tiles_ * ow_tiles_;
+    tile_blk_ = nstl::min<dim_t>(32, tiles_);
+    nb_tiles_ = div_up(tiles_, tile_blk_);
+
+    CHECK(init_brgemm(&brg_[0], tile_blk_));
+    const dim_t tile_tail = tiles_ % tile_blk_;
+    if (tile_tail) CHECK(init_brgemm(&brg_[1], tile_tail));
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+bool brgemm_wino_convolution_fwd_t::pd_t::is_wino_profitable() const {
+    // The transforms are amortized over the channels and the savings only
+    // show up on the spatial sizes spanning several tiles.
+    return IC() >= 64 && OC() >= 64 && OH() * OW() >= 14 * 14;
+}
+
+int brgemm_wino_convolution_fwd_t::pd_t::pick_tile_size() const {
+    // The larger tile amplifies the rounding errors of bf16 too much.
+    if (comp_dt_ != f32) return 4;
+
+    // Number of multiplications in the transformed domain per channel.
+    auto cost = [&](int m) {
+        return div_up(OH(), m) * div_up(OW(), m) * (m + 2) * (m + 2);
+    };
+    return cost(6) < cost(4) ? 6 : 4;
+}
+
+status_t brgemm_wino_convolution_fwd_t::pd_t::init_brgemm(
+        brgemm_t *brg, dim_t M) {
+    CHECK(brgemm_desc_init(brg, isa_, brgemm_addr, comp_dt_, comp_dt_, false,
+            false, brgemm_row_major, 1.f, /* beta = */ 0.f, wc_.ic_p,
+            wc_.oc_block, wc_.oc_block, M, wc_.oc_block, wc_.ic_p));
+
+    brgemm_attr_t brgattr;
+    brgattr.max_bs = 1;
+    CHECK(brgemm_desc_set_attr(brg, brgattr));
+
+    wsp_tile_size_ = nstl::max(
+            wsp_tile_size_, (size_t)brg->get_wsp_buffer_size());
+    return status::success;
+}
+
+void brgemm_wino_convolution_fwd_t::pd_t::init_scratchpad() {
+    nthr_ = dnnl_get_max_threads();
+
+    const dim_t alpha2 = wc_.alpha * wc_.alpha;
+    const size_t comp_dt_size = types::data_type_size(comp_dt_);
+    auto scratchpad = scratchpad_registry().registrar();
+    if (!wei_is_wino_)
+        scratchpad.template book<char>(key_wino_U, wc_.size());
+    // The source is transformed one block of tiles at a time by the thread
+    // multiplying it, so that the booking does not grow with the problem.
+    scratchpad.template book<char>(key_wino_V,
+            nthr_
+                    * thr_chunk_size(
+                            alpha2 * tile_blk_ * wc_.ic_p, comp_dt_size));
+    scratchpad.template book<char>(key_wino_M,
+            nthr_
+                    * thr_chunk_size(
+                            alpha2 * tile_blk_ * wc_.oc_block, sizeof(float)));
+    if (is_superset(isa_, avx512_core_amx))
+        scratchpad.template book<char>(
+                key_conv_amx_tile_buffer, nthr_ * wsp_tile_size_);
+}
+
+status_t brgemm_wino_convolution_fwd_t::init(engine_t *engine) {
+    const bool is_amx = is_superset(pd()->isa_, avx512_core_amx);
+    for (int idx = 0; idx < 2; idx++) {
+        const auto &brg = pd()->brg_[idx];
+        if (brg.bcast_dim * brg.load_dim == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, brg));
+        CHECK(safe_ptr_assign(brg_kernels_[idx], ker));
+        if (is_amx) brgemm_palettes_.insert(idx, brg);
+    }
+
+    ref_post_ops_ = make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+    if (!ref_post_ops_) return status::out_of_memory;
+    return ref_post_ops_->init(pd()->dst_md());
+}
+
+status_t brgemm_wino_convolution_fwd_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto wei = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
+    const auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper bia_d(pd()->weights_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto &wc = pd()->wc_;
+    const auto &tile = wino::get_tile(wc.m);
+    const int m = wc.m;
+    const int alpha = wc.alpha;
+    const int alpha2 = alpha * alpha;
+
+    const dim_t MB = pd()->MB();
+    const dim_t IC = pd()->IC();
+    const dim_t OC = pd()->OC();
+    const dim_t IH = pd()->IH();
+    const dim_t IW = pd()->IW();
+    const dim_t OH = pd()->OH();
+    const dim_t OW = pd()->OW();
+    const dim_t padT = pd()->padT();
+    const dim_t padL = pd()->padL();
+
+    const dim_t ic_p = wc.ic_p;
+    const dim_t ob = wc.oc_block;
+    const dim_t nb_oc = wc.nb_oc;
+    const dim_t oh_tiles = pd()->oh_tiles_;
+    const dim_t ow_tiles = pd()->ow_tiles_;
+    const dim_t tiles = pd()->tiles_;
+    const dim_t tile_blk = pd()->tile_blk_;
+    const dim_t nb_tiles = pd()->nb_tiles_;
+
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const auto comp_dt = pd()->comp_dt_;
+    const size_t comp_dt_size = types::data_type_size(comp_dt);
+    const auto sum_dt = pd()->attr()->post_ops_.get_sum_dt(dst_dt);
+    const bool with_post_ops = pd()->attr()->post_ops_.len() > 0;
+    const bool is_amx = is_superset(pd()->isa_, avx512_core_amx);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    const void *U = wei;
+    if (!pd()->wei_is_wino_) {
+        void *U_buf = scratchpad.template get<void>(key_wino_U);
+        wino::transform_weights(wc, wei_d, wei, U_buf);
+        U = U_buf;
+    }
+    char *V_base = scratchpad.template get<char>(key_wino_V);
+    char *M_base = scratchpad.template get<char>(key_wino_M);
+    char *wsp_tile_base = is_amx
+            ? scratchpad.template get<char>(key_conv_amx_tile_buffer)
+            : nullptr;
+
+    // V holds a block of tiles laid out as [alpha * alpha][tile_blk][ic_p].
+    auto V_off = [&](dim_t t, int a, dim_t ic) {
+        return (a * tile_blk + t) * ic_p + ic;
+    };
+
+    // Input transform of a tile: V = B^T d B.
+    const dim_t nb_ic = div_up(ic_p, ic_chunk);
+    auto transform_src = [&](char *V, dim_t tile_idx, dim_t t, dim_t icb) {
+        // [alpha][alpha][nc]
+        float d[max_alpha * max_alpha * ic_chunk];
+        float t_buf[max_alpha * max_alpha * ic_chunk];
+        float v[max_alpha * max_alpha * ic_chunk];
+
+        dim_t n {0}, ty {0}, tx {0};
+        nd_iterator_init(tile_idx, n, MB, ty, oh_tiles, tx, ow_tiles);
+        const dim_t ic0 = icb * ic_chunk;
+        const dim_t nc = nstl::min(ic_chunk, ic_p - ic0);
+        // Channels padded for the VNNI layout are zeros.
+        const dim_t nc_src = nstl::max<dim_t>(0, nstl::min(nc, IC - ic0));
+        const dim_t ih0 = ty * m - padT;
+        const dim_t iw0 = tx * m - padL;
+
+        for_(int i = 0; i < alpha; i++)
+        for (int j = 0; j < alpha; j++) {
+            float *d_ij = d + (i * alpha + j) * nc;
+            const dim_t ih = ih0 + i;
+            const dim_t iw = iw0 + j;
+            const bool is_inside = ih >= 0 && ih < IH && iw >= 0 && iw < IW;
+            const dim_t nc_load = is_inside ? nc_src : 0;
+            if (nc_load > 0)
+                load_floats(d_ij, src_dt, src, src_d.blk_off(n, ic0, ih, iw),
+                        nc_load);
+            for (dim_t c = nc_load; c < nc; c++)
+                d_ij[c] = 0.f;
+        }
+
+        wino::mult(tile.BT, alpha, alpha, alpha, d, alpha * nc, nc, t_buf,
+                alpha * nc, nc, nc);
+        wino::mult(tile.BT, alpha, alpha, alpha, t_buf, nc, alpha * nc, v, nc,
+                alpha * nc, nc);
+
+        for (int a = 0; a < alpha2; a++)
+            store_floats(V, comp_dt, V_off(t, a, ic0), v + a * nc, nc);
+    };
+
+    // Input transform of a block of tiles, multiplication by the transformed
+    // weights and output transform: y = A^T M A. The work is split over the
+    // blocks of tiles first, so a thread transforms a block of tiles once for
+    // all its blocks of output channels.
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(nb_tiles * nb_oc, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        char *V = V_base
+                + ithr
+                        * thr_chunk_size(
+                                alpha2 * tile_blk * ic_p, comp_dt_size);
+        dim_t V_tb = -1;
+        float *mbuf = reinterpret_cast<float *>(M_base
+                + ithr * thr_chunk_size(alpha2 * tile_blk * ob, sizeof(float)));
+        char *wsp_tile = is_amx
+                ? wsp_tile_base + ithr * pd()->wsp_tile_size_
+                : nullptr;
+        int last_brg_idx = -1;
+
+        dim_t tb {0}, ocb {0};
+        nd_iterator_init(start, tb, nb_tiles, ocb, nb_oc);
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t t0 = tb * tile_blk;
+            const dim_t nt = nstl::min(tile_blk, tiles - t0);
+            const int brg_idx = nt < tile_blk;
+            if (tb != V_tb) {
+                for_(dim_t tt = 0; tt < nt; tt++)
+                for (dim_t icb = 0; icb < nb_ic; icb++)
+                    transform_src(V, t0 + tt, tt, icb);
+                V_tb = tb;
+            }
+            brgemm_palettes_.maybe_tile_configure(
+                    is_amx, last_brg_idx, brg_idx);
+
+            // M[a] = V[a] * U[a], [nt, ic_p] x [ic_p, ob].
+            brgemm_batch_element_t batch;
+            for (int a = 0; a < alpha2; a++) {
+                batch.ptr.A = V + V_off(0, a, 0) * comp_dt_size;
+                batch.ptr.B = static_cast<const char *>(U)
+                        + wc.off(a, ocb, 0, 0) * comp_dt_size;
+                brgemm_kernel_execute(brg_kernels_[brg_idx].get(), 1, &batch,
+                        mbuf + a * tile_blk * ob, wsp_tile);
+            }
+
+            const dim_t oc0 = ocb * ob;
+            const dim_t noc = nstl::min(ob, OC - oc0);
+            float bias_blk[max_oc_block] = {0};
+            if (bias)
+                for (dim_t o = 0; o < noc; o++)
+                    bias_blk[o] = io::load_float_value(
+                            bia_d.data_type(), bias, bia_d.off(oc0 + o));
+
+            for (dim_t tt = 0; tt < nt; tt++) {
+                // [m][alpha][ob] and [m][m][ob]
+                float t[max_m * max_alpha * max_oc_block];
+                float y[max_m * max_m * max_oc_block];
+                wino::mult(tile.AT, m, alpha, alpha, mbuf + tt * ob,
+                        alpha * tile_blk * ob, tile_blk * ob, t, alpha * ob, ob,
+                        ob);
+                wino::mult(tile.AT, m, alpha, m, t, ob, alpha * ob, y, ob,
+                        m * ob, ob);
+
+                dim_t n {0}, ty {0}, tx {0};
+                nd_iterator_init(t0 + tt, n, MB, ty, oh_tiles, tx, ow_tiles);
+                for (int i = 0; i < m; i++) {
+                    const dim_t oh = ty * m + i;
+                    if (oh >= OH) break;
+                    for (int j = 0; j < m; j++) {
+                        const dim_t ow = tx * m + j;
+                        if (ow >= OW) break;
+                        float *y_ij = y + (i * m + j) * ob;
+                        const dim_t dst_off = dst_d.blk_off(n, oc0, oh, ow);
+                        PRAGMA_OMP_SIMD()
+                        for (dim_t o = 0; o < noc; o++)
+                            y_ij[o] += bias_blk[o];
+                        if (with_post_ops) {
+                            for (dim_t o = 0; o < noc; o++) {
+                                ref_post_ops_t::args_t args;
+                                args.dst_val = io::load_float_value(
+                                        sum_dt, dst, dst_off + o);
+                                args.ctx = &ctx;
+                                args.l_offset
+                                        = ((n * OC + oc0 + o) * OH + oh) * OW
+                                        + ow;
+                                args.dst_md = pd()->dst_md();
+                                ref_post_ops_->execute(y_ij[o], args);
+                            }
+                        }
+                        store_floats(dst, dst_dt, dst_off, y_ij, noc);
+                    }
+                }
+            }
+            nd_iterator_step(tb, nb_tiles, ocb, nb_oc);
+        }
+
+        if (is_amx) amx_tile_maybe_release();
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,103 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_convolution_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/brgemm/brgemm_containers.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_brgemm_wino_conv_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Winograd F(4x4, 3x3) and F(6x6, 3x3) convolution. The computation is split
+// into three stages:
+// - a block of tiles of the source is transformed into alpha * alpha matrices
+//   of tiles x IC in a per-thread scratchpad;
+// - for each of the alpha * alpha elements a brgemm multiplies a block of
+//   tiles by a block of the transformed weights;
+// - the products are transformed back into tiles of the destination together
+//   with the bias and post-ops.
+// The transformed weights are either passed in the Winograd format, so that the
+// transform is done once by a reorder, or computed at every execution from the
+// weights in a plain format.
+struct brgemm_wino_convolution_fwd_t : public primitive_t {
+    struct pd_t : public cpu_convolution_fwd_pd_t {
+        using cpu_convolution_fwd_pd_t::cpu_convolution_fwd_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_wino:", isa_, ""),
+                brgemm_wino_convolution_fwd_t);
+
+        status_t init(engine_t *engine);
+
+        cpu_isa_t isa_ = isa_undef;
+        // Data type the matrices are multiplied in.
+        data_type_t comp_dt_ = data_type::undef;
+        brgemm_wino_conv_utils::weights_conf_t wc_;
+        // The weights are passed in the Winograd format.
+        bool wei_is_wino_ = false;
+        dim_t oh_tiles_ = 0;
+        dim_t ow_tiles_ = 0;
+        dim_t tiles_ = 0;
+        dim_t tile_blk_ = 0; // tiles per block
+        dim_t nb_tiles_ = 0;
+        int nthr_ = 0;
+        size_t wsp_tile_size_ = 0;
+
+        // [tile_blk, ic_p] x [ic_p, oc_block], the second kernel is for the
+        // tail block of tiles.
+        brgemm_t brg_[2];
+
+    private:
+        bool is_wino_profitable() const;
+        int pick_tile_size() const;
+        status_t init_brgemm(brgemm_t *brg, dim_t M);
+        void init_scratchpad();
+    };
+
+    brgemm_wino_convolution_fwd_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[2];
+    brgemm_containers::brgemm_palette_container_t brgemm_palettes_ {2};
+    std::unique_ptr<ref_post_ops_t> ref_post_ops_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,221 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/bfloat16.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_conv_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_wino_conv_utils {
+
+using namespace dnnl::impl::utils;
+
+namespace {
+
+constexpr int max_alpha = 8;
+constexpr dim_t max_oc_block = 64;
+
+// F(4x4, 3x3), interpolation points 0, +-0.625, +-1.5 and infinity. The points
+// are the same as the ones of the benchdnn reference.
+const float f4_BT[6 * 6] = {
+        0.87890625f, 0.f, -2.640625f, 0.f, 1.f, 0.f, //
+        0.f, -1.40625f, -2.25f, 0.625f, 1.f, 0.f, //
+        0.f, 1.40625f, -2.25f, -0.625f, 1.f, 0.f, //
+        0.f, -0.5859375f, -0.390625f, 1.5f, 1.f, 0.f, //
+        0.f, 0.5859375f, -0.390625f, -1.5f, 1.f, 0.f, //
+        0.f, 0.87890625f, 0.f, -2.640625f, 0.f, 1.f};
+const float f4_G[6 * 3] = {
+        1.13777777777778f, 0.f, 0.f, //
+        -0.688403361344538f, -0.430252100840336f, -0.26890756302521f, //
+        -0.688403361344538f, 0.430252100840336f, -0.26890756302521f, //
+        0.119514472455649f, 0.179271708683473f, 0.26890756302521f, //
+        0.119514472455649f, -0.179271708683473f, 0.26890756302521f, //
+        0.f, 0.f, 1.f};
+const float f4_AT[4 * 6] = {
+        1.f, 1.f, 1.f, 1.f, 1.f, 0.f, //
+        0.f, 0.625f, -0.625f, 1.5f, -1.5f, 0.f, //
+        0.f, 0.390625f, 0.390625f, 2.25f, 2.25f, 0.f, //
+        0.f, 0.244140625f, -0.244140625f, 3.375f, -3.375f, 1.f};
+
+// F(6x6, 3x3), interpolation points 0, +-1, +-2, +-0.5 and infinity.
+const float f6_BT[8 * 8] = {
+        1.f, 0.f, -5.25f, 0.f, 5.25f, 0.f, -1.f, 0.f, //
+        0.f, 1.f, 1.f, -4.25f, -4.25f, 1.f, 1.f, 0.f, //
+        0.f, -1.f, 1.f, 4.25f, -4.25f, -1.f, 1.f, 0.f, //
+        0.f, 0.5f, 0.25f, -2.5f, -1.25f, 2.f, 1.f, 0.f, //
+        0.f, -0.5f, 0.25f, 2.5f, -1.25f, -2.f, 1.f, 0.f, //
+        0.f, 2.f, 4.f, -2.5f, -5.f, 0.5f, 1.f, 0.f, //
+        0.f, -2.f, 4.f, 2.5f, -5.f, -0.5f, 1.f, 0.f, //
+        0.f, -1.f, 0.f, 5.25f, 0.f, -5.25f, 0.f, 1.f};
+const float f6_G[8 * 3] = {
+        1.f, 0.f, 0.f, //
+        -2.f / 9, -2.f / 9, -2.f / 9, //
+        -2.f / 9, 2.f / 9, -2.f / 9, //
+        1.f / 90, 1.f / 45, 2.f / 45, //
+        1.f / 90, -1.f / 45, 2.f / 45, //
+        32.f / 45, 16.f / 45, 8.f / 45, //
+        32.f / 45, -16.f / 45, 8.f / 45, //
+        0.f, 0.f, 1.f};
+const float f6_AT[6 * 8] = {
+        1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 0.f, //
+        0.f, 1.f, -1.f, 2.f, -2.f, 0.5f, -0.5f, 0.f, //
+        0.f, 1.f, 1.f, 4.f, 4.f, 0.25f, 0.25f, 0.f, //
+        0.f, 1.f, -1.f, 8.f, -8.f, 0.125f, -0.125f, 0.f, //
+        0.f, 1.f, 1.f, 16.f, 16.f, 0.0625f, 0.0625f, 0.f, //
+        0.f, 1.f, -1.f, 32.f, -32.f, 0.03125f, -0.03125f, 1.f};
+
+} // namespace
+
+const wino_tile_t &get_tile(int m) {
+    static const wino_tile_t f4 = {4, 6, f4_BT, f4_G, f4_AT};
+    static const wino_tile_t f6 = {6, 8, f6_BT, f6_G, f6_AT};
+    assert(one_of(m, 4, 6));
+    return m == 6 ? f6 : f4;
+}
+
+void mult(const float *mat, int rows, int cols, int n, const float *src,
+        dim_t src_s0, dim_t src_s1, float *dst, dim_t dst_s0, dim_t dst_s1,
+        dim_t nc) {
+    for_(int i = 0; i < rows; i++)
+    for (int j = 0; j < n; j++) {
+        float *d = dst + i * dst_s0 + j * dst_s1;
+        PRAGMA_OMP_SIMD()
+        for (dim_t c = 0; c < nc; c++)
+            d[c] = 0.f;
+        for (int k = 0; k < cols; k++) {
+            // The transform matrices are sparse.
+            const float w = mat[i * cols + k];
+            if (w == 0.f) continue;
+            const float *s = src + k * src_s0 + j * src_s1;
+            PRAGMA_OMP_SIMD()
+            for (dim_t c = 0; c < nc; c++)
+                d[c] += w * s[c];
+        }
+    }
+}
+
+size_t weights_conf_t::size() const {
+    return (size_t)alpha * alpha * nb_oc * ic_p * oc_block
+            * types::data_type_size(dt);
+}
+
+void init_weights_conf(
+        weights_conf_t &wc, int m, dim_t oc, dim_t ic, data_type_t dt) {
+    wc.m = m;
+    wc.alpha = m + 2;
+    wc.oc = oc;
+    wc.ic = ic;
+    // bf16 matrices are multiplied in the VNNI layout.
+    wc.ic_p = dt == data_type::bf16 ? rnd_up(ic, 2) : ic;
+    wc.oc_block = nstl::min(max_oc_block, rnd_up(oc, 16));
+    wc.nb_oc = div_up(oc, wc.oc_block);
+    wc.dt = dt;
+}
+
+status_t init_weights_conf(weights_conf_t &wc, const memory_desc_t &md) {
+    if (md.format_kind != format_kind::wino) return status::invalid_arguments;
+    const auto &wd = md.format_desc.wino_desc;
+    if (wd.r != 3 || !one_of(wd.alpha, 6, 8)
+            || !one_of(md.data_type, data_type::f32, data_type::bf16))
+        return status::invalid_arguments;
+
+    init_weights_conf(wc, wd.alpha - 2, wd.oc, wd.ic, md.data_type);
+    memory_desc_t expected_md = md;
+    init_weights_md(expected_md, wc);
+    return types::wino_desc_is_equal(
+                   wd, expected_md.format_desc.wino_desc)
+            ? status::success
+            : status::invalid_arguments;
+}
+
+void init_weights_md(memory_desc_t &md, const weights_conf_t &wc) {
+    wino_desc_t wd {};
+    wd.wino_format = wc.dt == data_type::bf16
+            ? wino_memory_format_t::wino_wei_aaOIo2i
+            : wino_memory_format_t::wino_wei_aaOio;
+    wd.r = 3;
+    wd.alpha = wc.alpha;
+    wd.ic = (int)wc.ic;
+    wd.oc = (int)wc.oc;
+    wd.ic_block = (int)wc.ic_p;
+    wd.oc_block = (int)wc.oc_block;
+    wd.ic2_block = 1;
+    wd.oc2_block = (int)wc.nb_oc;
+    wd.adj_scale = 1.f;
+    wd.size = wc.size();
+
+    md.format_kind = format_kind::wino;
+    md.format_desc.wino_desc = wd;
+}
+
+void transform_weights(const weights_conf_t &wc,
+        const memory_desc_wrapper &wei_d, const void *wei, void *U) {
+    const auto &tile = get_tile(wc.m);
+    const int alpha = wc.alpha;
+    const dim_t ob = wc.oc_block;
+    const bool is_bf16 = wc.dt == data_type::bf16;
+    const auto wei_dt = wei_d.data_type();
+
+    parallel_nd(wc.nb_oc, wc.ic_p, [&](dim_t ocb, dim_t ic) {
+        // [3][3][ob], [alpha][3][ob] and [alpha][alpha][ob].
+        float g[3 * 3 * max_oc_block];
+        float t[max_alpha * 3 * max_oc_block];
+        float u[max_alpha * max_alpha * max_oc_block];
+
+        const dim_t oc0 = ocb * ob;
+        const dim_t noc = ic < wc.ic ? nstl::min(ob, wc.oc - oc0) : 0;
+        for_(int kh = 0; kh < 3; kh++)
+        for (int kw = 0; kw < 3; kw++) {
+            float *g_k = g + (kh * 3 + kw) * ob;
+            for (dim_t o = 0; o < noc; o++)
+                g_k[o] = io::load_float_value(
+                        wei_dt, wei, wei_d.off(oc0 + o, ic, kh, kw));
+            for (dim_t o = noc; o < ob; o++)
+                g_k[o] = 0.f;
+        }
+
+        // t = G g, u = t G^T.
+        mult(tile.G, alpha, 3, 3, g, 3 * ob, ob, t, 3 * ob, ob, ob);
+        mult(tile.G, alpha, 3, alpha, t, ob, 3 * ob, u, ob, alpha * ob, ob);
+
+        for (int a = 0; a < alpha * alpha; a++) {
+            const float *u_a = u + a * ob;
+            for (dim_t o = 0; o < ob; o++) {
+                const dim_t off = wc.off(a, ocb, ic, o);
+                if (is_bf16)
+                    static_cast<bfloat16_t *>(U)[off] = u_a[o];
+                else
+                    static_cast<float *>(U)[off] = u_a[o];
+            }
+        }
+    });
+}
+
+} // namespace brgemm_wino_conv_utils
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_WINO_CONV_UTILS_HPP
+#define CPU_X64_JIT_BRGEMM_WINO_CONV_UTILS_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc_wrapper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace brgemm_wino_conv_utils {
+
+// Winograd F(m x m, 3 x 3) algorithm: an m x m tile of the output is computed
+// from an alpha x alpha tile of the input, alpha = m + 2, as
+//     Y = A^T [(G g G^T) .* (B^T d B)] A.
+struct wino_tile_t {
+    int m;
+    int alpha;
+    const float *BT; // alpha x alpha
+    const float *G; // alpha x 3
+    const float *AT; // m x alpha
+};
+
+// Returns the transform matrices for @p m equal to 4 or 6.
+const wino_tile_t &get_tile(int m);
+
+// Multiplies a row-major matrix @p mat of @p rows x @p cols elements by a
+// tensor along its first axis:
+//     dst(i, j, :) = sum_k mat(i, k) * src(k, j, :), j < n.
+// The last axis consists of @p nc dense elements, the strides of the first two
+// axes are in elements.
+void mult(const float *mat, int rows, int cols, int n, const float *src,
+        dim_t src_s0, dim_t src_s1, float *dst, dim_t dst_s0, dim_t dst_s1,
+        dim_t nc);
+
+// Layout of the transformed weights: alpha * alpha matrices of IC x OC split
+// into blocks of output channels,
+// - f32: [alpha * alpha][nb_oc][ic_p][oc_block] (wino_wei_aaOio);
+// - bf16: [alpha * alpha][nb_oc][ic_p / 2][oc_block][2] (wino_wei_aaOIo2i).
+// Both the input and output channels are padded with zeros.
+struct weights_conf_t {
+    int m = 0;
+    int alpha = 0;
+    dim_t oc = 0;
+    dim_t ic = 0;
+    dim_t ic_p = 0;
+    dim_t oc_block = 0;
+    dim_t nb_oc = 0;
+    data_type_t dt = data_type::undef;
+
+    // Offset of the element @p a of the transform of the weights of the input
+    // channel @p i and the output channel @p o of the block @p ocb.
+    dim_t off(int a, dim_t ocb, dim_t i, dim_t o) const {
+        const dim_t blk_off = (a * nb_oc + ocb) * ic_p;
+        if (dt == data_type::bf16)
+            return (blk_off + (i & ~1)) * oc_block + 2 * o + (i & 1);
+        return (blk_off + i) * oc_block + o;
+    }
+    size_t size() const;
+};
+
+void init_weights_conf(
+        weights_conf_t &wc, int m, dim_t oc, dim_t ic, data_type_t dt);
+// Initializes @p wc from a Winograd memory descriptor @p md.
+status_t init_weights_conf(weights_conf_t &wc, const memory_desc_t &md);
+// Sets the Winograd format described by @p wc to @p md.
+void init_weights_md(memory_desc_t &md, const weights_conf_t &wc);
+
+// Transforms the weights @p wei in a blocked format into @p U laid out as
+// described by @p wc.
+void transform_weights(const weights_conf_t &wc,
+        const memory_desc_wrapper &wei_d, const void *wei, void *U);
+
+} // namespace brgemm_wino_conv_utils
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
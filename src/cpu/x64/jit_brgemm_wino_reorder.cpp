@@ -0,0 +1,72 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/dnnl_thread.hpp"
+#include "common/memory_desc_wrapper.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_brgemm_wino_reorder.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+status_t brgemm_wino_weights_reorder_t::pd_t::create(
+        reorder_pd_t **reorder_pd, engine_t *engine,
+        const primitive_attr_t *attr, engine_t *src_engine,
+        const memory_desc_t *src_md, engine_t *dst_engine,
+        const memory_desc_t *dst_md) {
+    using namespace data_type;
+    using namespace status;
+
+    const memory_desc_wrapper id(src_md), od(dst_md);
+    if (!od.is_wino_desc()) return invalid_arguments;
+
+    brgemm_wino_conv_utils::weights_conf_t wc;
+    CHECK(brgemm_wino_conv_utils::init_weights_conf(wc, *dst_md));
+
+    const bool args_ok = id.is_blocking_desc() && id.ndims() == 4
+            && od.ndims() == 4 && id.dims()[0] == wc.oc
+            && id.dims()[1] == wc.ic && id.dims()[2] == 3 && id.dims()[3] == 3
+            && utils::one_of(id.data_type(), f32, bf16)
+            && IMPLICATION(id.data_type() == bf16, od.data_type() == bf16)
+            && !id.has_runtime_dims_or_strides()
+            && attr->has_default_values();
+    if (!args_ok) return invalid_arguments;
+
+    auto _pd = make_unique_pd<pd_t>(
+            attr, src_engine->kind(), src_md, dst_engine->kind(), dst_md);
+    if (_pd == nullptr) return out_of_memory;
+    _pd->wc_ = wc;
+    CHECK(_pd->init(engine, src_engine, dst_engine));
+    CHECK(_pd->init_scratchpad_md());
+    return safe_ptr_assign<reorder_pd_t>(*reorder_pd, _pd.release());
+}
+
+status_t brgemm_wino_weights_reorder_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_FROM);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_TO);
+
+    brgemm_wino_conv_utils::transform_weights(
+            pd()->wc_, memory_desc_wrapper(pd()->src_md()), src, dst);
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
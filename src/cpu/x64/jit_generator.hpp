@@ -17,6 +17,7 @@
 #ifndef CPU_X64_JIT_GENERATOR_HPP
 #define CPU_X64_JIT_GENERATOR_HPP
 
+#include <chrono>
 #include <limits.h>
 #include <vector>
 
@@ -26,6 +27,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_persistent_cache.hpp"
 
 #include "cpu/jit_utils/jit_utils.hpp"
 
@@ -2701,8 +2703,29 @@ public:
         int err_code = Xbyak::GetError();
         if (err_code == Xbyak::ERR_CANT_ALLOC) return status::out_of_memory;
         if (err_code != Xbyak::ERR_NONE) return status::runtime_error;
-        generate();
+
+        const auto start = std::chrono::steady_clock::now();
+        serialization_stream_t cache_key;
+        const bool use_cache = jit_persistent_cache::is_enabled()
+                && isAutoGrow() && serialize_cache_key(cache_key);
+        if (use_cache)
+            jit_persistent_cache::serialize_environment(
+                    cache_key, name(), max_cpu_isa_);
+        const bool is_cached
+                = use_cache && jit_persistent_cache::load(cache_key, *this);
+
+        if (!is_cached) generate();
+        std::vector<uint8_t> moved_code_buf;
+        const uint8_t *moved_code = use_cache && !is_cached && is_initialized()
+                ? link_copy(moved_code_buf)
+                : nullptr;
         jit_ker_ = getCode();
+        if (jit_ker_ && moved_code)
+            jit_persistent_cache::store(
+                    cache_key, jit_ker_, moved_code, getSize());
+        const auto duration = std::chrono::steady_clock::now() - start;
+        add_jit_generation_time(
+                std::chrono::duration<double, std::milli>(duration).count());
         return (jit_ker_) ? status::success : status::runtime_error;
     }
 
@@ -2716,6 +2739,32 @@ private:
         return code;
     }
 
+    // Copies the code to `buf` and links the copy at its own address, the
+    // code itself stays intact. The distance between the code and the copy
+    // has a non-zero low byte as required by jit_persistent_cache::store().
+    // Returns nullptr if the copy cannot be linked, e.g. when an external
+    // function is out of reach of a relative call from the copy.
+    const uint8_t *link_copy(std::vector<uint8_t> &buf) {
+        buf.resize(size_ + 1);
+        uint8_t *copy = buf.data();
+        if (((reinterpret_cast<uintptr_t>(top_)
+                     - reinterpret_cast<uintptr_t>(copy))
+                    & 0xff)
+                == 0)
+            copy++;
+        std::memcpy(copy, top_, size_);
+        uint8_t *const top = top_;
+        top_ = copy;
+        calcJmpAddress();
+        top_ = top;
+        isCalledCalcJmpAddress_ = false;
+        if (!is_initialized()) {
+            Xbyak::ClearError();
+            return nullptr;
+        }
+        return copy;
+    }
+
     inline bool is_valid_isa(cpu_isa_t isa) {
         return is_subset(isa, max_cpu_isa_) && mayiuse(isa);
     }
@@ -2726,6 +2775,17 @@ private:
 
 protected:
     virtual void generate() = 0;
+
+    // Kernels supporting the persistent JIT cache write everything their code
+    // depends on to `key` and return true. Such kernels must not embed
+    // absolute addresses (e.g. pointers to static tables) into the code, and
+    // generate() must not have side effects besides emitting the code, as it
+    // is not called when the code is loaded from the cache.
+    virtual bool serialize_cache_key(serialization_stream_t &key) const {
+        UNUSED(key);
+        return false;
+    }
+
     const Xbyak::uint8 *jit_ker_ = nullptr;
 };
 
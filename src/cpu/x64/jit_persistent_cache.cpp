@@ -0,0 +1,272 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "common/cache_blob.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_persistent_cache.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace jit_persistent_cache {
+
+namespace {
+
+// The file consists of the key, the code with zeroed relocations, the number
+// of relocations, the relocations and the checksum of the preceding data.
+// Bump the version when the layout changes.
+const uint32_t format_version = 2;
+
+// An address within the kernel code that holds the absolute address of
+// `code + addr`, e.g. a jump table entry.
+struct reloc_t {
+    uint64_t offset;
+    uint64_t addr;
+    uint64_t size;
+};
+
+// FNV-1a hash.
+uint64_t get_hash(const uint8_t *data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::string get_file_name(const serialization_stream_t &key) {
+    // The key is stored in the file as well to resolve collisions.
+    const auto &key_data = key.get_data();
+    const uint64_t hash = get_hash(key_data.data(), key_data.size());
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)hash);
+    return get_jit_cache_dir() + "/" + name;
+}
+
+// Returns true if the file or the directory is owned by the user and cannot
+// be modified by others. Only POSIX permissions are checked.
+#if !defined(_WIN32)
+bool is_trusted(const struct stat &st) {
+    return st.st_uid == geteuid() && (st.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+#endif
+
+bool is_trusted_dir(const std::string &dir) {
+#if !defined(_WIN32)
+    struct stat st;
+    return stat(dir.c_str(), &st) == 0 && S_ISDIR(st.st_mode)
+            && is_trusted(st);
+#else
+    return !dir.empty();
+#endif
+}
+
+bool read_file(const std::string &fname, std::vector<uint8_t> &data) {
+    FILE *fp = fopen(fname.c_str(), "rb");
+    if (!fp) return false;
+
+    bool ok = true;
+#if !defined(_WIN32)
+    struct stat st;
+    ok = fstat(fileno(fp), &st) == 0 && S_ISREG(st.st_mode) && is_trusted(st);
+#endif
+    ok = ok && fseek(fp, 0, SEEK_END) == 0;
+    const long size = ok ? ftell(fp) : -1;
+    ok = size > 0 && fseek(fp, 0, SEEK_SET) == 0;
+    if (ok) {
+        data.resize(size);
+        ok = fread(data.data(), data.size(), 1, fp) == 1;
+    }
+    fclose(fp);
+    return ok;
+}
+
+void write_file(const std::string &fname, const std::vector<uint8_t> &data) {
+    // Write to a temporary file first so that concurrent processes never
+    // observe a partially written cache entry.
+    size_t seed = 0;
+    seed = hash_combine(seed, std::this_thread::get_id());
+    seed = hash_combine(seed,
+            std::chrono::steady_clock::now().time_since_epoch().count());
+    const std::string tmp_fname = fname + ".tmp" + std::to_string(seed);
+
+    FILE *fp = fopen(tmp_fname.c_str(), "wb");
+    if (!fp) return;
+    bool ok = fwrite(data.data(), data.size(), 1, fp) == 1;
+    ok = fclose(fp) == 0 && ok;
+    if (!ok || std::rename(tmp_fname.c_str(), fname.c_str()) != 0)
+        std::remove(tmp_fname.c_str());
+}
+
+} // namespace
+
+bool is_enabled() {
+    static const bool enabled = is_trusted_dir(get_jit_cache_dir());
+    return enabled;
+}
+
+void serialize_environment(serialization_stream_t &key, const char *name,
+        cpu_isa_t max_cpu_isa) {
+    key.write(&format_version);
+
+    const size_t name_len = std::strlen(name);
+    key.write(&name_len);
+    key.write(name, name_len);
+
+    key.write(&max_cpu_isa);
+    const cpu_isa_t isa = get_max_cpu_isa();
+    key.write(&isa);
+    key.write(&cpu().displayFamily);
+    key.write(&cpu().displayModel);
+    key.write(&cpu().stepping);
+
+    const auto version = dnnl_version();
+    key.write(&version->major);
+    key.write(&version->minor);
+    key.write(&version->patch);
+    const size_t hash_len = std::strlen(version->hash);
+    key.write(&hash_len);
+    key.write(version->hash, hash_len);
+}
+
+bool load(const serialization_stream_t &key, Xbyak::CodeGenerator &gen) {
+    std::vector<uint8_t> data;
+    if (!read_file(get_file_name(key), data)) return false;
+
+    uint64_t checksum = 0;
+    if (data.size() < sizeof(checksum)) return false;
+    const size_t blob_size = data.size() - sizeof(checksum);
+    std::memcpy(&checksum, data.data() + blob_size, sizeof(checksum));
+    if (checksum != get_hash(data.data(), blob_size)) return false;
+
+    cache_blob_t blob(data.data(), blob_size);
+    const uint8_t *key_ptr = nullptr;
+    size_t key_size = 0;
+    if (blob.get_binary(&key_ptr, &key_size) != status::success) return false;
+    const auto &key_data = key.get_data();
+    if (key_size != key_data.size()
+            || std::memcmp(key_ptr, key_data.data(), key_size) != 0)
+        return false;
+
+    const uint8_t *code = nullptr;
+    size_t code_size = 0;
+    if (blob.get_binary(&code, &code_size) != status::success) return false;
+
+    size_t nrelocs = 0;
+    if (blob.get_value((uint8_t *)&nrelocs, sizeof(nrelocs))
+                    != status::success
+            || nrelocs > code_size)
+        return false;
+    std::vector<reloc_t> relocs(nrelocs);
+    if (nrelocs > 0
+            && blob.get_value((uint8_t *)relocs.data(),
+                       nrelocs * sizeof(reloc_t))
+                    != status::success)
+        return false;
+    for (const auto &r : relocs) {
+        if (!utils::one_of(r.size, 4u, 8u) || r.size > code_size
+                || r.offset > code_size - r.size || r.addr > code_size)
+            return false;
+    }
+
+    gen.db(code, code_size);
+    for (const auto &r : relocs)
+        gen.save(r.offset, r.addr, (int)r.size, Xbyak::inner::LaddTop);
+    return Xbyak::GetError() == Xbyak::ERR_NONE;
+}
+
+void store(const serialization_stream_t &key, const uint8_t *code,
+        const uint8_t *moved_code, size_t size) {
+    if (size == 0) return;
+
+    // The references to the code address are the only bytes that differ
+    // between the two copies. The distance between the copies has a non-zero
+    // low byte, so a reference starts at the first differing byte.
+    const uint64_t addr = reinterpret_cast<uintptr_t>(code);
+    const uint64_t delta = addr - reinterpret_cast<uintptr_t>(moved_code);
+    std::vector<reloc_t> relocs;
+    for (size_t off = 0; off < size;) {
+        if (code[off] == moved_code[off]) {
+            off++;
+            continue;
+        }
+        uint64_t val = 0, moved_val = 0;
+        if (off + sizeof(val) > size) return;
+        std::memcpy(&val, code + off, sizeof(val));
+        std::memcpy(&moved_val, moved_code + off, sizeof(moved_val));
+        // Anything but an absolute address within the code, e.g. a call of
+        // an external function, cannot be relocated.
+        if (val - moved_val != delta || val - addr > size) return;
+        relocs.push_back({off, val - addr, sizeof(val)});
+        off += sizeof(val);
+    }
+
+    // The relocations depend on the code address, zero them to make the
+    // cache entries reproducible.
+    std::vector<uint8_t> code_copy(code, code + size);
+    for (const auto &r : relocs)
+        std::memset(&code_copy[r.offset], 0, r.size);
+
+    const auto &key_data = key.get_data();
+    const size_t nrelocs = relocs.size();
+    const size_t blob_size = sizeof(size_t) + key_data.size() + sizeof(size_t)
+            + size + sizeof(nrelocs) + nrelocs * sizeof(reloc_t);
+    uint64_t checksum = 0;
+    std::vector<uint8_t> data(blob_size + sizeof(checksum));
+    cache_blob_t blob(data.data(), blob_size);
+    bool ok = blob.add_binary(key_data.data(), key_data.size())
+            == status::success;
+    ok = ok
+            && blob.add_binary(code_copy.data(), code_copy.size())
+                    == status::success;
+    ok = ok
+            && blob.add_value((const uint8_t *)&nrelocs, sizeof(nrelocs))
+                    == status::success;
+    ok = ok
+            && (nrelocs == 0
+                    || blob.add_value((const uint8_t *)relocs.data(),
+                               nrelocs * sizeof(reloc_t))
+                            == status::success);
+    if (!ok) return;
+
+    checksum = get_hash(data.data(), blob_size);
+    std::memcpy(data.data() + blob_size, &checksum, sizeof(checksum));
+    write_file(get_file_name(key), data);
+}
+
+} // namespace jit_persistent_cache
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,69 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_PERSISTENT_CACHE_HPP
+#define CPU_X64_JIT_PERSISTENT_CACHE_HPP
+
+#include "common/serialization_stream.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// On-disk cache of generated JIT code enabled by setting the
+// ONEDNN_JIT_CACHE_DIR environment variable to an existing directory. Each
+// kernel is stored in a separate file named after the hash of its key.
+//
+// Only the code generated in the Xbyak AutoGrow mode can be cached. The
+// references to the code address (e.g. tables loaded with mov(reg, label))
+// are found by linking the code at two addresses and are patched when the
+// code is loaded. Code with references to addresses outside of the kernel is
+// never stored.
+//
+// As the files are executed, the directory and the files must be owned by the
+// user and must not be writable by others, otherwise the cache is disabled or
+// the files are ignored. Each file holds a checksum of its content to reject
+// corrupted files.
+namespace jit_persistent_cache {
+
+bool is_enabled();
+
+// Appends everything the generated code depends on besides the kernel
+// configuration: the kernel name, the CPU ISA and the library version.
+void serialize_environment(serialization_stream_t &key, const char *name,
+        cpu_isa_t max_cpu_isa);
+
+// Emits the cached code into `gen` and returns true in the case of a cache
+// hit. `gen` is expected to be empty.
+bool load(const serialization_stream_t &key, Xbyak::CodeGenerator &gen);
+
+// Stores `size` bytes of `code`. `moved_code` is the same code linked at
+// another address, the distance between the addresses must have a non-zero
+// low byte. Failures are not reported as the cache is an optimization only.
+void store(const serialization_stream_t &key, const uint8_t *code,
+        const uint8_t *moved_code, size_t size);
+
+} // namespace jit_persistent_cache
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
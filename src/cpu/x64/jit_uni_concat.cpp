@@ -0,0 +1,636 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+#include "cpu/x64/jit_uni_concat.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace data_type;
+
+namespace {
+cpu_isa_t get_io_isa(cpu_isa_t isa, bool has_f16, bool has_bf16) {
+    // re-using avx512_core instantiation for xf16
+    // re-using avx2 instantiation for xf16
+    if (has_f16 || has_bf16)
+        return is_superset(isa, avx512_core) ? (has_f16    ? avx512_core_fp16
+                               : mayiuse(avx512_core_bf16) ? avx512_core_bf16
+                                                           : avx512_core)
+                                             : avx2_vnni_2;
+    else
+        return isa;
+}
+
+template <cpu_isa_t isa>
+struct kernel_t : public jit_uni_concat_t::kernel_base_t, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_concat_t::kernel_t);
+
+    kernel_t(const jit_uni_concat_t::pd_t *pd, data_type_t src_dt, int tail)
+        : jit_generator(jit_name())
+        , src_dt_(src_dt)
+        , dst_dt_(pd->dst_md()->data_type)
+        , simd_w_(vlen / sizeof(float))
+        , tail_(tail)
+        , use_nt_(pd->use_nt_) {
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx,
+                vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        io::io_saturation_conf_t io_saturation_conf(
+                vmm_zero.getIdx(), vmm_saturation_ubound.getIdx(), reg_tmp);
+        const auto io_isa
+                = get_io_isa(isa, utils::one_of(f16, src_dt_, dst_dt_),
+                        utils::one_of(bf16, src_dt_, dst_dt_));
+        io_src_ = utils::make_unique<io::jit_io_helper_t<Vmm>>(this, io_isa,
+                src_dt_, io::io_conf_t(), io_tail_conf, io_bf16_conf);
+        io_dst_ = utils::make_unique<io::jit_io_helper_t<Vmm>>(this, io_isa,
+                dst_dt_, io::io_conf_t(), io_tail_conf, io_bf16_conf,
+                io_saturation_conf);
+        if (use_nt_)
+            io_dst_nt_ = utils::make_unique<io::jit_io_helper_t<Vmm>>(this,
+                    io_isa, dst_dt_, io::io_conf_t(true), io_tail_conf,
+                    io_bf16_conf, io_saturation_conf);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+    void generate() override {
+        preamble();
+
+        io_src_->init_bf16();
+        io_dst_->init_bf16();
+        if (use_nt_) io_dst_nt_->init_bf16();
+        if (tail_) io_dst_->prepare_tail_mask();
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+        io_dst_->init_saturate_f32();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+        mov(reg_nvec, ptr[reg_param + PARAM_OFF(nvec)]);
+        mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+        mov(reg_src_stride, ptr[reg_param + PARAM_OFF(src_row_stride)]);
+        mov(reg_dst_stride, ptr[reg_param + PARAM_OFF(dst_row_stride)]);
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(scale)]);
+        uni_vbroadcastss(vmm_scale, ptr[reg_tmp]);
+#undef PARAM_OFF
+
+        Label row_loop, row_loop_end;
+        L(row_loop);
+        {
+            cmp(reg_nrows, 0);
+            jle(row_loop_end, T_NEAR);
+
+            mov(reg_src_ptr, reg_src);
+            mov(reg_dst_ptr, reg_dst);
+            mov(reg_cnt, reg_nvec);
+
+            if (use_nt_) {
+                // Non-temporal stores require aligned addresses, rows that
+                // do not start at the vector boundary use regular stores.
+                Label aligned, full_end;
+                test(reg_dst_ptr, dst_vlen() - 1);
+                jz(aligned, T_NEAR);
+                compute_full(*io_dst_);
+                jmp(full_end, T_NEAR);
+                L(aligned);
+                compute_full(*io_dst_nt_);
+                L(full_end);
+            } else
+                compute_full(*io_dst_);
+
+            if (tail_) compute(1, *io_dst_, true);
+
+            add(reg_src, reg_src_stride);
+            add(reg_dst, reg_dst_stride);
+            dec(reg_nrows);
+            jmp(row_loop, T_NEAR);
+        }
+        L(row_loop_end);
+
+        if (use_nt_) sfence();
+
+        postamble();
+    }
+
+    void operator()(const void *src, void *dst, dim_t nvec, dim_t nrows,
+            dim_t src_row_stride, dim_t dst_row_stride,
+            const float *scale) const override {
+        call_params_t p;
+        p.src = src;
+        p.dst = dst;
+        p.nvec = nvec;
+        p.nrows = nrows;
+        p.src_row_stride = src_row_stride;
+        p.dst_row_stride = dst_row_stride;
+        p.scale = scale;
+
+        jit_generator::operator()(&p);
+    }
+
+protected:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    const Xbyak::AddressFrame &vmmword = (isa == avx2) ? yword : zword;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    struct call_params_t {
+        const void *src;
+        void *dst;
+        dim_t nvec;
+        dim_t nrows;
+        dim_t src_row_stride;
+        dim_t dst_row_stride;
+        const float *scale;
+    };
+
+    const data_type_t src_dt_;
+    const data_type_t dst_dt_;
+    const int simd_w_;
+    const int tail_;
+    const bool use_nt_;
+    static constexpr int unroll_ = 4;
+
+    std::unique_ptr<io::jit_io_helper_t<Vmm>> io_src_;
+    std::unique_ptr<io::jit_io_helper_t<Vmm>> io_dst_;
+    std::unique_ptr<io::jit_io_helper_t<Vmm>> io_dst_nt_;
+
+    // Converts `unroll` vectors (or the tail) at reg_src_ptr and reg_dst_ptr.
+    void compute(
+            int unroll, io::jit_io_helper_t<Vmm> &io_dst, bool tail = false) {
+        for (int u = 0; u < unroll; u++)
+            io_src_->load(src_ptr(u * simd_w_), vmm_data(u), tail);
+        for (int u = 0; u < unroll; u++) {
+            uni_vmulps(vmm_data(u), vmm_data(u), vmm_scale);
+            io_dst.store(vmm_data(u), dst_ptr(u * simd_w_), tail);
+        }
+    }
+
+    // Converts reg_cnt full vectors advancing reg_src_ptr and reg_dst_ptr.
+    void compute_full(io::jit_io_helper_t<Vmm> &io_dst) {
+        Label unroll_loop, unroll_loop_end, loop, loop_end;
+        L(unroll_loop);
+        {
+            cmp(reg_cnt, unroll_);
+            jl(unroll_loop_end, T_NEAR);
+            compute(unroll_, io_dst);
+            add(reg_src_ptr, unroll_ * src_vlen());
+            add(reg_dst_ptr, unroll_ * dst_vlen());
+            sub(reg_cnt, unroll_);
+            jmp(unroll_loop, T_NEAR);
+        }
+        L(unroll_loop_end);
+
+        L(loop);
+        {
+            cmp(reg_cnt, 0);
+            jle(loop_end, T_NEAR);
+            compute(1, io_dst);
+            add(reg_src_ptr, src_vlen());
+            add(reg_dst_ptr, dst_vlen());
+            dec(reg_cnt);
+            jmp(loop, T_NEAR);
+        }
+        L(loop_end);
+    }
+
+    // Sizes in bytes of a vector of elements in memory.
+    int src_vlen() const {
+        return simd_w_ * (int)types::data_type_size(src_dt_);
+    }
+    int dst_vlen() const {
+        return simd_w_ * (int)types::data_type_size(dst_dt_);
+    }
+
+    Xbyak::Address src_ptr(size_t offt = 0) {
+        return vmmword[reg_src_ptr + offt * types::data_type_size(src_dt_)];
+    }
+
+    Xbyak::Address dst_ptr(size_t offt = 0) {
+        return vmmword[reg_dst_ptr + offt * types::data_type_size(dst_dt_)];
+    }
+
+    Vmm vmm_data(int u) { return Vmm(4 + u); }
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_src = r8;
+    const Xbyak::Reg64 reg_dst = r9;
+    const Xbyak::Reg64 reg_src_ptr = r10;
+    const Xbyak::Reg64 reg_tmp = r11;
+    const Xbyak::Reg64 reg_dst_ptr = r12;
+    const Xbyak::Reg64 reg_cnt = r13;
+    const Xbyak::Reg64 reg_nvec = r14;
+    const Xbyak::Reg64 reg_nrows = r15;
+    const Xbyak::Reg64 reg_src_stride = rax;
+    const Xbyak::Reg64 reg_dst_stride = rbx;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_zero = Vmm(1);
+    const Vmm vmm_saturation_ubound = Vmm(2);
+    const Vmm vmm_scale = Vmm(3);
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+};
+
+template struct kernel_t<avx2>;
+template struct kernel_t<avx512_core>;
+
+} // namespace
+
+jit_uni_concat_t::kernel_base_t *jit_uni_concat_t::kernel_base_t::create(
+        const pd_t *pd, data_type_t src_dt, int tail) {
+    switch (pd->isa_) {
+        case avx512_core: return new kernel_t<avx512_core>(pd, src_dt, tail);
+        case avx2: return new kernel_t<avx2>(pd, src_dt, tail);
+        default: assert(!"kernel is empty."); return nullptr;
+    }
+}
+
+status_t jit_uni_concat_t::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper dst_d(dst_md());
+    const data_type_t dst_dt = dst_d.data_type();
+
+    auto is_dt_supported = [](data_type_t dt) {
+        return utils::one_of(dt, f32, bf16, f16, s8, u8)
+                && IMPLICATION(
+                        utils::one_of(dt, bf16, f16), mayiuse(avx512_core));
+    };
+
+    using sm = primitive_attr_t::skip_mask_t;
+    bool ok = mayiuse(avx2) && is_dt_supported(dst_dt)
+            && attr()->has_default_values(sm::scales_runtime)
+            && !dst_d.has_zero_dim();
+    if (!ok) return status::unimplemented;
+
+    const auto &scales = attr()->scales_;
+    src_dts_.clear();
+    for (int i = 0; i < n_inputs(); ++i) {
+        const data_type_t src_dt = src_md(i)->data_type;
+        if (!is_dt_supported(src_dt)) return status::unimplemented;
+        if (src_dt_idx(i) == (int)src_dts_.size()) src_dts_.push_back(src_dt);
+        if (scales.get(DNNL_ARG_MULTIPLE_SRC + i).has_default_values())
+            continue;
+        int mask = 0;
+        CHECK(scales.get(DNNL_ARG_MULTIPLE_SRC + i, &mask, nullptr));
+        if (mask != 0) return status::unimplemented;
+    }
+
+    isa_ = mayiuse(avx512_core) ? avx512_core : avx2;
+    simd_w_ = isa_max_vlen(isa_) / sizeof(float);
+
+    // If all the sources share a blocked layout, keep it for the destination
+    // even when the channel offsets of the sources are not multiples of the
+    // block.
+    if (dst_md_.format_kind == format_kind::any) {
+        const memory_desc_wrapper src0_d(src_md(0));
+        bool same_blocking = src0_d.is_blocking_desc() && !src0_d.is_plain();
+        for (int i = 1; i < n_inputs() && same_blocking; ++i)
+            same_blocking = types::blocking_desc_is_equal(
+                    *src_md(i), *src_md(0), true);
+        if (same_blocking)
+            CHECK(memory_desc_init_by_blocking_desc(
+                    dst_md_, src0_d.blocking_desc()));
+    }
+
+    if (cpu_concat_pd_t::init() != status::success
+            || init_dense() != status::success)
+        CHECK(init_c_blocked());
+
+    return status::success;
+}
+
+int jit_uni_concat_t::pd_t::src_dt_idx(int i) const {
+    return static_cast<int>(
+            std::find(src_dts_.begin(), src_dts_.end(), src_md(i)->data_type)
+            - src_dts_.begin());
+}
+
+status_t jit_uni_concat_t::pd_t::init_dense() {
+    const memory_desc_wrapper dst_d(dst_md());
+    const int ndims = dst_d.ndims();
+
+    // Process runs of at least 4096 elements in a single kernel call.
+    chunk_len_ = 4096;
+    c_blocked_ = false;
+    tails_.assign(src_dts_.size(), 1u);
+    inputs_.assign(n_inputs(), input_conf_t());
+    work_off_.assign(n_inputs() + 1, 0);
+
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(src_md(i));
+        const memory_desc_wrapper o_d(src_image_md(i));
+        const bool ignore_strides = true;
+        const bool ok = i_d.is_blocking_desc() && o_d.is_blocking_desc()
+                && types::blocking_desc_is_equal(
+                        *i_d.md_, *o_d.md_, ignore_strides)
+                && !i_d.is_additional_buffer();
+        if (!ok) return status::unimplemented;
+
+        auto &ic = inputs_[i];
+        ic.dt_idx = src_dt_idx(i);
+        ic.src_off = i_d.offset0();
+        ic.dst_off = o_d.offset0();
+
+        const auto &i_bd = i_d.blocking_desc();
+        const auto &o_bd = o_d.blocking_desc();
+        dims_t blocks;
+        i_d.compute_blocks(blocks);
+
+        // Merge the dimensions dense in both the source and its image, from
+        // the innermost one, into the contiguous run.
+        int order[DNNL_MAX_NDIMS];
+        std::iota(order, order + ndims, 0);
+        std::stable_sort(order, order + ndims, [&](int a, int b) {
+            return i_bd.strides[a] < i_bd.strides[b];
+        });
+
+        dim_t len = 1;
+        for (int b = 0; b < i_bd.inner_nblks; ++b)
+            len *= i_bd.inner_blks[b];
+        bool dense = true;
+        for (int k = 0; k < ndims; ++k) {
+            const int d = order[k];
+            const dim_t outer_dim = i_d.padded_dims()[d] / blocks[d];
+            if (outer_dim == 1) continue;
+            if (dense && i_bd.strides[d] == len && o_bd.strides[d] == len) {
+                len *= outer_dim;
+                continue;
+            }
+            dense = false;
+            ic.outer_dims[ic.outer_ndims] = outer_dim;
+            ic.outer_src_strides[ic.outer_ndims] = i_bd.strides[d];
+            ic.outer_dst_strides[ic.outer_ndims] = o_bd.strides[d];
+            ic.outer_ndims++;
+        }
+
+        dim_t outer = 1;
+        for (int k = 0; k < ic.outer_ndims; ++k)
+            outer *= ic.outer_dims[k];
+
+        ic.len = i_d.nelems() == 0 ? 0 : len;
+        ic.nchunks = utils::div_up(ic.len, chunk_len_);
+        work_off_[i + 1] = work_off_[i] + outer * ic.nchunks;
+        add_tail(ic.dt_idx, ic.len);
+    }
+
+    // Non-temporal stores pay off when the data does not fit the cache.
+    const size_t L3_size = static_cast<size_t>(dnnl_get_max_threads())
+            * platform::get_per_core_cache_size(3);
+    use_nt_ = dst_d.size() > L3_size;
+
+    return status::success;
+}
+
+status_t jit_uni_concat_t::pd_t::init_c_blocked() {
+    const memory_desc_wrapper dst_d(dst_md());
+    const int ndims = dst_d.ndims();
+    if (concat_dim() != 1 || !dst_d.is_blocking_desc()
+            || dst_d.blocking_desc().inner_nblks != 1)
+        return status::unimplemented;
+
+    c_blocked_ = true;
+    use_nt_ = false;
+    tails_.assign(src_dts_.size(), 1u);
+    blk_ = dst_d.blocking_desc().inner_blks[0];
+
+    // The only block is over channels and the spatial dimensions are dense.
+    auto is_c_blocked = [&](const memory_desc_wrapper &mdw) {
+        if (!mdw.is_blocking_desc() || mdw.is_additional_buffer())
+            return false;
+        const auto &bd = mdw.blocking_desc();
+        if (bd.inner_nblks != 1 || bd.inner_idxs[0] != 1
+                || bd.inner_blks[0] != blk_)
+            return false;
+        dim_t sp_stride = blk_;
+        for (int d = ndims - 1; d >= 2; --d) {
+            if (mdw.dims()[d] != 1 && bd.strides[d] != sp_stride) return false;
+            sp_stride *= mdw.dims()[d];
+        }
+        return true;
+    };
+
+    if (!is_c_blocked(dst_d)
+            || dst_d.padded_dims()[1] != utils::rnd_up(dst_d.dims()[1], blk_))
+        return status::unimplemented;
+
+    sp_ = 1;
+    for (int d = 2; d < ndims; ++d)
+        sp_ *= dst_d.dims()[d];
+    dst_n_stride_ = dst_d.blocking_desc().strides[0];
+    dst_cb_stride_ = dst_d.blocking_desc().strides[1];
+
+    // Keep the rows of a work item in L1 for the second part of the blocks.
+    size_t src_dt_size = 0;
+    for (const auto dt : src_dts_)
+        src_dt_size = nstl::max(src_dt_size, types::data_type_size(dt));
+    const dim_t row_size
+            = blk_ * (src_dt_size + types::data_type_size(dst_d.data_type()));
+    sp_chunk_ = nstl::max<dim_t>(
+            1, platform::get_per_core_cache_size(1) / 2 / row_size);
+    const dim_t nsp_chunks = utils::div_up(sp_, sp_chunk_);
+
+    inputs_.assign(n_inputs(), input_conf_t());
+    work_off_.assign(n_inputs() + 1, 0);
+
+    dim_t c_off = 0;
+    for (int i = 0; i < n_inputs(); ++i) {
+        const memory_desc_wrapper i_d(src_md(i));
+        if (!is_c_blocked(i_d)) return status::unimplemented;
+
+        auto &ic = inputs_[i];
+        ic.dt_idx = src_dt_idx(i);
+        ic.src_off = i_d.offset0();
+        ic.dst_off = dst_d.offset0();
+        ic.c = i_d.dims()[1];
+        ic.c_off = c_off;
+        ic.src_n_stride = i_d.blocking_desc().strides[0];
+        ic.src_cb_stride = i_d.blocking_desc().strides[1];
+        c_off += ic.c;
+
+        const dim_t ncb = utils::div_up(ic.c, blk_);
+        work_off_[i + 1]
+                = work_off_[i] + dst_d.dims()[0] * ncb * nsp_chunks;
+
+        // A full source block and the last one are split in two parts.
+        const dim_t r = ic.c_off % blk_;
+        const dim_t c_tail = ic.c % blk_ ? ic.c % blk_ : blk_;
+        const dim_t c_tail_first = nstl::min(c_tail, blk_ - r);
+        add_tail(ic.dt_idx, blk_ - r);
+        add_tail(ic.dt_idx, r);
+        add_tail(ic.dt_idx, c_tail_first);
+        add_tail(ic.dt_idx, c_tail - c_tail_first);
+    }
+
+    return status::success;
+}
+
+status_t jit_uni_concat_t::init(engine_t *engine) {
+    const auto &src_dts = pd()->src_dts_;
+    kernels_.resize(src_dts.size());
+    for (size_t d = 0; d < src_dts.size(); ++d) {
+        kernels_[d].resize(pd()->simd_w_);
+        for (int t = 0; t < pd()->simd_w_; ++t) {
+            if (!(pd()->tails_[d] & (1u << t))) continue;
+            CHECK(safe_ptr_assign(kernels_[d][t],
+                    kernel_base_t::create(pd(), src_dts[d], t)));
+            CHECK(kernels_[d][t]->create_kernel());
+        }
+    }
+    return status::success;
+}
+
+void jit_uni_concat_t::copy(int i, const char *src, char *dst, dim_t len,
+        dim_t nrows, dim_t row_stride, const float *scale) const {
+    if (len == 0) return;
+    const int simd_w = pd()->simd_w_;
+    const dim_t src_dt_size = types::data_type_size(pd()->src_md(i)->data_type);
+    const dim_t dst_dt_size = types::data_type_size(pd()->dst_md()->data_type);
+    const int dt_idx = pd()->inputs_[i].dt_idx;
+    (*kernels_[dt_idx][len % simd_w])(src, dst, len / simd_w, nrows,
+            row_stride * src_dt_size, row_stride * dst_dt_size, scale);
+}
+
+status_t jit_uni_concat_t::execute(const exec_ctx_t &ctx) const {
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+    if (dst == nullptr) return status::success;
+
+    const int n = pd()->n_inputs();
+    const auto &scales = pd()->attr()->scales_;
+    static const float one = 1.f;
+
+    std::vector<const char *> srcs(n);
+    std::vector<const float *> src_scales(n, &one);
+    for (int i = 0; i < n; ++i) {
+        const int arg = DNNL_ARG_MULTIPLE_SRC + i;
+        srcs[i] = CTX_IN_MEM(const char *, arg);
+        if (scales.get(arg).has_default_values()) continue;
+        src_scales[i] = CTX_IN_MEM(const float *, DNNL_ARG_ATTR_SCALES | arg);
+        if (src_scales[i] == nullptr) return status::invalid_arguments;
+    }
+
+    const dim_t dst_dt_size = types::data_type_size(pd()->dst_md()->data_type);
+    const auto &work_off = pd()->work_off_;
+    const dim_t work_amount = work_off.back();
+    const dim_t dst_c_total = pd()->dst_md()->dims[1];
+
+    auto execute_dense = [&](int i, dim_t w) {
+        const auto &ic = pd()->inputs_[i];
+        const dim_t src_dt_size
+                = types::data_type_size(pd()->src_md(i)->data_type);
+        dim_t outer = w / ic.nchunks;
+        const dim_t start = (w % ic.nchunks) * pd()->chunk_len_;
+        const dim_t len = nstl::min(pd()->chunk_len_, ic.len - start);
+
+        dim_t src_off = ic.src_off + start, dst_off = ic.dst_off + start;
+        for (int k = 0; k < ic.outer_ndims; ++k) {
+            const dim_t idx = outer % ic.outer_dims[k];
+            outer /= ic.outer_dims[k];
+            src_off += idx * ic.outer_src_strides[k];
+            dst_off += idx * ic.outer_dst_strides[k];
+        }
+        copy(i, srcs[i] + src_off * src_dt_size, dst + dst_off * dst_dt_size,
+                len, 1, 0, src_scales[i]);
+    };
+
+    auto execute_c_blocked = [&](int i, dim_t w) {
+        const auto &ic = pd()->inputs_[i];
+        const dim_t src_dt_size
+                = types::data_type_size(pd()->src_md(i)->data_type);
+        const dim_t blk = pd()->blk_;
+        const dim_t nsp_chunks = utils::div_up(pd()->sp_, pd()->sp_chunk_);
+        const dim_t ncb = utils::div_up(ic.c, blk);
+        const dim_t sp_start = (w % nsp_chunks) * pd()->sp_chunk_;
+        const dim_t cb = (w / nsp_chunks) % ncb;
+        const dim_t mb = w / nsp_chunks / ncb;
+        const dim_t nrows = nstl::min(pd()->sp_chunk_, pd()->sp_ - sp_start);
+
+        const dim_t c = nstl::min(blk, ic.c - cb * blk);
+        const dim_t dst_c = ic.c_off + cb * blk;
+        const dim_t r = dst_c % blk;
+        const dim_t c_first = nstl::min(c, blk - r);
+
+        const dim_t src_off = ic.src_off + mb * ic.src_n_stride
+                + cb * ic.src_cb_stride + sp_start * blk;
+        const dim_t dst_off = ic.dst_off + mb * pd()->dst_n_stride_
+                + (dst_c / blk) * pd()->dst_cb_stride_ + sp_start * blk;
+
+        copy(i, srcs[i] + src_off * src_dt_size,
+                dst + (dst_off + r) * dst_dt_size, c_first, nrows, blk,
+                src_scales[i]);
+        copy(i, srcs[i] + (src_off + c_first) * src_dt_size,
+                dst + (dst_off + pd()->dst_cb_stride_) * dst_dt_size,
+                c - c_first, nrows, blk, src_scales[i]);
+
+        // The work item writing the last channel zeroes the padded channels
+        // of the last destination block.
+        const dim_t dst_c_end = dst_c + c;
+        const dim_t pad_start = dst_c_end % blk;
+        if (dst_c_end != dst_c_total || pad_start == 0) return;
+        char *pad = dst
+                + (ic.dst_off + mb * pd()->dst_n_stride_
+                          + (dst_c_end / blk) * pd()->dst_cb_stride_
+                          + sp_start * blk + pad_start)
+                        * dst_dt_size;
+        for (dim_t sp = 0; sp < nrows; ++sp)
+            std::memset(pad + sp * blk * dst_dt_size, 0,
+                    (blk - pad_start) * dst_dt_size);
+    };
+
+    parallel(0, [&](int ithr, int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        int i = static_cast<int>(std::upper_bound(work_off.begin(),
+                                         work_off.end(), start)
+                - work_off.begin() - 1);
+        for (dim_t w = start; w < end; ++w) {
+            while (w >= work_off[i + 1])
+                ++i;
+            if (srcs[i] == nullptr) continue;
+            if (pd()->c_blocked_)
+                execute_c_blocked(i, w - work_off[i]);
+            else
+                execute_dense(i, w - work_off[i]);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,142 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_CONCAT_HPP
+#define CPU_X64_JIT_UNI_CONCAT_HPP
+
+#include <memory>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_concat_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Concat that converts the data type and applies the input scales on the fly.
+// The sources may have different data types, a kernel is generated for each of
+// them. Two layout cases are supported:
+// - dense: the images of the sources in the destination can be described by
+//   memory descriptors (see concat_pd_t::init()), the copy is done over the
+//   longest run of elements contiguous in both a source and its image;
+// - channel blocked: all tensors share a single channel block (e.g. nChw16c)
+//   and the channel offsets of the sources are not multiples of the block.
+//   Each source block is split between two destination blocks.
+struct jit_uni_concat_t : public primitive_t {
+    struct pd_t : public cpu_concat_pd_t {
+        using cpu_concat_pd_t::cpu_concat_pd_t;
+
+        DECLARE_CONCAT_PD_T("jit:uni", jit_uni_concat_t);
+
+        status_t init(engine_t *engine);
+
+        // Per source copy parameters, sizes and strides are in elements.
+        struct input_conf_t {
+            // Index of the source data type in src_dts_.
+            int dt_idx = 0;
+            dim_t src_off = 0;
+            dim_t dst_off = 0;
+            // dense: the contiguous run and the outer dimensions around it,
+            // innermost first.
+            dim_t len = 0;
+            int outer_ndims = 0;
+            dims_t outer_dims {};
+            dims_t outer_src_strides {};
+            dims_t outer_dst_strides {};
+            dim_t nchunks = 0;
+            // channel blocked: the channels of the source, its channel offset
+            // in the destination and the strides of the mini-batch and
+            // channel blocks.
+            dim_t c = 0;
+            dim_t c_off = 0;
+            dim_t src_n_stride = 0;
+            dim_t src_cb_stride = 0;
+        };
+
+        cpu_isa_t isa_ = isa_undef;
+        int simd_w_ = 0;
+        bool c_blocked_ = false;
+        bool use_nt_ = false;
+        // Distinct data types of the sources.
+        std::vector<data_type_t> src_dts_;
+        // Per source data type, bit `t` is set if a kernel with tail size `t`
+        // is required.
+        std::vector<unsigned> tails_;
+
+        std::vector<input_conf_t> inputs_;
+        // Offsets of the work items of each source.
+        std::vector<dim_t> work_off_;
+
+        // dense
+        dim_t chunk_len_ = 0;
+        // channel blocked
+        dim_t blk_ = 0;
+        dim_t sp_ = 0;
+        dim_t sp_chunk_ = 0;
+        dim_t dst_n_stride_ = 0;
+        dim_t dst_cb_stride_ = 0;
+
+    private:
+        status_t init_dense();
+        status_t init_c_blocked();
+        int src_dt_idx(int i) const;
+        void add_tail(int dt_idx, dim_t len) {
+            tails_[dt_idx] |= 1u << (len % simd_w_);
+        }
+    };
+
+    struct kernel_base_t {
+        // Converts @p nrows rows of @p nvec vectors (plus the tail the kernel
+        // was generated for) from @p src to @p dst multiplying by @p scale.
+        // Row strides are in bytes.
+        virtual void operator()(const void *src, void *dst, dim_t nvec,
+                dim_t nrows, dim_t src_row_stride, dim_t dst_row_stride,
+                const float *scale) const = 0;
+        static kernel_base_t *create(
+                const pd_t *pd, data_type_t src_dt, int tail);
+        virtual status_t create_kernel() = 0;
+        virtual ~kernel_base_t() = default;
+    };
+
+    jit_uni_concat_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Converts @p nrows rows of @p len elements of the source @p i.
+    void copy(int i, const char *src, char *dst, dim_t len, dim_t nrows,
+            dim_t row_stride, const float *scale) const;
+
+    // Indexed by the source data type index and the tail size.
+    std::vector<std::vector<std::unique_ptr<kernel_base_t>>> kernels_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -18,6 +18,7 @@
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
 #include "common/nstl.hpp"
+#include "common/serialization.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
@@ -219,6 +220,16 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         eltwise_injector_->prepare_table();
     }
 
+    bool serialize_cache_key(serialization_stream_t &key) const override {
+        // Below avx512 the tail mask is loaded from a static table by its
+        // absolute address, so the code cannot be reused by other processes.
+        if (!is_superset(isa, avx512_core)) return false;
+        const cpu_isa_t kernel_isa = isa;
+        key.write(&kernel_isa);
+        serialization::serialize_desc(key, *pd_->desc());
+        return true;
+    }
+
 private:
     using Vmm = typename cpu_isa_traits<isa>::Vmm;
 
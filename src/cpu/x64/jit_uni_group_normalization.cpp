@@ -543,6 +543,620 @@ protected:
 template struct kernel_stat_t<avx2>;
 template struct kernel_stat_t<avx512_core>;
 
+// Backward kernels vectorize over channels for channels last layout and over
+// spatial points of a single channel for plain layout. The register layout
+// follows kernel_stat_t: Vmm0 is the tail mask, Vmm1-2 hold the inputs,
+// Vmm3-14 are split between the unrolled per channel values and Vmm15 is a
+// temporary.
+template <cpu_isa_t isa>
+struct kernel_diff_stat_t
+    : public jit_uni_group_normalization_bwd_t::kernel_diff_stat_base_t,
+      public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(
+            jit_uni_group_normalization_bwd_t::kernel_diff_stat_t);
+
+    kernel_diff_stat_t(const jit_uni_group_normalization_bwd_t::pd_t *pd)
+        : jit_generator(jit_name())
+        , src_dt_(pd->src_md()->data_type)
+        , diff_dst_dt_(pd->diff_dst_md()->data_type)
+        , is_nspc_(pd->is_nspc_)
+        , C_(pd->C())
+        , axis_(is_nspc_ ? C_ : pd->D() * pd->H() * pd->W())
+        , simd_w_(vlen / sizeof(float))
+        , axis_simd_tail_(axis_ % simd_w_)
+        , blk_(unroll_ * simd_w_)
+        , nblocks_(axis_ / blk_)
+        , unroll_tail_((axis_ % blk_) / simd_w_) {
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
+                tail_opmask_idx, vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        const auto io_isa = get_io_isa(isa,
+                utils::one_of(f16, src_dt_, diff_dst_dt_),
+                utils::one_of(bf16, src_dt_, diff_dst_dt_));
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, io_isa,
+                {src_dt_, diff_dst_dt_, f32 /* stats */}, io_conf,
+                io_tail_conf, io_bf16_conf);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+    void generate() override {
+        preamble();
+
+        io_.init_bf16();
+        if (axis_simd_tail_) io_.prepare_tail_mask();
+
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_src_start, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_dd_start, ptr[reg_param + PARAM_OFF(diff_dst)]);
+        mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
+        mov(reg_diff_gamma, ptr[reg_param + PARAM_OFF(diff_gamma)]);
+        mov(reg_diff_beta, ptr[reg_param + PARAM_OFF(diff_beta)]);
+#undef PARAM_OFF
+
+        if (is_nspc_)
+            compute_nspc();
+        else
+            compute_ncsp();
+
+        postamble();
+    }
+
+    void operator()(const void *src, const void *diff_dst, const float *mean,
+            float *diff_gamma, float *diff_beta,
+            size_t block_size) const override {
+        ker_args_t args;
+        args.src = src;
+        args.diff_dst = diff_dst;
+        args.mean = mean;
+        args.diff_gamma = diff_gamma;
+        args.diff_beta = diff_beta;
+        args.block_size = block_size;
+
+        jit_generator::operator()(&args);
+    }
+
+protected:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    const Xbyak::AddressFrame &vmmword = (isa == sse41) ? xword
+            : (isa == avx2)                             ? yword
+                                                        : zword;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    struct ker_args_t {
+        const void *src;
+        const void *diff_dst;
+        const float *mean;
+        float *diff_gamma;
+        float *diff_beta;
+        size_t block_size;
+    };
+
+    static constexpr dim_t unroll_ = 4;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+    const data_type_t src_dt_;
+    const data_type_t diff_dst_dt_;
+    const bool is_nspc_;
+    const dim_t C_;
+    // The vectorized axis: channels for nspc, spatial for ncsp.
+    const dim_t axis_;
+    const size_t simd_w_;
+    const dim_t axis_simd_tail_;
+    const dim_t blk_;
+    const dim_t nblocks_;
+    const dim_t unroll_tail_;
+
+    void accumulate(size_t offt_elems, size_t ur, const Vmm &vmm_mean,
+            bool tail = false) {
+        io_[src_dt_]->load(src_ptr(offt_elems), vmm_src, tail);
+        io_[diff_dst_dt_]->load(diff_dst_ptr(offt_elems), vmm_dd, tail);
+        uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        uni_vfmadd231ps(Vmm_diff_gamma(ur), vmm_src, vmm_dd);
+        uni_vaddps(Vmm_diff_beta(ur), Vmm_diff_beta(ur), vmm_dd);
+    }
+
+    void compute_nspc_block(size_t unroll, bool tail = false) {
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_inner_cnt, ptr[reg_param + PARAM_OFF(block_size)]);
+#undef PARAM_OFF
+        for (size_t ur = 0; ur < unroll; ur++) {
+            uni_vpxor(Vmm_diff_gamma(ur), Vmm_diff_gamma(ur),
+                    Vmm_diff_gamma(ur));
+            uni_vpxor(Vmm_diff_beta(ur), Vmm_diff_beta(ur), Vmm_diff_beta(ur));
+            io_[f32]->load(mean_ptr(ur * simd_w_), Vmm_mean(ur), tail);
+        }
+
+        mov(reg_src, reg_src_start);
+        mov(reg_dd, reg_dd_start);
+
+        Xbyak::Label sp_loop, sp_loop_end;
+        L(sp_loop);
+        {
+            test(reg_inner_cnt, reg_inner_cnt);
+            jz(sp_loop_end, T_NEAR);
+
+            for (size_t ur = 0; ur < unroll; ur++)
+                accumulate(ur * simd_w_, ur, Vmm_mean(ur), tail);
+
+            add(reg_src, C_ * types::data_type_size(src_dt_));
+            add(reg_dd, C_ * types::data_type_size(diff_dst_dt_));
+            dec(reg_inner_cnt);
+            jmp(sp_loop);
+        }
+        L(sp_loop_end);
+
+        for (size_t ur = 0; ur < unroll; ur++) {
+            io_[f32]->store(
+                    Vmm_diff_gamma(ur), diff_gamma_ptr(ur * simd_w_), tail);
+            io_[f32]->store(
+                    Vmm_diff_beta(ur), diff_beta_ptr(ur * simd_w_), tail);
+        }
+    }
+
+    void compute_nspc() {
+        const auto advance = [&](dim_t elems) {
+            add(reg_src_start, elems * types::data_type_size(src_dt_));
+            add(reg_dd_start, elems * types::data_type_size(diff_dst_dt_));
+            add(reg_mean, elems * sizeof(float));
+            add(reg_diff_gamma, elems * sizeof(float));
+            add(reg_diff_beta, elems * sizeof(float));
+        };
+
+        if (nblocks_) {
+            mov(reg_outer_cnt, nblocks_);
+            Xbyak::Label c_blk_loop;
+            L(c_blk_loop);
+            {
+                compute_nspc_block(unroll_);
+                advance(blk_);
+                dec(reg_outer_cnt);
+                jnz(c_blk_loop, T_NEAR);
+            }
+        }
+
+        if (unroll_tail_) {
+            compute_nspc_block(unroll_tail_);
+            advance(unroll_tail_ * simd_w_);
+        }
+
+        if (axis_simd_tail_) compute_nspc_block(1, true);
+    }
+
+    // Every channel is a row of spatial points, the accumulators are reduced
+    // to a single value per row.
+    void compute_ncsp() {
+        const dim_t rest = unroll_tail_ * simd_w_ + axis_simd_tail_;
+        const Vmm vmm_mean = Vmm_mean(0);
+
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_outer_cnt, ptr[reg_param + PARAM_OFF(block_size)]);
+#undef PARAM_OFF
+        mov(reg_src, reg_src_start);
+        mov(reg_dd, reg_dd_start);
+
+        Xbyak::Label row_loop, row_loop_end;
+        L(row_loop);
+        {
+            test(reg_outer_cnt, reg_outer_cnt);
+            jz(row_loop_end, T_NEAR);
+
+            uni_vbroadcastss(vmm_mean, dword[reg_mean]);
+            for (dim_t ur = 0; ur < unroll_; ur++) {
+                uni_vpxor(Vmm_diff_gamma(ur), Vmm_diff_gamma(ur),
+                        Vmm_diff_gamma(ur));
+                uni_vpxor(Vmm_diff_beta(ur), Vmm_diff_beta(ur),
+                        Vmm_diff_beta(ur));
+            }
+
+            if (nblocks_) {
+                mov(reg_inner_cnt, nblocks_);
+                Xbyak::Label sp_blk_loop;
+                L(sp_blk_loop);
+                {
+                    for (dim_t ur = 0; ur < unroll_; ur++)
+                        accumulate(ur * simd_w_, ur, vmm_mean);
+                    add(reg_src, blk_ * types::data_type_size(src_dt_));
+                    add(reg_dd, blk_ * types::data_type_size(diff_dst_dt_));
+                    dec(reg_inner_cnt);
+                    jnz(sp_blk_loop, T_NEAR);
+                }
+            }
+            for (dim_t ur = 0; ur < unroll_tail_; ur++)
+                accumulate(ur * simd_w_, ur, vmm_mean);
+            if (axis_simd_tail_)
+                accumulate(
+                        unroll_tail_ * simd_w_, unroll_tail_, vmm_mean, true);
+            if (rest) {
+                add(reg_src, rest * types::data_type_size(src_dt_));
+                add(reg_dd, rest * types::data_type_size(diff_dst_dt_));
+            }
+
+            for (dim_t ur = 1; ur < unroll_; ur++) {
+                uni_vaddps(Vmm_diff_gamma(0), Vmm_diff_gamma(0),
+                        Vmm_diff_gamma(ur));
+                uni_vaddps(
+                        Vmm_diff_beta(0), Vmm_diff_beta(0), Vmm_diff_beta(ur));
+            }
+            horizontal_sum(Vmm_diff_gamma(0));
+            horizontal_sum(Vmm_diff_beta(0));
+            uni_vmovss(dword[reg_diff_gamma],
+                    Xbyak::Xmm(Vmm_diff_gamma(0).getIdx()));
+            uni_vmovss(dword[reg_diff_beta],
+                    Xbyak::Xmm(Vmm_diff_beta(0).getIdx()));
+
+            add(reg_mean, sizeof(float));
+            add(reg_diff_gamma, sizeof(float));
+            add(reg_diff_beta, sizeof(float));
+            dec(reg_outer_cnt);
+            jmp(row_loop, T_NEAR);
+        }
+        L(row_loop_end);
+    }
+
+    // Leaves the sum of the elements of @p vmm in its lowest element.
+    void horizontal_sum(const Vmm &vmm) {
+        const Xbyak::Ymm ymm(vmm.getIdx());
+        const Xbyak::Xmm xmm(vmm.getIdx());
+        if (is_superset(isa, avx512_core)) {
+            vextractf64x4(Xbyak::Ymm(vmm_tmp.getIdx()),
+                    Xbyak::Zmm(vmm.getIdx()), 1);
+            vaddps(ymm, ymm, Xbyak::Ymm(vmm_tmp.getIdx()));
+        }
+        vextractf128(xmm_tmp, ymm, 1);
+        vaddps(xmm, xmm, xmm_tmp);
+        vhaddps(xmm, xmm, xmm);
+        vhaddps(xmm, xmm, xmm);
+    }
+
+    Vmm Vmm_mean(size_t ur = 0) { return Vmm(3 + ur); }
+    Vmm Vmm_diff_gamma(size_t ur = 0) { return Vmm(7 + ur); }
+    Vmm Vmm_diff_beta(size_t ur = 0) { return Vmm(11 + ur); }
+
+    Xbyak::Address src_ptr(size_t offt = 0) {
+        return vmmword[reg_src + offt * types::data_type_size(src_dt_)];
+    }
+
+    Xbyak::Address diff_dst_ptr(size_t offt = 0) {
+        return vmmword[reg_dd + offt * types::data_type_size(diff_dst_dt_)];
+    }
+
+    Xbyak::Address mean_ptr(size_t offt = 0) {
+        return vmmword[reg_mean + offt * sizeof(float)];
+    }
+
+    Xbyak::Address diff_gamma_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_gamma + offt * sizeof(float)];
+    }
+
+    Xbyak::Address diff_beta_ptr(size_t offt = 0) {
+        return vmmword[reg_diff_beta + offt * sizeof(float)];
+    }
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_src = rdx;
+    const Xbyak::Reg64 reg_src_start = rax;
+    const Xbyak::Reg64 reg_dd = rbx;
+    const Xbyak::Reg64 reg_dd_start = rsi;
+    const Xbyak::Reg64 reg_mean = r8;
+    const Xbyak::Reg64 reg_inner_cnt = r9;
+    const Xbyak::Reg64 reg_outer_cnt = r10;
+    const Xbyak::Reg64 reg_tmp = r11;
+    const Xbyak::Reg64 reg_diff_gamma = r12;
+    const Xbyak::Reg64 reg_diff_beta = r13;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_src = Vmm(1);
+    const Vmm vmm_dd = Vmm(2);
+    const Vmm vmm_tmp = Vmm(15);
+    const Xbyak::Xmm xmm_tmp = Xbyak::Xmm(15);
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+};
+
+template struct kernel_diff_stat_t<avx2>;
+template struct kernel_diff_stat_t<avx512_core>;
+
+template <cpu_isa_t isa>
+struct kernel_diff_src_t
+    : public jit_uni_group_normalization_bwd_t::kernel_diff_src_base_t,
+      public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(
+            jit_uni_group_normalization_bwd_t::kernel_diff_src_t);
+
+    kernel_diff_src_t(const jit_uni_group_normalization_bwd_t::pd_t *pd)
+        : jit_generator(jit_name())
+        , src_dt_(pd->src_md()->data_type)
+        , diff_dst_dt_(pd->diff_dst_md()->data_type)
+        , diff_src_dt_(pd->diff_src_md()->data_type)
+        , is_nspc_(pd->is_nspc_)
+        , calculate_diff_stats_(!pd->stats_is_src())
+        , C_(pd->C())
+        , axis_(is_nspc_ ? C_ : pd->D() * pd->H() * pd->W())
+        , simd_w_(vlen / sizeof(float))
+        , axis_simd_tail_(axis_ % simd_w_)
+        , blk_(unroll_ * simd_w_)
+        , nblocks_(axis_ / blk_)
+        , unroll_tail_((axis_ % blk_) / simd_w_) {
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
+                tail_opmask_idx, vmm_tail_mask.getIdx(), reg_tmp);
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        const auto io_isa = get_io_isa(isa,
+                utils::one_of(f16, src_dt_, diff_dst_dt_, diff_src_dt_),
+                utils::one_of(bf16, src_dt_, diff_dst_dt_, diff_src_dt_));
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(this, io_isa,
+                {src_dt_, diff_dst_dt_, diff_src_dt_, f32 /* coeffs */},
+                io_conf, io_tail_conf, io_bf16_conf);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+    void generate() override {
+        preamble();
+
+        io_.init_bf16();
+        if (axis_simd_tail_) io_.prepare_tail_mask();
+
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_src_start, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_dd_start, ptr[reg_param + PARAM_OFF(diff_dst)]);
+        mov(reg_ds_start, ptr[reg_param + PARAM_OFF(diff_src)]);
+        mov(reg_a, ptr[reg_param + PARAM_OFF(a)]);
+        mov(reg_b, ptr[reg_param + PARAM_OFF(b)]);
+        mov(reg_c, ptr[reg_param + PARAM_OFF(c)]);
+#undef PARAM_OFF
+
+        if (is_nspc_)
+            compute_nspc();
+        else
+            compute_ncsp();
+
+        postamble();
+    }
+
+    void operator()(const void *src, const void *diff_dst, void *diff_src,
+            const float *a, const float *b, const float *c,
+            size_t block_size) const override {
+        ker_args_t args;
+        args.src = src;
+        args.diff_dst = diff_dst;
+        args.diff_src = diff_src;
+        args.a = a;
+        args.b = b;
+        args.c = c;
+        args.block_size = block_size;
+
+        jit_generator::operator()(&args);
+    }
+
+protected:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    const Xbyak::AddressFrame &vmmword = (isa == sse41) ? xword
+            : (isa == avx2)                             ? yword
+                                                        : zword;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    struct ker_args_t {
+        const void *src;
+        const void *diff_dst;
+        void *diff_src;
+        const float *a;
+        const float *b;
+        const float *c;
+        size_t block_size;
+    };
+
+    static constexpr dim_t unroll_ = 4;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+    const data_type_t src_dt_;
+    const data_type_t diff_dst_dt_;
+    const data_type_t diff_src_dt_;
+    const bool is_nspc_;
+    // With global statistics diff_src does not depend on src.
+    const bool calculate_diff_stats_;
+    const dim_t C_;
+    // The vectorized axis: channels for nspc, spatial for ncsp.
+    const dim_t axis_;
+    const size_t simd_w_;
+    const dim_t axis_simd_tail_;
+    const dim_t blk_;
+    const dim_t nblocks_;
+    const dim_t unroll_tail_;
+
+    void compute_diff_src(size_t offt_elems, size_t ur, bool tail = false) {
+        io_[diff_dst_dt_]->load(diff_dst_ptr(offt_elems), vmm_dd, tail);
+        uni_vmulps(vmm_dd, vmm_dd, Vmm_a(ur));
+        if (calculate_diff_stats_) {
+            io_[src_dt_]->load(src_ptr(offt_elems), vmm_src, tail);
+            uni_vfmadd231ps(vmm_dd, vmm_src, Vmm_b(ur));
+            uni_vaddps(vmm_dd, vmm_dd, Vmm_c(ur));
+        }
+        io_[diff_src_dt_]->store(vmm_dd, diff_src_ptr(offt_elems), tail);
+    }
+
+    void advance_data(dim_t elems) {
+        add(reg_src, elems * types::data_type_size(src_dt_));
+        add(reg_dd, elems * types::data_type_size(diff_dst_dt_));
+        add(reg_ds, elems * types::data_type_size(diff_src_dt_));
+    }
+
+    void compute_nspc_block(size_t unroll, bool tail = false) {
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_inner_cnt, ptr[reg_param + PARAM_OFF(block_size)]);
+#undef PARAM_OFF
+        for (size_t ur = 0; ur < unroll; ur++) {
+            io_[f32]->load(a_ptr(ur * simd_w_), Vmm_a(ur), tail);
+            if (calculate_diff_stats_) {
+                io_[f32]->load(b_ptr(ur * simd_w_), Vmm_b(ur), tail);
+                io_[f32]->load(c_ptr(ur * simd_w_), Vmm_c(ur), tail);
+            }
+        }
+
+        mov(reg_src, reg_src_start);
+        mov(reg_dd, reg_dd_start);
+        mov(reg_ds, reg_ds_start);
+
+        Xbyak::Label sp_loop, sp_loop_end;
+        L(sp_loop);
+        {
+            test(reg_inner_cnt, reg_inner_cnt);
+            jz(sp_loop_end, T_NEAR);
+
+            for (size_t ur = 0; ur < unroll; ur++)
+                compute_diff_src(ur * simd_w_, ur, tail);
+
+            advance_data(C_);
+            dec(reg_inner_cnt);
+            jmp(sp_loop);
+        }
+        L(sp_loop_end);
+    }
+
+    void compute_nspc() {
+        const auto advance = [&](dim_t elems) {
+            add(reg_src_start, elems * types::data_type_size(src_dt_));
+            add(reg_dd_start, elems * types::data_type_size(diff_dst_dt_));
+            add(reg_ds_start, elems * types::data_type_size(diff_src_dt_));
+            add(reg_a, elems * sizeof(float));
+            add(reg_b, elems * sizeof(float));
+            add(reg_c, elems * sizeof(float));
+        };
+
+        if (nblocks_) {
+            mov(reg_outer_cnt, nblocks_);
+            Xbyak::Label c_blk_loop;
+            L(c_blk_loop);
+            {
+                compute_nspc_block(unroll_);
+                advance(blk_);
+                dec(reg_outer_cnt);
+                jnz(c_blk_loop, T_NEAR);
+            }
+        }
+
+        if (unroll_tail_) {
+            compute_nspc_block(unroll_tail_);
+            advance(unroll_tail_ * simd_w_);
+        }
+
+        if (axis_simd_tail_) compute_nspc_block(1, true);
+    }
+
+    // Every channel is a row of spatial points sharing the coefficients.
+    void compute_ncsp() {
+        const dim_t rest = unroll_tail_ * simd_w_ + axis_simd_tail_;
+
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        mov(reg_outer_cnt, ptr[reg_param + PARAM_OFF(block_size)]);
+#undef PARAM_OFF
+        mov(reg_src, reg_src_start);
+        mov(reg_dd, reg_dd_start);
+        mov(reg_ds, reg_ds_start);
+
+        Xbyak::Label row_loop, row_loop_end;
+        L(row_loop);
+        {
+            test(reg_outer_cnt, reg_outer_cnt);
+            jz(row_loop_end, T_NEAR);
+
+            uni_vbroadcastss(Vmm_a(0), dword[reg_a]);
+            if (calculate_diff_stats_) {
+                uni_vbroadcastss(Vmm_b(0), dword[reg_b]);
+                uni_vbroadcastss(Vmm_c(0), dword[reg_c]);
+            }
+
+            if (nblocks_) {
+                mov(reg_inner_cnt, nblocks_);
+                Xbyak::Label sp_blk_loop;
+                L(sp_blk_loop);
+                {
+                    for (dim_t ur = 0; ur < unroll_; ur++)
+                        compute_diff_src(ur * simd_w_, 0);
+                    advance_data(blk_);
+                    dec(reg_inner_cnt);
+                    jnz(sp_blk_loop, T_NEAR);
+                }
+            }
+            for (dim_t ur = 0; ur < unroll_tail_; ur++)
+                compute_diff_src(ur * simd_w_, 0);
+            if (axis_simd_tail_)
+                compute_diff_src(unroll_tail_ * simd_w_, 0, true);
+            if (rest) advance_data(rest);
+
+            add(reg_a, sizeof(float));
+            add(reg_b, sizeof(float));
+            add(reg_c, sizeof(float));
+            dec(reg_outer_cnt);
+            jmp(row_loop, T_NEAR);
+        }
+        L(row_loop_end);
+    }
+
+    Vmm Vmm_a(size_t ur = 0) { return Vmm(3 + ur); }
+    Vmm Vmm_b(size_t ur = 0) { return Vmm(7 + ur); }
+    Vmm Vmm_c(size_t ur = 0) { return Vmm(11 + ur); }
+
+    Xbyak::Address src_ptr(size_t offt = 0) {
+        return vmmword[reg_src + offt * types::data_type_size(src_dt_)];
+    }
+
+    Xbyak::Address diff_dst_ptr(size_t offt = 0) {
+        return vmmword[reg_dd + offt * types::data_type_size(diff_dst_dt_)];
+    }
+
+    Xbyak::Address diff_src_ptr(size_t offt = 0) {
+        return vmmword[reg_ds + offt * types::data_type_size(diff_src_dt_)];
+    }
+
+    Xbyak::Address a_ptr(size_t offt = 0) {
+        return vmmword[reg_a + offt * sizeof(float)];
+    }
+
+    Xbyak::Address b_ptr(size_t offt = 0) {
+        return vmmword[reg_b + offt * sizeof(float)];
+    }
+
+    Xbyak::Address c_ptr(size_t offt = 0) {
+        return vmmword[reg_c + offt * sizeof(float)];
+    }
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_src = rdx;
+    const Xbyak::Reg64 reg_src_start = rax;
+    const Xbyak::Reg64 reg_dd = rbx;
+    const Xbyak::Reg64 reg_dd_start = rsi;
+    const Xbyak::Reg64 reg_ds = r8;
+    const Xbyak::Reg64 reg_ds_start = abi_not_param1;
+    const Xbyak::Reg64 reg_inner_cnt = r9;
+    const Xbyak::Reg64 reg_outer_cnt = r10;
+    const Xbyak::Reg64 reg_tmp = r11;
+    const Xbyak::Reg64 reg_a = r12;
+    const Xbyak::Reg64 reg_b = r13;
+    const Xbyak::Reg64 reg_c = r14;
+
+    const Vmm vmm_tail_mask = Vmm(0);
+    const Vmm vmm_src = Vmm(1);
+    const Vmm vmm_dd = Vmm(2);
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+    const int tail_opmask_idx = 1;
+};
+
+template struct kernel_diff_src_t<avx2>;
+template struct kernel_diff_src_t<avx512_core>;
+
 } // namespace
 
 jit_uni_group_normalization_fwd_t::kernel_base_t *
@@ -688,6 +1302,178 @@ status_t jit_uni_group_normalization_fwd_t::execute_forward(
     return status::success;
 }
 
+jit_uni_group_normalization_bwd_t::kernel_diff_stat_base_t *
+jit_uni_group_normalization_bwd_t::kernel_diff_stat_base_t::create(
+        const pd_t *pd) {
+    if (mayiuse(avx512_core)) {
+        return new kernel_diff_stat_t<avx512_core>(pd);
+    } else if (mayiuse(avx2)) {
+        return new kernel_diff_stat_t<avx2>(pd);
+    } else {
+        assert(!"kernel is empty.");
+        return nullptr;
+    }
+}
+
+jit_uni_group_normalization_bwd_t::kernel_diff_src_base_t *
+jit_uni_group_normalization_bwd_t::kernel_diff_src_base_t::create(
+        const pd_t *pd) {
+    if (mayiuse(avx512_core)) {
+        return new kernel_diff_src_t<avx512_core>(pd);
+    } else if (mayiuse(avx2)) {
+        return new kernel_diff_src_t<avx2>(pd);
+    } else {
+        assert(!"kernel is empty.");
+        return nullptr;
+    }
+}
+
+status_t jit_uni_group_normalization_bwd_t::execute_backward(
+        const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    const auto mean = CTX_IN_MEM(const float *, DNNL_ARG_MEAN);
+    const auto variance = CTX_IN_MEM(const float *, DNNL_ARG_VARIANCE);
+    const auto diff_dst = CTX_IN_MEM(const void *, DNNL_ARG_DIFF_DST);
+    const auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
+
+    auto diff_src = CTX_OUT_MEM(void *, DNNL_ARG_DIFF_SRC);
+    auto diff_scale = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SCALE);
+    auto diff_shift = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_SHIFT);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper diff_dst_d(pd()->diff_dst_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+
+    const dim_t N = pd()->MB();
+    const dim_t C = pd()->C();
+    const dim_t G = pd()->desc()->groups;
+    const dim_t C_PER_G = C / G;
+    const dim_t SP = pd()->D() * pd()->H() * pd()->W();
+    const dim_t CSP = C_PER_G * SP;
+    const float eps = pd()->desc()->group_norm_epsilon;
+
+    const bool is_nspc = pd()->is_nspc_;
+    const bool calculate_diff_stats = !pd()->stats_is_src();
+    const int nthr = pd()->nthr_;
+    const dim_t n_parts = is_nspc ? nthr : 1;
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *part_diff_gamma
+            = scratchpad.template get<float>(key_gnorm_reduction);
+    float *part_diff_beta = part_diff_gamma + N * n_parts * C;
+    float *diff_gamma = part_diff_beta + N * n_parts * C;
+    float *diff_beta = diff_gamma + C;
+    float *mean_c = scratchpad.template get<float>(key_gnorm_tmp_mean);
+    float *coeff_a = scratchpad.template get<float>(key_gnorm_diff_coeffs);
+    float *coeff_b = coeff_a + N * C;
+    float *coeff_c = coeff_b + N * C;
+
+    const auto rcp_sqrt_var = [&](dim_t n, dim_t g) {
+        return 1.f / sqrtf(variance[n * G + g] + eps);
+    };
+
+    // Kernels take a value per channel.
+    parallel_nd(N, C, [&](dim_t n, dim_t c) {
+        mean_c[n * C + c] = mean[n * G + c / C_PER_G];
+    });
+
+    // Data of ncsp is a sequence of N * C rows of SP elements, so both
+    // passes split the rows between threads. Data of nspc is split along the
+    // spatial dimension and each thread keeps its own partial sums.
+    const char *src_base = static_cast<const char *>(src);
+    const char *diff_dst_base = static_cast<const char *>(diff_dst);
+    char *diff_src_base = static_cast<char *>(diff_src);
+    const size_t src_dt_size = src_d.data_type_size();
+    const size_t diff_dst_dt_size = diff_dst_d.data_type_size();
+    const size_t diff_src_dt_size = diff_src_d.data_type_size();
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        if (is_nspc) {
+            dim_t SP_start = 0, SP_end = 0;
+            balance211(SP, nthr, ithr, SP_start, SP_end);
+            for (dim_t n = 0; n < N; ++n) {
+                const dim_t off = (n * SP + SP_start) * C;
+                const dim_t part_off = (n * n_parts + ithr) * C;
+                (*kernel_diff_stat_)(src_base + off * src_dt_size,
+                        diff_dst_base + off * diff_dst_dt_size, mean_c + n * C,
+                        part_diff_gamma + part_off, part_diff_beta + part_off,
+                        SP_end - SP_start);
+            }
+        } else {
+            dim_t row_start = 0, row_end = 0;
+            balance211(N * C, nthr, ithr, row_start, row_end);
+            if (row_start == row_end) return;
+            const dim_t off = row_start * SP;
+            (*kernel_diff_stat_)(src_base + off * src_dt_size,
+                    diff_dst_base + off * diff_dst_dt_size, mean_c + row_start,
+                    part_diff_gamma + row_start, part_diff_beta + row_start,
+                    row_end - row_start);
+        }
+    });
+
+    parallel_nd(C, [&](dim_t c) {
+        const dim_t g = c / C_PER_G;
+        float d_gamma = 0.f, d_beta = 0.f;
+        for (dim_t n = 0; n < N; ++n) {
+            float loc_d_gamma = 0.f;
+            for (dim_t p = 0; p < n_parts; ++p) {
+                loc_d_gamma += part_diff_gamma[(n * n_parts + p) * C + c];
+                d_beta += part_diff_beta[(n * n_parts + p) * C + c];
+            }
+            d_gamma += loc_d_gamma * rcp_sqrt_var(n, g);
+        }
+        diff_gamma[c] = d_gamma;
+        diff_beta[c] = d_beta;
+        if (diff_scale) diff_scale[c] = d_gamma;
+        if (diff_shift) diff_shift[c] = d_beta;
+    });
+
+    // diff_src = a * diff_dst + b * src + c, see the reference implementation
+    // for the formula the coefficients are derived from.
+    parallel_nd(N, C, [&](dim_t n, dim_t c) {
+        const dim_t off = n * C + c;
+        const float rcp = rcp_sqrt_var(n, c / C_PER_G);
+        const float gamma = scale ? scale[c] : 1.f;
+        const float a = rcp * gamma;
+        coeff_a[off] = a;
+        if (calculate_diff_stats) {
+            const float b = -a * diff_gamma[c] * rcp / CSP;
+            coeff_b[off] = b;
+            coeff_c[off] = -a * diff_beta[c] / CSP - b * mean_c[off];
+        }
+    });
+
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        if (is_nspc) {
+            dim_t SP_start = 0, SP_end = 0;
+            balance211(SP, nthr, ithr, SP_start, SP_end);
+            if (SP_start == SP_end) return;
+            for (dim_t n = 0; n < N; ++n) {
+                const dim_t off = (n * SP + SP_start) * C;
+                (*kernel_diff_src_)(src_base + off * src_dt_size,
+                        diff_dst_base + off * diff_dst_dt_size,
+                        diff_src_base + off * diff_src_dt_size,
+                        coeff_a + n * C, coeff_b + n * C, coeff_c + n * C,
+                        SP_end - SP_start);
+            }
+        } else {
+            dim_t row_start = 0, row_end = 0;
+            balance211(N * C, nthr, ithr, row_start, row_end);
+            if (row_start == row_end) return;
+            const dim_t off = row_start * SP;
+            (*kernel_diff_src_)(src_base + off * src_dt_size,
+                    diff_dst_base + off * diff_dst_dt_size,
+                    diff_src_base + off * diff_src_dt_size,
+                    coeff_a + row_start, coeff_b + row_start,
+                    coeff_c + row_start, row_end - row_start);
+        }
+    });
+
+    return status::success;
+}
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
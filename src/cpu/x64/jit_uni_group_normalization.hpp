@@ -141,6 +141,120 @@ protected:
     std::unique_ptr<kernel_stat_base_t> kernel_var_;
 };
 
+struct jit_uni_group_normalization_bwd_t : public primitive_t {
+    using primitive_t::primitive_t;
+
+    struct pd_t : public cpu_group_normalization_bwd_pd_t {
+        using cpu_group_normalization_bwd_pd_t::
+                cpu_group_normalization_bwd_pd_t;
+
+        DECLARE_COMMON_PD_T("jit:uni", jit_uni_group_normalization_bwd_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using namespace format_tag;
+
+            VDISPATCH_GNORM(!is_fwd(), VERBOSE_BAD_PROPKIND);
+            VDISPATCH_GNORM(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+            VDISPATCH_GNORM(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+            for (const auto *md : {src_md(), diff_dst_md(), diff_src_md()}) {
+                VDISPATCH_GNORM(utils::one_of(md->data_type, f32, bf16, f16)
+                                && IMPLICATION(md->data_type != f32,
+                                        mayiuse(avx512_core)),
+                        VERBOSE_UNSUPPORTED_DT);
+            }
+            VDISPATCH_GNORM(
+                    check_scale_shift_data_type(), VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_GNORM(
+                    attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_GNORM(
+                    set_default_formats_common(), VERBOSE_UNSUPPORTED_TAG);
+
+            const auto nspc_tag = memory_desc_matches_one_of_tag(
+                    *src_md(), ndhwc, nhwc, nwc);
+            const auto ncsp_tag = memory_desc_matches_one_of_tag(
+                    *src_md(), ncdhw, nchw, ncw);
+            is_nspc_ = nspc_tag != format_tag::undef;
+            const auto tag = is_nspc_ ? nspc_tag : ncsp_tag;
+            VDISPATCH_GNORM(tag != format_tag::undef, VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_GNORM(memory_desc_matches_tag(*diff_dst_md(), tag)
+                            && memory_desc_matches_tag(*diff_src_md(), tag),
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            nthr_ = dnnl_get_max_threads();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        bool is_nspc_ = true;
+        int nthr_; // To not exceed the limit in execute used for set up.
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            // Partial sums of diff_gamma and diff_beta per spatial chunk for
+            // channels last and per sample for plain layout, followed by the
+            // reduced values.
+            const size_t n_parts = is_nspc_ ? nthr_ : 1;
+            scratchpad.template book<float>(
+                    key_gnorm_reduction, 2 * (MB() * n_parts + 1) * C());
+            // Mean broadcast over the channels of each group.
+            scratchpad.template book<float>(key_gnorm_tmp_mean, MB() * C());
+            // Coefficients of diff_src as a linear function of diff_dst and
+            // src.
+            scratchpad.template book<float>(
+                    key_gnorm_diff_coeffs, 3 * MB() * C());
+        }
+    };
+
+    status_t init(engine_t *engine) override {
+        CHECK(safe_ptr_assign(
+                kernel_diff_stat_, kernel_diff_stat_base_t::create(pd())));
+        CHECK(safe_ptr_assign(
+                kernel_diff_src_, kernel_diff_src_base_t::create(pd())));
+        if (kernel_diff_stat_) CHECK(kernel_diff_stat_->create_kernel());
+        if (kernel_diff_src_) CHECK(kernel_diff_src_->create_kernel());
+        return status::success;
+    }
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        return execute_backward(ctx);
+    }
+
+    // Computes sum(diff_dst * (src - mean)) and sum(diff_dst). For channels
+    // last the sums are per channel over @p block_size spatial points, for
+    // plain layout they are over the spatial points of each of @p block_size
+    // consecutive channels. @p mean holds a value per channel.
+    struct kernel_diff_stat_base_t {
+        virtual void operator()(const void *src, const void *diff_dst,
+                const float *mean, float *diff_gamma, float *diff_beta,
+                size_t block_size) const = 0;
+        static kernel_diff_stat_base_t *create(const pd_t *pd);
+        virtual status_t create_kernel() = 0;
+        virtual ~kernel_diff_stat_base_t() = default;
+    };
+
+    // Computes diff_src = a * diff_dst + b * src + c with per channel
+    // coefficients over the same blocks as kernel_diff_stat_base_t.
+    struct kernel_diff_src_base_t {
+        virtual void operator()(const void *src, const void *diff_dst,
+                void *diff_src, const float *a, const float *b,
+                const float *c, size_t block_size) const = 0;
+        static kernel_diff_src_base_t *create(const pd_t *pd);
+        virtual status_t create_kernel() = 0;
+        virtual ~kernel_diff_src_base_t() = default;
+    };
+
+protected:
+    status_t execute_backward(const exec_ctx_t &ctx) const;
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<kernel_diff_stat_base_t> kernel_diff_stat_;
+    std::unique_ptr<kernel_diff_src_base_t> kernel_diff_src_;
+};
+
 } // namespace x64
 } // namespace cpu
 } // namespace impl
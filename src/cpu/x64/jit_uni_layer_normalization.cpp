@@ -89,6 +89,7 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         , use_shift_(pd_->use_shift())
         , save_stats_(pd_->is_training())
         , calculate_stats_(!pd_->stats_are_src())
+        , skip_mean_(pd_->skip_mean())
         , eps_(pd_->desc()->layer_norm_epsilon)
         , has_ne_convert_src_xf16_(isa == avx2 && mayiuse(avx2_vnni_2)
                   && utils::one_of(src_d_.data_type(), data_type::f16,
@@ -142,6 +143,7 @@ protected:
     const bool use_shift_;
     const bool save_stats_;
     const bool calculate_stats_;
+    const bool skip_mean_;
     const float eps_;
     const bool has_ne_convert_src_xf16_;
 
@@ -363,13 +365,15 @@ protected:
         if (has_ne_convert_src_xf16_)
             compute_ne_convert_xf16(vmm_inv_sqrtvar,
                     [&](Vmm vmm_dst, Vmm vmm_src, bool need_tail) {
-                        uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
+                        if (!skip_mean_)
+                            uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
                         uni_vfmadd231ps(vmm_dst, vmm_src, vmm_src);
                     });
         else
             compute(vmm_inv_sqrtvar,
                     [&](Vmm vmm_dst, Vmm vmm_src, bool need_tail) {
-                        uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
+                        if (!skip_mean_)
+                            uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
                         uni_vfmadd231ps(vmm_dst, vmm_src, vmm_src);
                     });
         if (save_stats_)
@@ -390,7 +394,7 @@ protected:
             if (use_shift_)
                 io_[f32]->load(
                         shift_ptr(offt_elems + j * simd_w_), vmm_shift, tail);
-            uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
+            if (!skip_mean_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
             uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
             if (use_scale_ && use_shift_)
                 uni_vfmadd213ps(vmm_dst, vmm_scale, vmm_shift);
@@ -412,7 +416,7 @@ protected:
             io_[f32]->load(shift_ptr(offt_elems), vmm_shift, tail);
         }
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_dst, tail);
-        uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
+        if (!skip_mean_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
         uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
         if (use_scale_ && use_shift_)
             uni_vfmadd213ps(vmm_dst, vmm_scale, vmm_shift);
@@ -485,13 +489,15 @@ protected:
             jle(end, T_NEAR);
 
             if (calculate_stats_) {
-                // compute stats
-                compute_mean();
+                // compute stats, RMS normalization needs the variance only
+                if (!skip_mean_) compute_mean();
                 compute_var();
             } else {
                 // read mean and var from input
-                uni_vmovss(xmm_tmp, dword[reg_mean]);
-                uni_vbroadcastss(vmm_mean, xmm_tmp);
+                if (!skip_mean_) {
+                    uni_vmovss(xmm_tmp, dword[reg_mean]);
+                    uni_vbroadcastss(vmm_mean, xmm_tmp);
+                }
                 uni_vmovss(xmm_tmp, dword[reg_var]);
                 uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
             }
@@ -631,6 +637,7 @@ struct jit_diff_ss_kernel_t : diff_ss_kernel_t, public jit_generator {
         , C_(pd_->norm_axis())
         , axis_simd_full_(C_ / simd_w_)
         , axis_simd_tail_(C_ % simd_w_)
+        , skip_mean_(pd_->skip_mean())
         , eps_(pd_->desc()->layer_norm_epsilon) {
 
         io::io_conf_t io_conf;
@@ -670,6 +677,7 @@ protected:
     const dim_t C_;
     const dim_t axis_simd_full_;
     const dim_t axis_simd_tail_;
+    const bool skip_mean_;
     const float eps_;
 
     const Reg64 reg_param = abi_param1;
@@ -720,7 +728,7 @@ protected:
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
 
         uni_vaddps(vmm_dshift, vmm_dshift, vmm_ddst);
-        uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        if (!skip_mean_) uni_vsubps(vmm_src, vmm_src, vmm_mean);
         uni_vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
         uni_vfmadd231ps(vmm_dscale, vmm_src, vmm_ddst);
 
@@ -759,8 +767,10 @@ protected:
             cmp(reg_block_end, reg_src);
             jle(end, T_NEAR);
 
-            uni_vmovss(xmm_tmp, dword[reg_mean]);
-            uni_vbroadcastss(vmm_mean, xmm_tmp);
+            if (!skip_mean_) {
+                uni_vmovss(xmm_tmp, dword[reg_mean]);
+                uni_vbroadcastss(vmm_mean, xmm_tmp);
+            }
             uni_vmovss(xmm_tmp, dword[reg_inv_sqrtvar]);
             uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
 
@@ -771,7 +781,7 @@ protected:
 
             add(reg_src, c_src_size);
             add(reg_diff_dst, c_ddst_size);
-            add(reg_mean, float_size);
+            if (!skip_mean_) add(reg_mean, float_size);
             add(reg_inv_sqrtvar, float_size);
             jmp(unroll_loop);
         }
@@ -825,7 +835,8 @@ struct jit_diff_data_base_kernel_t : diff_data_kernel_t, public jit_generator {
         , axis_simd_tail_(C_ % simd_w_)
         , use_scale_(pd_->use_scale())
         , use_shift_(pd_->use_shift())
-        , calculate_diff_stats_(!pd_->stats_are_src()) {
+        , calculate_diff_stats_(!pd_->stats_are_src())
+        , skip_mean_(pd_->skip_mean()) {
 
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
@@ -871,6 +882,7 @@ protected:
     const bool use_scale_;
     const bool use_shift_;
     const bool calculate_diff_stats_;
+    const bool skip_mean_;
 
     const Reg64 reg_param = abi_param1;
     const Reg64 reg_src = rdx;
@@ -929,8 +941,12 @@ protected:
         }
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
 
-        uni_vaddps(vmm_dd_scale, vmm_dd_scale, vmm_ddst);
-        uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        // The mean is a constant zero for RMS normalization and its gradient
+        // term is dropped.
+        if (!skip_mean_) {
+            uni_vaddps(vmm_dd_scale, vmm_dd_scale, vmm_ddst);
+            uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        }
         uni_vfmadd231ps(vmm_dd_scale_x, vmm_ddst, vmm_src);
     };
 
@@ -943,9 +959,12 @@ protected:
         }
         if (calculate_diff_stats_) {
             io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
-            uni_vsubps(vmm_src, vmm_src, vmm_mean);
+            if (!skip_mean_) uni_vsubps(vmm_src, vmm_src, vmm_mean);
             uni_vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
-            uni_vfmadd213ps(vmm_src, vmm_dd_scale_x, vmm_dd_scale);
+            if (skip_mean_)
+                uni_vmulps(vmm_src, vmm_src, vmm_dd_scale_x);
+            else
+                uni_vfmadd213ps(vmm_src, vmm_dd_scale_x, vmm_dd_scale);
             uni_vdivps(vmm_src, vmm_src, vmm_C);
             uni_vsubps(vmm_dsrc, vmm_dsrc, vmm_src);
         }
@@ -973,7 +992,7 @@ protected:
         mov(reg_diff_src, ptr[reg_param + PARAM_OFF(diff_src)]);
         mov(reg_scale, ptr[reg_param + PARAM_OFF(ss)]);
 
-        if (calculate_diff_stats_)
+        if (calculate_diff_stats_ && !skip_mean_)
             mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
         mov(reg_inv_sqrtvar, ptr[reg_param + PARAM_OFF(inv_sqrtvar)]);
         mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
@@ -996,8 +1015,10 @@ protected:
             uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
 
             if (calculate_diff_stats_) {
-                uni_vmovss(xmm_tmp, dword[reg_mean]);
-                uni_vbroadcastss(vmm_mean, xmm_tmp);
+                if (!skip_mean_) {
+                    uni_vmovss(xmm_tmp, dword[reg_mean]);
+                    uni_vbroadcastss(vmm_mean, xmm_tmp);
+                }
 
                 uni_vpxor(vmm_dd_scale, vmm_dd_scale, vmm_dd_scale);
                 uni_vpxor(vmm_dd_scale_x, vmm_dd_scale_x, vmm_dd_scale_x);
@@ -1007,7 +1028,7 @@ protected:
                 if (axis_simd_tail_)
                     compute_dd_scales(axis_simd_full_ * simd_w_, true);
 
-                reduce(vmm_dd_scale, vmm_tmp);
+                if (!skip_mean_) reduce(vmm_dd_scale, vmm_tmp);
                 reduce(vmm_dd_scale_x, vmm_tmp);
                 uni_vmulps(vmm_dd_scale_x, vmm_dd_scale_x, vmm_inv_sqrtvar);
             }
@@ -1020,7 +1041,7 @@ protected:
             add(reg_src, c_src_size);
             add(reg_diff_dst, c_ddst_size);
             add(reg_diff_src, c_dsrc_size);
-            if (calculate_diff_stats_) add(reg_mean, float_size);
+            if (calculate_diff_stats_ && !skip_mean_) add(reg_mean, float_size);
             add(reg_inv_sqrtvar, float_size);
             jmp(unroll_loop);
         }
@@ -1119,7 +1140,8 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
         char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
                 + N_start * C_padded * dst_d.data_type_size();
         const int block_size = N_end - N_start;
-        (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, &mean[N_start],
+        float *const mean_ptr = pd()->skip_mean() ? nullptr : &mean[N_start];
+        (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, mean_ptr,
                 &variance[N_start], src_scales, dst_scales, block_size);
     });
     return status::success;
@@ -1186,8 +1208,9 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
             my_diff_gamma[c] = 0.;
             my_diff_beta[c] = 0.;
         }
+        const float *mean_ptr = pd()->skip_mean() ? nullptr : &mean[N_start];
         (*diff_ss_kernel_)(src_ptr, diff_dst_ptr, my_diff_gamma, my_diff_beta,
-                &mean[N_start], &variance[N_start], &inv_sqrtvar[N_start],
+                mean_ptr, &variance[N_start], &inv_sqrtvar[N_start],
                 block_size);
     });
 
@@ -1214,8 +1237,9 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
         char *const __restrict diff_src_ptr = reinterpret_cast<char *>(diff_src)
                 + N_start * C_padded * diff_src_d.data_type_size();
 
+        const float *mean_ptr = pd()->skip_mean() ? nullptr : &mean[N_start];
         (*diff_data_kernel_)(src_ptr, diff_dst_ptr, diff_src_ptr, scale,
-                &mean[N_start], &inv_sqrtvar[N_start], block_size);
+                mean_ptr, &inv_sqrtvar[N_start], block_size);
     });
     return status::success;
 }
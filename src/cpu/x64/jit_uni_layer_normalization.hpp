@@ -193,8 +193,9 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
 
         // reorder input stats
         if (pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, ctx.args().at(DNNL_ARG_MEAN), {&mean, false});
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {&mean, false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {&variance, false});
         }
@@ -202,8 +203,9 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
         if (status != status::success) return status;
         // reorder output stats
         if (!pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, {&mean, true}, ctx.args().at(DNNL_ARG_MEAN));
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, {&mean, true},
+                        ctx.args().at(DNNL_ARG_MEAN));
             reorder_stat(ctx, engine, {&variance, true},
                     ctx.args().at(DNNL_ARG_VARIANCE));
         }
@@ -336,8 +338,9 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
                     engine, &(pd()->reordered_stat_md_), std::move(mean_mem));
             memory_t variance(engine, &(pd()->reordered_stat_md_),
                     std::move(variance_mem));
-            reorder_stat(
-                    ctx, engine, ctx.args().at(DNNL_ARG_MEAN), {&mean, false});
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {&mean, false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {&variance, false});
         }
@@ -109,6 +109,39 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
 
     status_t create_kernel() override { return jit_generator::create_kernel(); }
 
+    bool serialize_cache_key(serialization_stream_t &key) const override {
+        key.write(&desc_.id);
+        key.write(&prb_.itype);
+        key.write(&prb_.otype);
+        key.write(&prb_.ndims);
+        for (int d = 0; d < prb_.ndims; d++) {
+            const auto &node = prb_.nodes[d];
+            key.write(&node.n);
+            key.write(&node.tail_size);
+            key.write(&node.dim_id);
+            key.write(&node.parent_node_id);
+            key.write(&node.is_zero_pad_needed);
+            key.write(&node.is);
+            key.write(&node.os);
+            key.write(&node.ss);
+            key.write(&node.cs);
+        }
+        key.write(&prb_.ioff);
+        key.write(&prb_.ooff);
+        key.write(&prb_.src_scale_type);
+        key.write(&prb_.dst_scale_type);
+        key.write(&prb_.beta);
+        key.write(&prb_.full_ndims);
+        key.write(&prb_.is_tail_present);
+        key.write(&prb_.scale_adjust);
+        key.write(&prb_.compensation_mask);
+        key.write(&prb_.req_s8s8_comp);
+        key.write(&prb_.req_asymmetric_comp);
+        key.write(&prb_.req_src_zp);
+        key.write(&prb_.req_dst_zp);
+        return true;
+    }
+
     enum class scale_arg_t { NONE, SRC, DST };
 
     enum {
@@ -0,0 +1,407 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+#include "cpu/x64/jit_uni_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace data_type;
+using namespace memory_tracking::names;
+
+namespace {
+
+template <cpu_isa_t isa>
+struct kernel_t : public jit_uni_topk_t::kernel_base_t, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_topk_t::kernel_t);
+
+    kernel_t(const jit_uni_topk_t::pd_t *pd)
+        : jit_generator(jit_name())
+        , src_dt_(pd->src_md()->data_type)
+        , simd_w_(vlen / sizeof(float)) {
+        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx,
+                bf16_emu_zmm_2_idx, bf16_emu_zmm_3_idx, reg_tmp,
+                bf16_emu_zmm_4_idx);
+        // Only the loads are generated, xf16 support is checked by pd_t.
+        const auto io_isa = src_dt_ == f16 ? avx512_core_fp16 : isa;
+        io_src_ = utils::make_unique<io::jit_io_helper_t<Vmm>>(this, io_isa,
+                src_dt_, io::io_conf_t(), utils::nullopt, io_bf16_conf);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+    void generate() override {
+        preamble();
+
+        io_src_->init_bf16();
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+        mov(reg_len, ptr[reg_param + PARAM_OFF(len)]);
+        uni_vbroadcastss(vmm_threshold, ptr[reg_param + PARAM_OFF(threshold)]);
+        xor_(reg_pos, reg_pos);
+
+        // The unrolled loop only checks whether any of the vectors has a
+        // candidate, the vector loop below locates it.
+        Label unroll_loop, unroll_loop_end, loop, found, done;
+        L(unroll_loop);
+        {
+            mov(reg_tmp, reg_len);
+            sub(reg_tmp, reg_pos);
+            cmp(reg_tmp, unroll_ * simd_w_);
+            jl(unroll_loop_end, T_NEAR);
+
+            for (int u = 0; u < unroll_; u++)
+                compare(u, u * src_vlen());
+            if (is_superset(isa, avx512_core)) {
+                korw(k_any_0, kmask(0), kmask(1));
+                korw(k_any_1, kmask(2), kmask(3));
+                kortestw(k_any_0, k_any_1);
+            } else {
+                vorps(vmm_any_0, vmm_data(0), vmm_data(1));
+                vorps(vmm_any_1, vmm_data(2), vmm_data(3));
+                vorps(vmm_any_0, vmm_any_0, vmm_any_1);
+                vtestps(vmm_any_0, vmm_any_0);
+            }
+            jnz(unroll_loop_end, T_NEAR);
+
+            add(reg_src, unroll_ * src_vlen());
+            add(reg_pos, unroll_ * simd_w_);
+            jmp(unroll_loop, T_NEAR);
+        }
+        L(unroll_loop_end);
+
+        L(loop);
+        {
+            mov(reg_tmp, reg_len);
+            sub(reg_tmp, reg_pos);
+            cmp(reg_tmp, simd_w_);
+            jl(done, T_NEAR);
+
+            compare(0, 0);
+            if (is_superset(isa, avx512_core))
+                kmovw(reg_mask.cvt32(), kmask(0));
+            else
+                vmovmskps(reg_mask.cvt32(), vmm_data(0));
+            test(reg_mask, reg_mask);
+            jnz(found, T_NEAR);
+
+            add(reg_src, src_vlen());
+            add(reg_pos, simd_w_);
+            jmp(loop, T_NEAR);
+        }
+
+        L(found);
+        bsf(reg_mask, reg_mask);
+        add(reg_pos, reg_mask);
+
+        L(done);
+        mov(ptr[reg_param + PARAM_OFF(pos)], reg_pos);
+#undef PARAM_OFF
+
+        postamble();
+    }
+
+    dim_t operator()(
+            const void *src, dim_t len, float threshold) const override {
+        call_params_t p;
+        p.src = src;
+        p.len = len;
+        p.threshold = threshold;
+        p.pos = 0;
+
+        jit_generator::operator()(&p);
+        return p.pos;
+    }
+
+protected:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    const Xbyak::AddressFrame &vmmword = (isa == avx2) ? yword : zword;
+    const int vlen = cpu_isa_traits<isa>::vlen;
+
+    struct call_params_t {
+        const void *src;
+        dim_t len;
+        float threshold;
+        dim_t pos;
+    };
+
+    const data_type_t src_dt_;
+    const int simd_w_;
+    static constexpr int unroll_ = 4;
+
+    std::unique_ptr<io::jit_io_helper_t<Vmm>> io_src_;
+
+    // Compares the vector at @p offt bytes from reg_src with the threshold.
+    // The result is in kmask(u) for avx512_core and in vmm_data(u) for avx2.
+    void compare(int u, int offt) {
+        io_src_->load(vmmword[reg_src + offt], vmm_data(u), false);
+        if (is_superset(isa, avx512_core))
+            vcmpgtps(kmask(u), vmm_data(u), vmm_threshold);
+        else
+            vcmpgtps(vmm_data(u), vmm_data(u), vmm_threshold);
+    }
+
+    // Size in bytes of a vector of elements in memory.
+    int src_vlen() const {
+        return simd_w_ * (int)types::data_type_size(src_dt_);
+    }
+
+    Vmm vmm_data(int u) { return Vmm(4 + u); }
+    Opmask kmask(int u) { return Opmask(2 + u); }
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_src = r8;
+    const Xbyak::Reg64 reg_len = r9;
+    const Xbyak::Reg64 reg_pos = r10;
+    const Xbyak::Reg64 reg_tmp = r11;
+    const Xbyak::Reg64 reg_mask = rax;
+
+    const Vmm vmm_threshold = Vmm(3);
+    const Vmm vmm_any_0 = Vmm(8);
+    const Vmm vmm_any_1 = Vmm(9);
+
+    const Opmask k_any_0 = k6;
+    const Opmask k_any_1 = k7;
+
+    const int bf16_emu_zmm_1_idx = 28;
+    const int bf16_emu_zmm_2_idx = 29;
+    const int bf16_emu_zmm_3_idx = 30;
+    const int bf16_emu_zmm_4_idx = 31;
+};
+
+template struct kernel_t<avx2>;
+template struct kernel_t<avx512_core>;
+
+// Inserts value @p v with index @p i into the @p n first entries of
+// @p values and @p indices sorted by decreasing value. At most @p k entries
+// are kept, so for a full list @p v must be larger than the last value.
+// Equal values precede @p v, the values are inserted in index order.
+void insert(float *values, int32_t *indices, dim_t &n, dim_t k, float v,
+        dim_t i) {
+    dim_t p = nstl::min(n, k - 1);
+    while (p > 0 && values[p - 1] < v) {
+        values[p] = values[p - 1];
+        indices[p] = indices[p - 1];
+        --p;
+    }
+    values[p] = v;
+    indices[p] = (int32_t)i;
+    if (n < k) ++n;
+}
+
+} // namespace
+
+jit_uni_topk_t::kernel_base_t *jit_uni_topk_t::kernel_base_t::create(
+        const pd_t *pd) {
+    switch (pd->isa_) {
+        case avx512_core: return new kernel_t<avx512_core>(pd);
+        case avx2: return new kernel_t<avx2>(pd);
+        default: assert(!"kernel is empty."); return nullptr;
+    }
+}
+
+status_t jit_uni_topk_t::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md(0));
+    const memory_desc_wrapper dst_indices_d(dst_md(1));
+    const data_type_t src_dt = src_d.data_type();
+
+    VDISPATCH_TOPK(mayiuse(avx2), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_TOPK(
+            utils::one_of(src_dt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOPK(IMPLICATION(src_dt == bf16, mayiuse(avx512_core)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOPK(IMPLICATION(src_dt == f16, mayiuse(avx512_core_fp16)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOPK(dst_d.data_type() == src_dt, VERBOSE_INCONSISTENT_DT,
+            "src", "dst");
+    VDISPATCH_TOPK(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_TOPK(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    // The values of a row are contiguous in the source.
+    VDISPATCH_TOPK(src_d.is_plain() && dst_d.is_plain()
+                    && dst_indices_d.is_plain()
+                    && src_d.blocking_desc().strides[axis()] == 1,
+            VERBOSE_UNSUPPORTED_TAG);
+
+    isa_ = mayiuse(avx512_core) ? avx512_core : avx2;
+    nthr_ = dnnl_get_max_threads();
+
+    // Rows are split only if there are not enough of them to occupy the
+    // threads. Each part has at least k values and enough work to amortize
+    // the merge.
+    const dim_t nrows = this->nrows();
+    const dim_t min_part_size = nstl::max(k(), (dim_t)4096);
+    nparts_ = 1;
+    if (nrows > 0 && nrows < nthr_)
+        nparts_ = nstl::max((dim_t)1,
+                nstl::min((dim_t)nthr_ / nrows, axis_size() / min_part_size));
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+void jit_uni_topk_t::pd_t::init_scratchpad() {
+    // A list per thread, or per part of a row when the rows are split.
+    const dim_t nlists = nparts_ == 1 ? nthr_ : nrows() * nparts_;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_topk_values, nlists * k());
+    scratchpad.template book<int32_t>(key_topk_indices, nlists * k());
+}
+
+status_t jit_uni_topk_t::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_, kernel_base_t::create(pd())));
+    return kernel_->create_kernel();
+}
+
+void jit_uni_topk_t::select(const char *src, dim_t len, dim_t base,
+        float *values, int32_t *indices) const {
+    const data_type_t src_dt = pd()->src_md()->data_type;
+    const size_t dt_size = types::data_type_size(src_dt);
+    const dim_t k = pd()->k();
+
+    dim_t n = 0;
+    for (dim_t i = 0; i < k; ++i) {
+        const float v = cpu::io::load_float_value(src_dt, src, i);
+        insert(values, indices, n, k, v, base + i);
+    }
+
+    dim_t i = k;
+    while (i < len) {
+        i += (*kernel_)(src + i * dt_size, len - i, values[k - 1]);
+        if (i == len) break;
+        // Either a candidate or a value past the full vectors.
+        const float v = cpu::io::load_float_value(src_dt, src, i);
+        if (v > values[k - 1]) insert(values, indices, n, k, v, base + i);
+        ++i;
+    }
+}
+
+status_t jit_uni_topk_t::execute(const exec_ctx_t &ctx) const {
+    const auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto dst_indices = CTX_OUT_MEM(int32_t *, DNNL_ARG_DST_INDICES);
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    float *values = scratchpad.template get<float>(key_topk_values);
+    int32_t *indices = scratchpad.template get<int32_t>(key_topk_indices);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md(0));
+    const memory_desc_wrapper dst_indices_d(pd()->dst_md(1));
+
+    const int ndims = src_d.ndims();
+    const int axis = pd()->axis();
+    const dim_t k = pd()->k();
+    const dim_t axis_size = pd()->axis_size();
+    const dim_t nrows = pd()->nrows();
+    const dim_t nparts = pd()->nparts_;
+    const data_type_t dst_dt = dst_d.data_type();
+    const size_t src_dt_size = types::data_type_size(src_d.data_type());
+    const dim_t dst_stride = dst_d.blocking_desc().strides[axis];
+    const dim_t dst_indices_stride
+            = dst_indices_d.blocking_desc().strides[axis];
+
+    dims_t outer_dims;
+    utils::array_copy(outer_dims, src_d.dims(), ndims);
+    outer_dims[axis] = 1;
+
+    // Returns the source, destination and indices offsets of row @p r.
+    const auto row_offsets
+            = [&](dim_t r, dim_t &src_off, dim_t &dst_off, dim_t &idx_off) {
+                  dims_t pos;
+                  utils::l_dims_by_l_offset(pos, r, outer_dims, ndims);
+                  src_off = src_d.off_v(pos);
+                  dst_off = dst_d.off_v(pos);
+                  idx_off = dst_indices_d.off_v(pos);
+              };
+    // Stores the i-th value of a row and its index.
+    const auto store = [&](dim_t dst_off, dim_t idx_off, dim_t i, float v,
+                               int32_t idx) {
+        cpu::io::store_float_value(dst_dt, v, dst, dst_off + i * dst_stride);
+        dst_indices[idx_off + i * dst_indices_stride] = idx;
+    };
+
+    if (nparts == 1) {
+        parallel(pd()->nthr_, [&](int ithr, int nthr) {
+            dim_t start {0}, end {0};
+            balance211(nrows, nthr, ithr, start, end);
+            float *v = values + ithr * k;
+            int32_t *idx = indices + ithr * k;
+            for (dim_t r = start; r < end; ++r) {
+                dim_t src_off, dst_off, idx_off;
+                row_offsets(r, src_off, dst_off, idx_off);
+                select(src + src_off * src_dt_size, axis_size, 0, v, idx);
+                for (dim_t i = 0; i < k; ++i)
+                    store(dst_off, idx_off, i, v[i], idx[i]);
+            }
+        });
+        return status::success;
+    }
+
+    parallel_nd(nrows, nparts, [&](dim_t r, dim_t p) {
+        dim_t start {0}, end {0};
+        balance211(axis_size, nparts, p, start, end);
+        dim_t src_off, dst_off, idx_off;
+        row_offsets(r, src_off, dst_off, idx_off);
+        const dim_t list = r * nparts + p;
+        select(src + (src_off + start) * src_dt_size, end - start, start,
+                values + list * k, indices + list * k);
+    });
+
+    // Merges the sorted lists of the parts. The parts are in index order, so
+    // on equal values the earlier part goes first.
+    parallel_nd(nrows, [&](dim_t r) {
+        dim_t src_off, dst_off, idx_off;
+        row_offsets(r, src_off, dst_off, idx_off);
+        const float *v = values + r * nparts * k;
+        const int32_t *idx = indices + r * nparts * k;
+        std::vector<dim_t> heads(nparts, 0);
+        for (dim_t i = 0; i < k; ++i) {
+            dim_t best = -1;
+            for (dim_t p = 0; p < nparts; ++p) {
+                if (heads[p] == k) continue;
+                if (best < 0
+                        || v[p * k + heads[p]] > v[best * k + heads[best]])
+                    best = p;
+            }
+            const dim_t from = best * k + heads[best]++;
+            store(dst_off, idx_off, i, v[from], idx[from]);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
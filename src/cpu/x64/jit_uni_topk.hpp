@@ -0,0 +1,94 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_TOPK_HPP
+#define CPU_X64_JIT_UNI_TOPK_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Top-k along an axis that is dense in the source. The k first values of a
+// row are sorted, then the kernel scans the rest of the row for the values
+// larger than the current k-th one, which are inserted into the sorted list.
+// Past the first values, such candidates become rare, so the time is mostly
+// spent in the vectorized scan.
+//
+// When there are fewer rows than threads, the rows are split into parts
+// selected independently, and the results of the parts are merged.
+struct jit_uni_topk_t : public primitive_t {
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit:", isa_, ""), jit_uni_topk_t);
+
+        status_t init(engine_t *engine);
+
+        cpu_isa_t isa_ = isa_undef;
+        int nthr_ = 0;
+        // The number of parts each row is split into.
+        dim_t nparts_ = 1;
+
+    private:
+        void init_scratchpad();
+    };
+
+    struct kernel_base_t {
+        // Returns the offset of the first value larger than @p threshold in
+        // the @p len values at @p src. If there is no such value among the
+        // full vectors, returns the offset of the first value not checked.
+        virtual dim_t operator()(
+                const void *src, dim_t len, float threshold) const = 0;
+        static kernel_base_t *create(const pd_t *pd);
+        virtual status_t create_kernel() = 0;
+        virtual ~kernel_base_t() = default;
+    };
+
+    jit_uni_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Writes the k largest of the @p len values at @p src sorted by
+    // decreasing value to @p values, and their offsets increased by @p base
+    // to @p indices. @p len must not be less than k.
+    void select(const char *src, dim_t len, dim_t base, float *values,
+            int32_t *indices) const;
+
+    std::unique_ptr<kernel_base_t> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -23,6 +23,7 @@
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/scale_utils.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -44,6 +45,21 @@ using namespace nstl;
 
 using namespace data_type;
 
+namespace {
+template <typename wei_t>
+inline float load_wei_value(const char *base, dim_t idx) {
+    return static_cast<float>(reinterpret_cast<const wei_t *>(base)[idx]);
+}
+template <>
+inline float load_wei_value<int4_t>(const char *base, dim_t idx) {
+    return static_cast<float>(int4_t::extract(base, idx));
+}
+template <>
+inline float load_wei_value<uint4_t>(const char *base, dim_t idx) {
+    return static_cast<float>(uint4_t::extract(base, idx));
+}
+} // namespace
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     const auto src_dt = src_md_.data_type;
@@ -57,6 +73,8 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
             = everyone_is(bf16, src_dt, wei_dt) && one_of(dst_dt, bf16, f32);
     const bool is_f16
             = everyone_is(f16, src_dt, wei_dt) && one_of(dst_dt, f16, f32);
+    const bool is_f32_wei_decomp = isa == avx512_core && src_dt == f32
+            && one_of(wei_dt, s8, u8, s4, u4) && dst_dt == f32;
 
     auto check_bias = [&]() -> bool {
         const auto bia_dt = weights_md(1)->data_type;
@@ -82,9 +100,24 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         return ok;
     };
 
-    auto check_attr_zero_points
-            = [&]() -> bool { return attr()->zero_points_.common(); };
-    const bool problem_dt_correct = is_int8 || is_bf16 || is_f32 || is_f16;
+    auto check_attr_zero_points = [&]() -> bool {
+        if (is_f32_wei_decomp)
+            return attr()->zero_points_.has_default_values(DNNL_ARG_SRC)
+                    && attr()->zero_points_.has_default_values(DNNL_ARG_DST);
+        return attr()->zero_points_.common();
+    };
+    const bool problem_dt_correct
+            = is_int8 || is_bf16 || is_f32 || is_f16 || is_f32_wei_decomp;
+
+    auto skip_mask = primitive_attr_t::skip_mask_t::scales_runtime
+            | primitive_attr_t::skip_mask_t::zero_points_runtime
+            | primitive_attr_t::skip_mask_t::post_ops
+            | primitive_attr_t::skip_mask_t::sum_dt;
+    if (is_f32_wei_decomp)
+        skip_mask |= primitive_attr_t::skip_mask_t::scales_runtime_groups
+                | primitive_attr_t::skip_mask_t::scales_runtime_data_type
+                | primitive_attr_t::skip_mask_t::zero_points_runtime_groups
+                | primitive_attr_t::skip_mask_t::zero_points_runtime_data_type;
 
     auto src_d = memory_desc_wrapper(src_md_);
     auto weights_d = memory_desc_wrapper(weights_md_);
@@ -98,13 +131,10 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_MATMUL(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
     VDISPATCH_MATMUL(problem_dt_correct, VERBOSE_UNSUPPORTED_DT_CFG);
     VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(attr()->has_default_values(skip_mask, dst_dt),
+            VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_MATMUL(
-            attr()->has_default_values(
-                    primitive_attr_t::skip_mask_t::scales_runtime
-                            | primitive_attr_t::skip_mask_t::zero_points_runtime
-                            | primitive_attr_t::skip_mask_t::post_ops
-                            | primitive_attr_t::skip_mask_t::sum_dt,
-                    dst_dt),
+            IMPLICATION(is_f32_wei_decomp, attr_wei_decompression_ok()),
             VERBOSE_UNSUPPORTED_ATTR);
     VDISPATCH_MATMUL(attr()->post_ops_.check_sum_consistency(dst_dt, is_int8),
             VERBOSE_UNSUPPORTED_POSTOP);
@@ -115,6 +145,21 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
             dst_md_, bias_md_, attr_));
 
+    if (bgmmc_.with_wei_decomp_scales) {
+        const auto &scales = attr()->scales_.get(DNNL_ARG_WEIGHTS);
+        wei_qparam_groups(scales.mask_, scales.ndims_, scales.group_dims_,
+                bgmmc_.wei_decomp_scales_group_k,
+                bgmmc_.wei_decomp_scales_group_n);
+    }
+    if (bgmmc_.with_wei_decomp_zero_points) {
+        const auto &zp = attr()->zero_points_;
+        wei_qparam_groups(zp.get(DNNL_ARG_WEIGHTS),
+                zp.get_groups_ndims(DNNL_ARG_WEIGHTS),
+                zp.get_groups(DNNL_ARG_WEIGHTS),
+                bgmmc_.wei_decomp_zero_points_group_k,
+                bgmmc_.wei_decomp_zero_points_group_n);
+    }
+
     const float alpha = 1.0;
     const float beta = 1.0;
     const float beta_init = 0.0;
@@ -215,7 +260,8 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
             brgemm_palettes_.insert(idx, pd()->get_brg_desc(idx));
     }
 
-    if (bgmmc.use_buffer_b && !bgmmc.packed_sparse_weights)
+    if (bgmmc.use_buffer_b && !bgmmc.packed_sparse_weights
+            && !bgmmc.with_wei_decompression)
         CHECK(create_brgemm_matmul_copy_b(copy_B_kernel_, &bgmmc));
 
     if (bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only)
@@ -242,11 +288,19 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
 
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+    // Weights scales and zero points are applied during weights
+    // decompression and are not validated as common or per-N values.
+    const primitive_attr_t *wei_qparams_attr
+            = bgmmc.with_wei_decompression ? &default_attr() : pd()->attr();
+
     DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
-    DEFINE_ZERO_POINT_VALUE(wei_zero_point, DNNL_ARG_WEIGHTS);
+    DEFINE_ZERO_POINT_VALUE_ATTR(
+            wei_qparams_attr, wei_zero_point, DNNL_ARG_WEIGHTS);
     DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
-    DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
+    DEFINE_ARG_SCALES_BUFFER_ATTR(
+            wei_qparams_attr, wei_scales, DNNL_ARG_WEIGHTS);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
 
     const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
@@ -255,13 +309,15 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
     auto &scratchpad = ctx.get_scratchpad_grantor();
-    const float *oscales = precompute_scales(
-            scratchpad, src_scales, wei_scales, pd()->N(), pd()->attr());
+    const float *oscales = bgmmc.with_wei_decompression
+            ? src_scales
+            : precompute_scales(scratchpad, src_scales, wei_scales,
+                    pd()->N(), pd()->attr());
 
     brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(), oscales, src_zero_point,
             wei_zero_point, dst_zero_point, dst_scales, helper);
+    if (!brgmm_ctx.wei_decomp_args_ok()) return status::invalid_arguments;
 
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
     const bool use_buffer_a
             = bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only;
     const bool is_amx = is_superset(isa, avx512_core_amx);
@@ -331,7 +387,7 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
             ++start;
             nd_iterator_step(b, bgmmc.batch, mc, M_chunks, nc, N_chunks);
         }
-        if (is_amx) { amx_tile_release(); }
+        if (is_amx) { amx_tile_maybe_release(); }
     });
 
     maybe_reduce_partial_results_and_apply_postops(brgmm_ctx);
@@ -704,6 +760,19 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         return;
     }
 
+    if (bgmmc.with_wei_decompression) {
+        const int n_iters = brgmm_ctx.get_N_kernel_size(n_blk_idx);
+        for (int gb = 0; gb < gemm_batch + is_K_tail; gb++) {
+            const int k = k_start + gb * bgmmc.K_blk;
+            const int k_iters = gb < gemm_batch
+                    ? nstl::min(bgmmc.K_blk, bgmmc.K)
+                    : bgmmc.K % bgmmc.K_blk;
+            brgmm_ctx.decompress_B_block(b_idx, k, k_iters, n, n_iters,
+                    (float *)brgmm_ctx.get_buf_B_ptr(ithr, gb, n_blk_idx));
+        }
+        return;
+    }
+
     auto ctx = jit_brgemm_matmul_copy_b_t::ctx_t();
     ctx.current_N_blk = brgmm_ctx.get_N_kernel_size(n_blk_idx);
 
@@ -778,6 +847,11 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             B_packed_sparse_block_size_ = weights_d.blk_size();
         }
 
+        wei_decomp_scales_ptr_ = CTX_IN_MEM(
+                const void *, DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS);
+        wei_decomp_zero_points_ptr_ = CTX_IN_MEM(
+                const void *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
+
         bias_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
         oscales_ptr_ = oscales;
         dst_scales_ptr_ = dst_scales;
@@ -1079,6 +1153,88 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return data_B_ptr_ + get_data_B_off(cur_b, k, n);
     }
 
+    // Converts a `k_iters` x `n_iters` block of weights starting at (k, n)
+    // to f32 applying zero points and scales. The result is stored with the
+    // LDB row stride expected by the f32 BRGeMM kernels, the columns beyond
+    // `n_iters` are zero-padded.
+    void decompress_B_block(
+            int b, int k, int k_iters, int n, int n_iters, float *tr_b) const {
+        using namespace data_type;
+        switch (bgmmc_.orig_wei_dt) {
+            case s8:
+                decompress_B_block<int8_t>(b, k, k_iters, n, n_iters, tr_b);
+                break;
+            case u8:
+                decompress_B_block<uint8_t>(b, k, k_iters, n, n_iters, tr_b);
+                break;
+            case s4:
+                decompress_B_block<int4_t>(b, k, k_iters, n, n_iters, tr_b);
+                break;
+            case u4:
+                decompress_B_block<uint4_t>(b, k, k_iters, n, n_iters, tr_b);
+                break;
+            default: assert(!"unsupported weights data type");
+        }
+    }
+
+    template <typename wei_t>
+    void decompress_B_block(
+            int b, int k, int k_iters, int n, int n_iters, float *tr_b) const {
+        // LDB is checked against the bound at primitive descriptor creation.
+        assert(n_iters <= bgmmc_.LDB && bgmmc_.LDB <= wei_decomp_max_LDB);
+        float scales[wei_decomp_max_LDB], zero_points[wei_decomp_max_LDB];
+        const bool with_scales = bgmmc_.with_wei_decomp_scales;
+        const bool with_zero_points = bgmmc_.with_wei_decomp_zero_points;
+        const dim_t N = bgmmc_.N;
+        const dim_t sc_group_k = bgmmc_.wei_decomp_scales_group_k;
+        const dim_t sc_group_n = bgmmc_.wei_decomp_scales_group_n;
+        const dim_t zp_group_k = bgmmc_.wei_decomp_zero_points_group_k;
+        const dim_t zp_group_n = bgmmc_.wei_decomp_zero_points_group_n;
+
+        const int cur_b = get_bb_idx(b, bgmmc_.bcast_B_desc);
+        for (int kk = 0; kk < k_iters; kk++) {
+            const int k_idx = k + kk;
+            // Quantization parameters are stored as a dense
+            // [K / group_k, N / group_n] array, reload them only when a new
+            // group along K starts.
+            if (with_scales && (kk == 0 || k_idx % sc_group_k == 0)) {
+                const dim_t off = (k_idx / sc_group_k) * (N / sc_group_n);
+                for (int j = 0; j < n_iters; j++)
+                    scales[j] = io::load_float_value(
+                            bgmmc_.wei_decomp_scales_dt,
+                            wei_decomp_scales_ptr_, off + (n + j) / sc_group_n);
+            }
+            if (with_zero_points && (kk == 0 || k_idx % zp_group_k == 0)) {
+                const dim_t off = (k_idx / zp_group_k) * (N / zp_group_n);
+                for (int j = 0; j < n_iters; j++)
+                    zero_points[j] = (float)io::load_int_value(
+                            bgmmc_.wei_decomp_zero_points_dt,
+                            wei_decomp_zero_points_ptr_,
+                            off + (n + j) / zp_group_n);
+            }
+
+            // The offset is in elements since b_dt_sz is set to 1.
+            const dim_t row_off = get_data_B_off(cur_b, k_idx, n);
+            float *tr_b_row = tr_b + kk * bgmmc_.LDB;
+            PRAGMA_OMP_SIMD()
+            for (int j = 0; j < n_iters; j++) {
+                float w = load_wei_value<wei_t>(data_B_ptr_, row_off + j);
+                if (with_zero_points) w -= zero_points[j];
+                if (with_scales) w *= scales[j];
+                tr_b_row[j] = w;
+            }
+            for (int j = n_iters; j < bgmmc_.LDB; j++)
+                tr_b_row[j] = 0.f;
+        }
+    }
+
+    bool wei_decomp_args_ok() const {
+        return IMPLICATION(
+                       bgmmc_.with_wei_decomp_scales, wei_decomp_scales_ptr_)
+                && IMPLICATION(bgmmc_.with_wei_decomp_zero_points,
+                        wei_decomp_zero_points_ptr_);
+    }
+
     const char *get_data_B_bitmask_ptr(int b, int k, int n) const {
         assert(bgmmc_.packed_sparse_weights);
         const auto bitmask_off = get_data_B_off(b, k, n) / CHAR_BIT;
@@ -1604,6 +1760,8 @@ private:
     // are sparse and packed.
     const dim_t *data_B_offsets_ptr_;
     const char *data_B_bitmask_ptr_;
+    const void *wei_decomp_scales_ptr_;
+    const void *wei_decomp_zero_points_ptr_;
     // The size of a packed saprse block. E.g. the block
     // for a tag 'BA16a64b4a' is 4096.
     int B_packed_sparse_block_size_;
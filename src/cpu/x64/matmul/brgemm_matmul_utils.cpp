@@ -980,6 +980,13 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.src_dt = src_d.data_type();
     bgmmc.dst_dt = dst_d.data_type();
     bgmmc.wei_dt = weights_d.data_type();
+    bgmmc.orig_wei_dt = bgmmc.wei_dt;
+
+    // Weights decompression: integer weights are converted to f32 while being
+    // copied to the B buffer, so BRGeMM computes the problem as f32 one.
+    bgmmc.with_wei_decompression = bgmmc.src_dt == f32
+            && one_of(bgmmc.wei_dt, s8, u8, s4, u4) && bgmmc.dst_dt == f32;
+    if (bgmmc.with_wei_decompression) bgmmc.wei_dt = f32;
 
     bgmmc.with_bias = mmd.bias_desc.format_kind != format_kind::undef;
     bgmmc.bia_dt = bgmmc.with_bias ? mmd.bias_desc.data_type : data_type::undef;
@@ -999,6 +1006,14 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.is_amx = is_superset(isa, avx512_core_amx);
     bgmmc.a_dt_sz = bgmmc.tr_a_dt_sz = types::data_type_size(bgmmc.src_dt);
     bgmmc.b_dt_sz = bgmmc.tr_b_dt_sz = types::data_type_size(bgmmc.wei_dt);
+    if (bgmmc.with_wei_decompression) {
+        // Offsets in the original weights are computed in elements since
+        // 4-bit data types can't be addressed in bytes.
+        bgmmc.b_dt_sz = 1;
+        // Decompression works with the user layout of weights only.
+        VCONDCHECK_BG(!is_wei_any && isa == avx512_core,
+                VERBOSE_UNSUPPORTED_TAG);
+    }
 
     bgmmc.packed_sparse_weights = weights_d.is_sparse_packed_desc();
     if (bgmmc.packed_sparse_weights) {
@@ -1030,9 +1045,11 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
 
     const auto &src_scales = attr.scales_.get(DNNL_ARG_SRC);
     const auto &wei_scales = attr.scales_.get(DNNL_ARG_WEIGHTS);
-    bgmmc.with_scales = !src_scales.has_default_values()
-            || !wei_scales.has_default_values();
-    if (bgmmc.with_scales) {
+    // Weights scales are applied during decompression.
+    const bool with_wei_oscales = !wei_scales.has_default_values()
+            && !bgmmc.with_wei_decompression;
+    bgmmc.with_scales = !src_scales.has_default_values() || with_wei_oscales;
+    if (with_wei_oscales) {
         bgmmc.is_oscale_per_n = wei_scales.mask_ == 1 << (bgmmc.ndims - 1);
 
         // only common and per-oc-channel scales are supported
@@ -1040,6 +1057,15 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
                 VERBOSE_UNSUPPORTED_SCALES_CFG);
     }
 
+    if (bgmmc.with_wei_decompression) {
+        bgmmc.with_wei_decomp_scales = !wei_scales.has_default_values();
+        bgmmc.wei_decomp_scales_dt = wei_scales.data_type_;
+        bgmmc.with_wei_decomp_zero_points
+                = !attr.zero_points_.has_default_values(DNNL_ARG_WEIGHTS);
+        bgmmc.wei_decomp_zero_points_dt
+                = attr.zero_points_.get_data_type(DNNL_ARG_WEIGHTS);
+    }
+
     const auto &dst_scales = attr.scales_.get(DNNL_ARG_DST);
     bgmmc.with_dst_scales = !dst_scales.has_default_values();
     // only common scales are supported
@@ -1055,7 +1081,10 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.with_binary = !everyone_is(-1, binary_ind, prelu_ind);
 
     bgmmc.src_zp_type = get_zp_type(attr, DNNL_ARG_SRC);
-    bgmmc.wei_zp_type = get_zp_type(attr, DNNL_ARG_WEIGHTS);
+    // Weights zero points are applied during decompression.
+    bgmmc.wei_zp_type = bgmmc.with_wei_decompression
+            ? brgemm_broadcast_t::none
+            : get_zp_type(attr, DNNL_ARG_WEIGHTS);
     bgmmc.dst_zp_type = get_zp_type(attr, DNNL_ARG_DST);
 
     VCONDCHECK_BG(
@@ -1114,6 +1143,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
             VERBOSE_UNSUPPORTED_TAG);
     VCHECK_BG(bm_conf_utils.set_or_check_B_tag(weights_md),
             VERBOSE_UNSUPPORTED_TAG);
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_wei_decompression,
+                          bm_conf_utils.check_is_plain(bgmmc.wei_tag)),
+            VERBOSE_UNSUPPORTED_TAG);
 
     bgmmc.req_wei_vnni_downconvert = bm_conf_utils.wei_down_convert_to_vnni();
 
@@ -1284,6 +1316,9 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
             : 0;
 
     bgmmc.LDB = bm_conf_utils.get_actual_LDB();
+    VCONDCHECK_BG(IMPLICATION(bgmmc.with_wei_decompression,
+                          bgmmc.LDB <= wei_decomp_max_LDB),
+            VERBOSE_BLOCKING_FAIL);
     bgmmc.LDD = bgmmc.dst_tag == acbd && !bgmmc.is_runtime_N
             ? dst_d.blocking_desc().strides[2]
             : bgmmc.N;
@@ -30,6 +30,9 @@ namespace x64 {
 namespace matmul {
 
 constexpr int max_batch_ndims = DNNL_MAX_NDIMS - 2;
+// Upper bound on LDB with weights decompression: the decompression keeps
+// scales and zero points of a block row on the stack.
+constexpr int wei_decomp_max_LDB = 64;
 
 struct brgemm_matmul_bcast_desc_t {
 
@@ -186,6 +189,20 @@ struct brgemm_matmul_conf_t {
     bool is_runtime_M = false;
     bool is_runtime_N = false;
     bool is_runtime_K = false;
+
+    // Weights decompression: integer weights are converted to f32 while
+    // being copied to the B buffer, `wei_dt` is set to f32 in this case.
+    bool with_wei_decompression = false;
+    data_type_t orig_wei_dt;
+    bool with_wei_decomp_scales = false;
+    bool with_wei_decomp_zero_points = false;
+    data_type_t wei_decomp_scales_dt;
+    data_type_t wei_decomp_zero_points_dt;
+    // Number of consecutive elements along K and N sharing a scale (zero
+    // point).
+    dim_t wei_decomp_scales_group_k, wei_decomp_scales_group_n;
+    dim_t wei_decomp_zero_points_group_k, wei_decomp_zero_points_group_n;
+
     inline bool lda_big_pow2() const {
         const dim_t big_K_threshold = 4096;
         return !transposed_A && math::is_pow2(K) && K >= big_K_threshold;
@@ -211,7 +228,7 @@ struct brgemm_matmul_conf_utils_t {
     }
 
     inline bool use_buffer_b(bool use_heuristic = true) const {
-        if (bgmmc.is_runtime_N) return true;
+        if (bgmmc.is_runtime_N || bgmmc.with_wei_decompression) return true;
 
         if (bgmmc.is_amx)
             // use b_buffer for AMX when:
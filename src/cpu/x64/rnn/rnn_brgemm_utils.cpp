@@ -325,12 +325,16 @@ void rnn_brgemm_base_t::init_scratchpad(const cpu::rnn_utils::rnn_conf_t &rnn,
                 rnn.n_iter * rnn.mb * sizeof(bfloat16_t), 64);
     }
 
-    const int max_K_Block
-            = nstl::max(rnn.KB1_blocks + 1,
-                      nstl::max(rnn.KBproj_blocks + 1, rnn.KB2_blocks + 1))
-            * (rnn.brgemm_fwd_iter_layer_fuse_possible ? 2 : 1);
     scratchpad.template book<x64::brgemm_batch_element_t>(
-            key_brgemm_primitive_batch, max_K_Block * rnn.nthr);
+            key_brgemm_primitive_batch,
+            addr_batch_size_per_thr(rnn) * rnn.nthr);
+}
+
+dim_t rnn_brgemm_base_t::addr_batch_size_per_thr(
+        const cpu::rnn_utils::rnn_conf_t &rnn) {
+    return nstl::max(rnn.KB1_blocks + 1,
+                   nstl::max(rnn.KBproj_blocks + 1, rnn.KB2_blocks + 1))
+            * (rnn.brgemm_fwd_iter_layer_fuse_possible ? 2 : 1);
 }
 
 status_t rnn_brgemm_t<prop_kind::forward>::configure_brgemm(
@@ -539,6 +543,21 @@ status_t rnn_brgemm_t<prop_kind::forward>::configure_brgemm(
                 ? brgemm_rnn_execute_loop_order_t::mblk_nblk
                 : brgemm_rnn_execute_loop_order_t::nblk_mblk;
     }
+
+    // The cells of an anti-diagonal of the layer x iteration grid only
+    // depend on the cells of the previous one. When a cell has fewer blocks
+    // than there are threads (small batch), run the cells of an
+    // anti-diagonal concurrently, one thread per cell, instead of leaving
+    // most of the threads idle. A lane runs its cell on a single thread,
+    // hence this only pays off when a diagonal has more cells than a cell
+    // has blocks; otherwise every cell keeps the whole team.
+    const dim_t cell_work = rnn.M_blocks * rnn.N_blocks;
+    const dim_t max_diagonal_cells = nstl::min(rnn.n_layer, rnn.n_iter);
+    if (!rnn.merge_gemm_layer && max_diagonal_cells > 1
+            && cell_work < rnn.nthr && cell_work < max_diagonal_cells)
+        rnn.n_wavefront_lanes
+                = static_cast<int>(nstl::min(max_diagonal_cells, rnn.nthr));
+
     return status::success;
 }
 
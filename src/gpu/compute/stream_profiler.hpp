@@ -97,7 +97,7 @@ protected:
                     if (callback_) callback_(kv.first, e.get_nsec());
                     break;
                 }
-                default: assert(!"unexpected data kind");
+                default: return status::unimplemented;
             }
             idx++;
         }
@@ -486,7 +486,8 @@ struct gen_gemm_t : public gpu_gemm_t {
         const auto *info = nocopy_info();
 
         if (get_verbose(verbose_t::debuginfo) >= 2) {
-            printf("onednn_verbose,info,gpu,%s\n", kd->entry().str().c_str());
+            verbose_printf("onednn_verbose,info,gpu,%s\n",
+                    kd->entry().str().c_str());
         }
 
         if (info->fusedBeta() || info->fusedPostOps()) {
@@ -117,6 +117,10 @@ status_t gen9_concat_t::pd_t::init_conf(engine_t *engine) {
     conf.dst_type = dst_mdw.data_type();
     conf.dst_offset0 = dst_mdw.offset0();
     conf.src_type = memory_desc_wrapper(pd->src_md(0)).data_type();
+    // The kernel is built for a single source data type.
+    for (int i = 1; i < pd->n_inputs(); ++i)
+        if (pd->src_md(i)->data_type != conf.src_type)
+            return status::unimplemented;
     conf.ndims = dst_mdw.ndims();
     const auto *compute_engine
             = utils::downcast<compute::compute_engine_t *>(engine);
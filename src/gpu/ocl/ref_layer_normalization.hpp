@@ -49,7 +49,7 @@ struct ref_layer_normalization_fwd_t : public gpu_primitive_t {
             auto src_data_t = src_md()->data_type;
             auto dst_data_t = dst_md()->data_type;
 
-            bool ok = is_fwd()
+            bool ok = is_fwd() && !skip_mean()
                     && (utils::everyone_is(f16, src_data_t, dst_data_t)
                             || utils::everyone_is(bf16, src_data_t, dst_data_t)
                             || utils::everyone_is(f32, src_data_t, dst_data_t)
@@ -116,7 +116,7 @@ struct ref_layer_normalization_bwd_t : public gpu_primitive_t {
             auto diff_dst_dt = diff_dst_md()->data_type;
             auto diff_src_dt = diff_src_md()->data_type;
 
-            bool ok = !is_fwd()
+            bool ok = !is_fwd() && !skip_mean()
                     && (utils::everyone_is(
                                 f32, src_dt, diff_dst_dt, diff_src_dt)
                             || utils::everyone_is(
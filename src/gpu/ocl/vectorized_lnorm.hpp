@@ -47,7 +47,7 @@ struct vectorized_lnorm_fwd_t : public gpu_primitive_t {
             auto src_data_t = src_md()->data_type;
             auto dst_data_t = dst_md()->data_type;
 
-            bool ok = is_fwd() && !has_zero_dim_memory()
+            bool ok = is_fwd() && !skip_mean() && !has_zero_dim_memory()
                     && (utils::everyone_is(f16, src_data_t, dst_data_t)
                             || utils::everyone_is(bf16, src_data_t, dst_data_t)
                             || utils::everyone_is(f32, src_data_t, dst_data_t))
@@ -111,7 +111,7 @@ struct vectorized_lnorm_bwd_t : public gpu_primitive_t {
             auto diff_dst_dt = diff_dst_md()->data_type;
             auto diff_src_dt = diff_src_md()->data_type;
 
-            bool ok = !is_fwd() && !has_zero_dim_memory()
+            bool ok = !is_fwd() && !skip_mean() && !has_zero_dim_memory()
                     && (utils::everyone_is(
                                 f32, src_dt, diff_dst_dt, diff_src_dt)
                             || utils::everyone_is(
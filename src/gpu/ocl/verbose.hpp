@@ -43,8 +43,8 @@ void print_verbose_header() {
         auto s_name = dev_info->name();
         auto s_ver = dev_info->runtime_version().str();
 
-        printf("onednn_verbose,info,gpu,engine,%d,name:%s,"
-               "driver_version:%s,binary_kernels:%s\n",
+        verbose_printf("onednn_verbose,info,gpu,engine,%d,name:%s,"
+                       "driver_version:%s,binary_kernels:%s\n",
                 (int)i, s_name.c_str(), s_ver.c_str(),
                 dev_info->mayiuse_ngen_kernels() ? "enabled" : "disabled");
         eng_ptr->release();
@@ -36,6 +36,13 @@ bool kernel_base_t::enabled_constant_cache() const {
     return enabled;
 }
 
+void kernel_base_t::init_constant_cache_key(
+        size_t part_id, const memory_planner_t &memory_planner) {
+    constant_key_ = generate_constant_cache_key(part_id,
+            memory_planner.get_exec_args_set().get_persistent_mem_desc_list());
+    constant_size_ = memory_planner.total_internal_persistent_size();
+}
+
 dnnl_backend::dnnl_backend(const std::string &name, float priority)
     : backend_t(name, priority) {
     register_op_schemas();
@@ -106,6 +113,21 @@ kernel_ptr large_partition_kernel_creator() {
 kernel_ptr dummy_kernel_creator() {
     return std::make_shared<dummy_kernel_t>();
 }
+
+kernel_ptr dynamic_shape_kernel_creator(FCreateKernel kernel_creator) {
+    // Note: These environment variables are internal and for test/debug
+    // purpose. They can be changed or removed without prior notice. The
+    // constant capacity is in MBytes.
+    static const size_t capacity = static_cast<size_t>(std::max(1,
+            graph::utils::getenv_int_internal(
+                    "GRAPH_DYNAMIC_SHAPE_CAPACITY", 64)));
+    static const size_t constant_capacity_mb
+            = static_cast<size_t>(std::max(0,
+                    graph::utils::getenv_int_internal(
+                            "GRAPH_DYNAMIC_SHAPE_CONSTANT_CAPACITY", 1024)));
+    return std::make_shared<dynamic_shape_kernel_t>(std::move(kernel_creator),
+            capacity, constant_capacity_mb * 1024 * 1024);
+}
 } // namespace dnnl_impl
 
 // This function should be called by backend_registry_t
@@ -44,6 +44,7 @@ namespace graph {
 namespace dnnl_impl {
 
 class dnnl_partition_impl_t;
+class memory_planner_t;
 
 // gcc4.8.5 can 't support enum class as key
 struct enum_hash_t {
@@ -101,8 +102,23 @@ struct kernel_base_t {
 
     virtual status_t prepare_inplace_pairs_impl() { return status::success; };
 
+    // Returns the key of the constant cache entry holding the constant
+    // tensors of the kernel, 0 if the kernel has none.
+    virtual size_t get_constant_cache_key() const { return constant_key_; }
+
+    // Returns the size in bytes of the constant tensors of the kernel.
+    virtual size_t get_constant_size() const { return constant_size_; }
+
+    // Generates the constant cache key of the persistent memory planned for
+    // the partition and records its size.
+    void init_constant_cache_key(
+            size_t part_id, const memory_planner_t &memory_planner);
+
     bool enabled_constant_cache() const;
 
+    constant_cache_t::key_t constant_key_ = 0;
+    size_t constant_size_ = 0;
+
     std::vector<inplace_pair_t> inplace_pairs_;
     dnnl::engine p_engine_;
 };
@@ -112,6 +128,9 @@ using FCreateKernel = std::function<kernel_ptr(void)>;
 
 kernel_ptr large_partition_kernel_creator();
 kernel_ptr dummy_kernel_creator();
+// Wraps the kernels created by @p kernel_creator for a partition compiled with
+// unknown dimensions.
+kernel_ptr dynamic_shape_kernel_creator(FCreateKernel kernel_creator);
 
 class dnnl_backend : public backend_t {
     friend class dnnl_partition_impl_t;
@@ -16,6 +16,8 @@
 #ifndef GRAPH_BACKEND_DNNL_DNNL_CONSTANT_TENSOR_CACHE_HPP
 #define GRAPH_BACKEND_DNNL_DNNL_CONSTANT_TENSOR_CACHE_HPP
 
+#include "common/trace.hpp"
+
 #include "graph/interface/constant_tensor_cache.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
@@ -54,6 +56,14 @@ struct dnnl_constant_buffer_t : public graph::constant_buffer_t {
     }
 };
 
+// Records the fill of a constant cache entry missing in the cache in the
+// execution timeline, from the construction to the destruction of the object.
+struct constant_cache_fill_trace_t : public impl::trace::scope_t {
+    constant_cache_fill_trace_t()
+        : impl::trace::scope_t(
+                impl::trace::category_t::const_cache, "const_cache") {}
+};
+
 inline graph::constant_tensor_cache_t::value_t dnnl_constant_cache_get_or_add(
         const dnnl::engine &eng, graph::constant_tensor_cache_t::key_t key,
         size_t size, const graph::constant_tensor_cache_t::value_t &value) {
@@ -1004,6 +1004,7 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_layernorm, 1,
                 .set_attr(op_attr::fusion_info_key, false, attribute_kind::i,
                         (int64_t)-1)
                 // New added attributes
+                .set_attr(op_attr::is_rms_norm, false, attribute_kind::b, false)
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
                 // Analysis rules
                 .set_shape_inference_function(infer_norm_output_shape)
@@ -17,6 +17,7 @@
 #ifndef GRAPH_BACKEND_DNNL_DNNL_PARTITION_IMPL_HPP
 #define GRAPH_BACKEND_DNNL_DNNL_PARTITION_IMPL_HPP
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -75,6 +76,8 @@ public:
         return kernel_->execute(g_stream, inputs, outputs);
     }
 
+    const kernel_ptr &get_kernel() const { return kernel_; }
+
 #ifdef DNNL_WITH_SYCL
     status_t execute_sycl(const stream_t *g_stream,
             const std::vector<tensor_t> &inputs,
@@ -164,6 +167,7 @@ public:
         ret->kernel_creator_ = kernel_creator_;
         ret->id_ = id_;
         ret->can_use_blocked_layout_ = can_use_blocked_layout_;
+        ret->inter_op_parallelism_ = inter_op_parallelism_;
         return ret;
     }
 
@@ -191,20 +195,33 @@ public:
             kernel_creator = large_partition_kernel_creator;
         }
 
+        // Partitions with unknown input dimensions are compiled at execution
+        // for the shapes of the given tensors.
+        const bool is_dynamic = std::any_of(inputs.begin(), inputs.end(),
+                [](const logical_tensor_t &lt) {
+                    return logical_tensor_wrapper_t(lt).is_shape_unknown();
+                });
+
         // Dispatch to fake kernel if one of the output dimensions is zero.
-        const std::vector<std::shared_ptr<op_t>> &fused_op = part->get_ops();
-        auto agraph = graph_t(fused_op, get_engine_kind(), get_fpmath_mode());
-        agraph.set_user_inputs_outputs(inputs, outputs);
-        agraph.infer_shape();
-        for (const auto &val : agraph.get_output_values()) {
-            if (logical_tensor_wrapper_t(val->get_logical_tensor())
-                            .has_zero_dim()) {
-                kernel_creator = dummy_kernel_creator;
-                break;
+        if (!is_dynamic) {
+            const std::vector<std::shared_ptr<op_t>> &fused_op
+                    = part->get_ops();
+            auto agraph
+                    = graph_t(fused_op, get_engine_kind(), get_fpmath_mode());
+            agraph.set_user_inputs_outputs(inputs, outputs);
+            agraph.infer_shape();
+            for (const auto &val : agraph.get_output_values()) {
+                if (logical_tensor_wrapper_t(val->get_logical_tensor())
+                                .has_zero_dim()) {
+                    kernel_creator = dummy_kernel_creator;
+                    break;
+                }
             }
         }
 
-        kernel_ptr kernel = kernel_creator();
+        kernel_ptr kernel = is_dynamic
+                ? dynamic_shape_kernel_creator(kernel_creator)
+                : kernel_creator();
         if (!kernel) return status::unimplemented;
 
         status_t ret;
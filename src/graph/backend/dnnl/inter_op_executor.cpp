@@ -0,0 +1,249 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+
+#include "common/dnnl_thread.hpp"
+#include "common/utils.hpp"
+
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_TBB
+#include "cpu/cpu_stream.hpp"
+#endif
+
+#include "graph/backend/dnnl/internal_attrs.hpp"
+#include "graph/backend/dnnl/inter_op_executor.hpp"
+#include "graph/backend/dnnl/op_executable.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+
+// A pool of persistent threads executing the lanes of a wave. Lane 0 is
+// executed by the calling thread, lane i > 0 by the i-th thread of the pool.
+// The pool serves one wave at a time: a caller finding the pool busy executes
+// the lanes itself.
+//
+// The threads of the pool are not threads of the CPU threading runtime. With
+// OpenMP, each of them is the root of its own team of threads, so the process
+// holds a team per lane in addition to the team of the calling thread. The
+// lanes of a wave use as many threads as available in total, but the threads
+// of the teams idle in a wave keep spinning for the OpenMP blocktime and may
+// compete with the active ones for the cores. With TBB, the lanes run in
+// arenas sharing the workers of the runtime.
+class lane_pool_t {
+public:
+    // The pool is never destroyed: its threads may still wait for work when
+    // static objects are destroyed at exit.
+    static lane_pool_t &get() {
+        static lane_pool_t *pool = new lane_pool_t();
+        return *pool;
+    }
+
+    // Runs f(0), ..., f(nlanes - 1) concurrently and returns `true` once all
+    // of them are completed. Returns `false` without running anything if the
+    // pool is busy. The first exception thrown by @p f is rethrown.
+    bool run(int nlanes, const std::function<void(int)> &f) {
+        std::unique_lock<std::mutex> run_lock(run_mutex_, std::try_to_lock);
+        if (!run_lock.owns_lock()) return false;
+
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            while ((int)workers_.size() < nlanes - 1) {
+                const int lane = (int)workers_.size() + 1;
+                workers_.emplace_back([this, lane]() { work(lane); });
+            }
+            task_ = &f;
+            nlanes_ = nlanes;
+            pending_ = nlanes - 1;
+            error_ = nullptr;
+            generation_++;
+        }
+        start_cv_.notify_all();
+
+        std::exception_ptr error;
+        try {
+            f(0);
+        } catch (...) { error = std::current_exception(); }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this]() { return pending_ == 0; });
+        if (!error) error = error_;
+        task_ = nullptr;
+        lock.unlock();
+
+        if (error) std::rethrow_exception(error);
+        return true;
+    }
+
+private:
+    lane_pool_t() = default;
+
+    void work(int lane) {
+        size_t generation = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            start_cv_.wait(
+                    lock, [&]() { return generation_ != generation; });
+            generation = generation_;
+            if (lane >= nlanes_) continue;
+
+            const std::function<void(int)> *task = task_;
+            lock.unlock();
+            std::exception_ptr error;
+            try {
+                (*task)(lane);
+            } catch (...) { error = std::current_exception(); }
+            lock.lock();
+
+            if (error && !error_) error_ = error;
+            if (--pending_ == 0) done_cv_.notify_one();
+        }
+    }
+
+    // Serializes the callers of run()
+    std::mutex run_mutex_;
+
+    // Protects the fields below
+    std::mutex mutex_;
+    std::condition_variable start_cv_;
+    std::condition_variable done_cv_;
+    std::vector<std::thread> workers_;
+    const std::function<void(int)> *task_ = nullptr;
+    int nlanes_ = 0;
+    int pending_ = 0;
+    size_t generation_ = 0;
+    std::exception_ptr error_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(lane_pool_t);
+};
+
+} // namespace
+
+bool is_inter_op_parallelism_supported(const dnnl::engine &p_engine) {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_TBB
+    return p_engine.get_kind() == dnnl::engine::kind::cpu
+            && dnnl_get_max_threads() > 1;
+#else
+    UNUSED(p_engine);
+    return false;
+#endif
+}
+
+int get_inter_op_nthr(const op_t *op) {
+    if (!op->has_attr(op_attr::inter_op_nthr)) return 0;
+    return static_cast<int>(op->get_attr<int64_t>(op_attr::inter_op_nthr));
+}
+
+void run_with_nthr(int nthr, const std::function<void()> &f) {
+    if (nthr <= 0) {
+        f();
+        return;
+    }
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP
+    // The number of threads of the parallel regions is a per-thread setting
+    struct nthr_guard_t {
+        nthr_guard_t(int nthr) : prev_nthr_(omp_get_max_threads()) {
+            omp_set_num_threads(nthr);
+        }
+        ~nthr_guard_t() { omp_set_num_threads(prev_nthr_); }
+        const int prev_nthr_;
+    } guard(nthr);
+    f();
+#elif DNNL_CPU_RUNTIME == DNNL_RUNTIME_TBB
+    // The arenas are reused as their initialization is not free
+    thread_local std::unordered_map<int, std::unique_ptr<tbb::task_arena>>
+            arenas;
+    auto &arena = arenas[nthr];
+    if (!arena) arena.reset(new tbb::task_arena(nthr));
+    arena->execute(f);
+#else
+    f();
+#endif
+}
+
+void execute_inter_op(const std::shared_ptr<subgraph_t> &sg,
+        const dnnl::stream &p_stream, const std::vector<exec_args> &args) {
+    const auto &schedule = sg->schedule_;
+    const bool nested = dnnl_in_parallel();
+
+    // Streams are not thread safe, each lane but the first one uses its own
+    // stream with the flags of the stream of the partition.
+    std::vector<dnnl::stream> streams {p_stream};
+    if (!nested) {
+        size_t max_nlanes = 1;
+        for (const auto &lanes : schedule.lanes_)
+            max_nlanes = std::max(max_nlanes, lanes.size());
+        const auto flags
+                = static_cast<dnnl::stream::flags>(p_stream.get()->flags());
+        for (size_t i = 1; i < max_nlanes; i++)
+            streams.emplace_back(p_stream.get_engine(), flags);
+    }
+    // The ops executed by the lanes are profiled on the stream of the
+    // partition.
+    auto take_profiling_records = [&]() {
+#if DNNL_CPU_RUNTIME == DNNL_RUNTIME_OMP \
+        || DNNL_CPU_RUNTIME == DNNL_RUNTIME_TBB
+        using impl::cpu::cpu_stream_t;
+        if (!p_stream.get()->is_profiling_enabled()) return;
+        auto *strm = impl::utils::downcast<cpu_stream_t *>(p_stream.get());
+        for (size_t i = 1; i < streams.size(); i++)
+            strm->take_profiling_records(
+                    *impl::utils::downcast<cpu_stream_t *>(streams[i].get()));
+#endif
+    };
+
+    auto run_lane = [&](const std::vector<size_t> &ops,
+                            const dnnl::stream &strm) {
+        for (size_t i : ops) {
+            run_with_nthr(schedule.nthr_[i],
+                    [&]() { sg->execs_[i]->execute(strm, args[i]); });
+        }
+    };
+
+    for (const auto &lanes : schedule.lanes_) {
+        const int nlanes = static_cast<int>(lanes.size());
+        if (nlanes > 1 && !nested) {
+            bool done = lane_pool_t::get().run(nlanes, [&](int lane) {
+                run_lane(lanes[lane], streams[lane]);
+                if (lane > 0) streams[lane].wait();
+            });
+            if (done) {
+                take_profiling_records();
+                continue;
+            }
+        }
+        for (const auto &lane : lanes)
+            run_lane(lane, p_stream);
+    }
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,62 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_INTER_OP_EXECUTOR_HPP
+#define GRAPH_BACKEND_DNNL_INTER_OP_EXECUTOR_HPP
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "graph/interface/op.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/subgraph.hpp"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Returns `true` if the CPU threading runtime allows to execute the ops of a
+// subgraph concurrently with a part of the available threads each.
+bool is_inter_op_parallelism_supported(const dnnl::engine &p_engine);
+
+// Returns the number of threads the op was assigned by the inter-op scheduling
+// or 0 if the op uses all the available threads.
+int get_inter_op_nthr(const op_t *op);
+
+// Runs @p f on the calling thread with the CPU threading runtime limited to
+// @p nthr threads, so the primitives created or executed by @p f use at most
+// @p nthr threads. @p f is run as is if @p nthr is not positive.
+void run_with_nthr(int nthr, const std::function<void()> &f);
+
+// Executes the non-constant ops of the subgraph following its inter-op
+// schedule: the waves are executed one after another and the lanes of a wave
+// are executed concurrently. The lanes are executed one after another if the
+// calling thread is already in a parallel region or if another subgraph is
+// being executed concurrently.
+void execute_inter_op(const std::shared_ptr<subgraph_t> &sg,
+        const dnnl::stream &p_stream, const std::vector<exec_args> &args);
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -59,8 +59,6 @@ protected:
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
-    constant_cache_t::key_t constant_key_ = 0;
-
 public:
     conv_base_t() {
         thread_local_cache_t<execution_args_set_t> res_cache;
@@ -133,6 +131,7 @@ public:
                             c_grantor.get(mem_offkey.second));
                 }
             } else {
+                constant_cache_fill_trace_t trace_scope;
                 c_buffer = std::make_shared<dnnl_constant_buffer_t>(
                         memory_planner_.total_internal_persistent_size(),
                         p_engine_, g_alloc_);
@@ -206,6 +205,7 @@ public:
                             c_grantor.get(mem_offkey.second));
                 }
             } else {
+                constant_cache_fill_trace_t trace_scope;
                 c_buffer = std::make_shared<dnnl_constant_buffer_t>(
                         memory_planner_.total_internal_persistent_size(),
                         p_engine_, g_alloc_);
@@ -350,9 +350,7 @@ public:
             return this->memory_planner_.get_exec_args_set().clone();
         };
 
-        constant_key_ = generate_constant_cache_key(part->id(),
-                memory_planner_.get_exec_args_set()
-                        .get_persistent_mem_desc_list());
+        init_constant_cache_key(part->id(), memory_planner_);
 
         return status::success;
     }
@@ -422,9 +420,7 @@ public:
             return this->memory_planner_.get_exec_args_set().clone();
         };
 
-        constant_key_ = generate_constant_cache_key(part->id(),
-                memory_planner_.get_exec_args_set()
-                        .get_persistent_mem_desc_list());
+        init_constant_cache_key(part->id(), memory_planner_);
 
         return status::success;
     }
@@ -0,0 +1,234 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_DYNAMIC_SHAPE_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_DYNAMIC_SHAPE_HPP
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/stream.hpp"
+
+#include "graph/interface/backend.hpp"
+#include "graph/interface/logical_tensor.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/dnnl_backend.hpp"
+#include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Kernel of a partition compiled with unknown dimensions. The partition is
+// compiled again for the shapes of the tensors given at execution. Each such
+// shape bucket keeps its compiled kernel, so the primitives and the constant
+// and execution argument caches of a bucket are reused by the executions with
+// the same shapes.
+//
+// The constant cache key of a kernel is computed from the partition id and the
+// memory descriptors of its constant tensors, so the buckets whose constant
+// tensors (e.g. reordered weights) have the same layouts share one copy of
+// them. The buckets are bounded both in number and in the total size of the
+// distinct constant tensors, and the constant cache entry of an evicted bucket
+// is removed once no other bucket uses it.
+struct dynamic_shape_kernel_t : public kernel_base_t {
+private:
+    // Dims and strides of the inputs and outputs.
+    using key_t = std::vector<dim_t>;
+
+    FCreateKernel kernel_creator_;
+    std::shared_ptr<dnnl_partition_impl_t> part_;
+
+    mutable std::mutex mutex_;
+    // Most recently used buckets first.
+    std::list<std::pair<key_t, kernel_ptr>> buckets_;
+    // Number of buckets using each constant cache entry.
+    std::unordered_map<size_t, size_t> constant_refs_;
+    // Total size of the distinct constant tensors of the buckets.
+    size_t constant_size_ = 0;
+    size_t capacity_;
+    size_t constant_capacity_;
+
+public:
+    // @p capacity is the maximum number of buckets and @p constant_capacity
+    // the maximum total size in bytes of their constant tensors. The most
+    // recently used bucket is kept even if its constant tensors are larger.
+    dynamic_shape_kernel_t(FCreateKernel kernel_creator, size_t capacity,
+            size_t constant_capacity)
+        : kernel_creator_(std::move(kernel_creator))
+        , capacity_(std::max(capacity, size_t(1)))
+        , constant_capacity_(constant_capacity) {}
+
+    size_t get_constant_size() const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return constant_size_;
+    }
+
+    size_t get_num_buckets() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return buckets_.size();
+    }
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override {
+        UNUSED(g_engine);
+        UNUSED(inputs);
+        part_ = std::dynamic_pointer_cast<dnnl_partition_impl_t>(
+                part->clone());
+
+        // The outputs are plain, their strides are only known at execution.
+        for (const auto &out : outputs) {
+            auto &lt = const_cast<logical_tensor_t &>(out);
+            if (lt.layout_type != layout_type::any) continue;
+            lt.layout_type = layout_type::strided;
+            for (int d = 0; d < lt.ndims; d++)
+                lt.layout.strides[d] = DNNL_GRAPH_UNKNOWN_DIM;
+        }
+        return status::success;
+    }
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override {
+        kernel_ptr kernel;
+        BACKEND_DNNL_CHECK(get_kernel(g_stream, inputs, outputs, kernel));
+        return kernel->execute(g_stream, inputs, outputs);
+    }
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        kernel_ptr kernel;
+        BACKEND_DNNL_CHECK(get_kernel(g_stream, inputs, outputs, kernel));
+        return kernel->execute_sycl(
+                g_stream, inputs, outputs, sycl_deps, sycl_event);
+    }
+#endif
+
+private:
+    // Returns the kernel compiled for the shapes of @p inputs and @p outputs,
+    // compiling it on the first use of the shapes.
+    status_t get_kernel(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs, kernel_ptr &kernel) {
+        std::vector<logical_tensor_t> in_lts, out_lts;
+        key_t key;
+        auto add_tensors = [&](const std::vector<tensor_t> &tensors,
+                                   std::vector<logical_tensor_t> &lts) {
+            for (const auto &t : tensors) {
+                const auto &lt = t.get_logical_tensor();
+                const logical_tensor_wrapper_t ltw(lt);
+                const auto *strides = lt.layout.strides;
+                if (ltw.is_shape_unknown() || !ltw.is_strided()
+                        || std::any_of(strides, strides + lt.ndims,
+                                [](dim_t s) {
+                                    return s == DNNL_GRAPH_UNKNOWN_DIM;
+                                }))
+                    return false;
+                lts.push_back(lt);
+                key.push_back(lt.ndims);
+                key.insert(key.end(), lt.dims, lt.dims + lt.ndims);
+                key.insert(key.end(), lt.layout.strides,
+                        lt.layout.strides + lt.ndims);
+            }
+            return true;
+        };
+        // The shapes of all the tensors must be known at execution.
+        if (!add_tensors(inputs, in_lts) || !add_tensors(outputs, out_lts))
+            return status::invalid_arguments;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (lookup(key, kernel)) return status::success;
+        }
+
+        // Compile outside of the lock to not block the executions of the
+        // other buckets.
+        const bool has_zero_dim = std::any_of(out_lts.begin(), out_lts.end(),
+                [](const logical_tensor_t &lt) {
+                    return logical_tensor_wrapper_t(lt).has_zero_dim();
+                });
+        kernel_ptr new_kernel = has_zero_dim ? dummy_kernel_creator()
+                                             : kernel_creator_();
+        if (!new_kernel) return status::unimplemented;
+        auto part = std::dynamic_pointer_cast<dnnl_partition_impl_t>(
+                part_->clone());
+        BACKEND_DNNL_CHECK(new_kernel->compile(
+                part.get(), g_stream->engine(), in_lts, out_lts));
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Another thread may have compiled the same bucket meanwhile.
+        if (lookup(key, kernel)) return status::success;
+        buckets_.emplace_front(std::move(key), new_kernel);
+        const size_t c_key = new_kernel->get_constant_cache_key();
+        if (c_key != 0 && constant_refs_[c_key]++ == 0)
+            constant_size_ += new_kernel->get_constant_size();
+        while (buckets_.size() > capacity_
+                || (buckets_.size() > 1
+                        && constant_size_ > constant_capacity_))
+            evict();
+        kernel = std::move(new_kernel);
+        return status::success;
+    }
+
+    // Evicts the least recently used bucket. Must be called with `mutex_`
+    // locked.
+    void evict() {
+        const kernel_ptr &kernel = buckets_.back().second;
+        const size_t c_key = kernel->get_constant_cache_key();
+        if (c_key != 0 && --constant_refs_[c_key] == 0) {
+            constant_refs_.erase(c_key);
+            constant_size_ -= kernel->get_constant_size();
+            // The executions still running with the bucket keep the buffer
+            // alive.
+            if (kernel->enabled_constant_cache())
+                dnnl_constant_cache_remove_if_exist(kernel->p_engine_, c_key);
+        }
+        buckets_.pop_back();
+    }
+
+    // Must be called with `mutex_` locked.
+    bool lookup(const key_t &key, kernel_ptr &kernel) {
+        auto it = std::find_if(buckets_.begin(), buckets_.end(),
+                [&](const std::pair<key_t, kernel_ptr> &b) {
+                    return b.first == key;
+                });
+        if (it == buckets_.end()) return false;
+        buckets_.splice(buckets_.begin(), buckets_, it);
+        kernel = it->second;
+        return true;
+    }
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
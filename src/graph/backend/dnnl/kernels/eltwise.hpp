@@ -51,7 +51,6 @@ private:
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
-    constant_cache_t::key_t constant_key_ = 0;
 
 public:
     eltwise_fwd_t() {
@@ -132,9 +131,7 @@ public:
             return this->memory_planner_.get_exec_args_set().clone();
         };
 
-        constant_key_ = generate_constant_cache_key(part->id(),
-                memory_planner_.get_exec_args_set()
-                        .get_persistent_mem_desc_list());
+        init_constant_cache_key(part->id(), memory_planner_);
 
         return status::success;
     }
@@ -199,6 +196,7 @@ public:
                             c_grantor.get(mem_offkey.second));
                 }
             } else {
+                constant_cache_fill_trace_t trace_scope;
                 c_buffer = std::make_shared<dnnl_constant_buffer_t>(
                         memory_planner_.total_internal_persistent_size(),
                         p_engine_, g_alloc_);
@@ -272,6 +270,7 @@ public:
                             c_grantor.get(mem_offkey.second));
                 }
             } else {
+                constant_cache_fill_trace_t trace_scope;
                 c_buffer = std::make_shared<dnnl_constant_buffer_t>(
                         memory_planner_.total_internal_persistent_size(),
                         p_engine_, g_alloc_);
@@ -23,6 +23,7 @@
 #include "graph/backend/dnnl/kernels/conv.hpp"
 #include "graph/backend/dnnl/kernels/convtranspose.hpp"
 #include "graph/backend/dnnl/kernels/dummy.hpp"
+#include "graph/backend/dnnl/kernels/dynamic_shape.hpp"
 #include "graph/backend/dnnl/kernels/eltwise.hpp"
 #include "graph/backend/dnnl/kernels/large_partition.hpp"
 #include "graph/backend/dnnl/kernels/layernorm.hpp"
@@ -34,6 +35,7 @@
 #include "graph/backend/dnnl/kernels/reduction.hpp"
 #include "graph/backend/dnnl/kernels/reorder.hpp"
 #include "graph/backend/dnnl/kernels/resampling.hpp"
+#include "graph/backend/dnnl/kernels/sdp.hpp"
 #include "graph/backend/dnnl/kernels/shuffle.hpp"
 #include "graph/backend/dnnl/kernels/softmax.hpp"
 #include "graph/backend/dnnl/kernels/sum.hpp"
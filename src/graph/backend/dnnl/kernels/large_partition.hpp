@@ -32,6 +32,7 @@
 #include "graph/backend/dnnl/common.hpp"
 #include "graph/backend/dnnl/dnnl_constant_tensor_cache.hpp"
 #include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/inter_op_executor.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
 #include "graph/backend/dnnl/scratchpad.hpp"
 #include "graph/backend/dnnl/thread_local_cache.hpp"
@@ -43,6 +44,7 @@
 #include "graph/backend/dnnl/passes/layout_propagation.hpp"
 #include "graph/backend/dnnl/passes/lower.hpp"
 #include "graph/backend/dnnl/passes/memory_planning.hpp"
+#include "graph/backend/dnnl/passes/schedule_ops.hpp"
 #include "graph/backend/dnnl/passes/transform.hpp"
 #include "graph/backend/dnnl/passes/utils.hpp"
 
@@ -60,7 +62,6 @@ protected:
 
     std::function<std::shared_ptr<execution_args_set_t>()> resource_ctor_;
 
-    constant_cache_t::key_t constant_key_ = 0;
 
     std::once_flag once_flag_;
     subgraph_visualizer_t vis_;
@@ -78,6 +79,10 @@ public:
         res_cache.release();
     }
 
+    const std::shared_ptr<subgraph_t> &get_subgraph() const {
+        return subgraph_;
+    }
+
     static void setup_pipeline_stage1(pass_pipeline_t &pipeline) {
         // Directly lower down (1 to 1 mapping)
         BACKEND_DNNL_ADD_PASS(pipeline, lower_down);
@@ -176,10 +181,17 @@ public:
     }
 
     static void setup_pipeline_stage2(pass_pipeline_t &pipeline,
-            memory_planner_t &mem_planner, bool enable_constant_cache) {
+            memory_planner_t &mem_planner, bool enable_constant_cache,
+            bool enable_inter_op_parallelism = false) {
         pipeline.reset_visualize_arg(true, false);
         BACKEND_DNNL_ADD_PASS(pipeline, infer_shape);
         BACKEND_DNNL_ADD_PASS(pipeline, fuse_dst_transpose_to_matmul);
+        // the layouts are picked for a preliminary number of threads of each
+        // op, schedule_ops assigns the final ones the primitives are created
+        // with
+        if (enable_inter_op_parallelism) {
+            BACKEND_DNNL_ADD_PASS(pipeline, assign_inter_op_nthr);
+        }
         BACKEND_DNNL_ADD_PASS(pipeline, layout_propagation);
         BACKEND_DNNL_ADD_PASS(pipeline, common_reorder_elimination);
         BACKEND_DNNL_ADD_PASS(pipeline, fuse_adjacent_reorders);
@@ -189,6 +201,12 @@ public:
             BACKEND_DNNL_ADD_PASS(pipeline, constant_propagation);
         }
 
+        // the memory planning needs the schedule to avoid sharing buffers
+        // between the ops running concurrently
+        if (enable_inter_op_parallelism) {
+            BACKEND_DNNL_ADD_PASS(pipeline, schedule_ops);
+        }
+
         auto memory_plan = [&](std::shared_ptr<subgraph_t> &sg) {
             return mem_planner.run(sg);
         };
@@ -198,9 +216,11 @@ public:
     }
 
     static void setup_pipeline(pass_pipeline_t &pipeline,
-            memory_planner_t &mem_planner, bool enable_constant_cache) {
+            memory_planner_t &mem_planner, bool enable_constant_cache,
+            bool enable_inter_op_parallelism = false) {
         setup_pipeline_stage1(pipeline);
-        setup_pipeline_stage2(pipeline, mem_planner, enable_constant_cache);
+        setup_pipeline_stage2(pipeline, mem_planner, enable_constant_cache,
+                enable_inter_op_parallelism);
     }
 
     status_t compile_impl(const dnnl_partition_impl_t *part,
@@ -224,8 +244,9 @@ public:
                         return this->memory_planner_.get_memory_info(val);
                     });
             pipeline_ = pass_pipeline_t(vis_);
-            setup_pipeline(
-                    pipeline_, memory_planner_, enabled_constant_cache());
+            setup_pipeline(pipeline_, memory_planner_,
+                    enabled_constant_cache(),
+                    part->get_inter_op_parallelism());
         });
 
         // Run the added passes
@@ -247,9 +268,7 @@ public:
             return this->memory_planner_.get_exec_args_set().clone();
         };
 
-        constant_key_ = generate_constant_cache_key(part->id(),
-                memory_planner_.get_exec_args_set()
-                        .get_persistent_mem_desc_list());
+        init_constant_cache_key(part->id(), memory_planner_);
 
         return status::success;
     }
@@ -319,6 +338,7 @@ public:
                             c_grantor.get(mem_offkey.second));
                 }
             } else {
+                constant_cache_fill_trace_t trace_scope;
                 c_buffer = std::make_shared<dnnl_constant_buffer_t>(
                         memory_planner_.total_internal_persistent_size(),
                         p_engine_, g_alloc_);
@@ -331,6 +351,7 @@ public:
                             c_grantor.get(mem_offkey.second));
                 }
 
+                // the constant ops use all the threads
                 for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
                     if (!subgraph_->is_constant_[i]) continue;
                     subgraph_->execs_[i]->execute(
@@ -341,6 +362,12 @@ public:
             }
         }
 
+        // without a schedule, all the ops use all the threads
+        if (!subgraph_->schedule_.empty()) {
+            execute_inter_op(subgraph_, p_stream, res->get_exec_args());
+            return status::success;
+        }
+
         for (size_t i = 0; i < subgraph_->execs_.size(); i++) {
             if (subgraph_->is_constant_[i]) continue;
             subgraph_->execs_[i]->execute(p_stream, res->get_exec_args()[i]);
@@ -391,6 +418,7 @@ public:
                             c_grantor.get(mem_offkey.second));
                 }
             } else {
+                constant_cache_fill_trace_t trace_scope;
                 c_buffer = std::make_shared<dnnl_constant_buffer_t>(
                         memory_planner_.total_internal_persistent_size(),
                         p_engine_, g_alloc_);
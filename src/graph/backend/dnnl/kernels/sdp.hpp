@@ -0,0 +1,475 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_SDP_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_SDP_HPP
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "graph/interface/backend.hpp"
+#include "graph/interface/graph.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+#include "graph/backend/dnnl/scratchpad.hpp"
+#include "graph/backend/dnnl/utils.hpp"
+
+#include "common/primitive_desc_iface.hpp"
+#include "common/sdpa_utils.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Kernel of the scaled dot-product attention partitions. On CPU the whole
+// partition is mapped to a single fused sdpa primitive which never
+// materializes the scores tensor. The partitions the primitive can't express
+// (e.g. a bias in a matmul, a non-scalar scale, a transposed probabilities
+// tensor, or a GPU engine) are executed by the larger partition kernel.
+class sdp_kernel_t : public kernel_base_t {
+private:
+    allocator_t *g_alloc_ = nullptr;
+
+    // Set when the partition is not supported by the fused primitive.
+    std::shared_ptr<kernel_base_t> fallback_;
+
+    dnnl::primitive prim_;
+    std::string impl_info_;
+    dnnl::memory::desc scratchpad_md_;
+    // Primitive argument -> index of the partition input and its descriptor.
+    std::vector<std::pair<int, size_t>> input_args_;
+    std::unordered_map<int, dnnl::memory::desc> arg_mds_;
+
+    // The operations of the partition the primitive is built from.
+    struct sdp_ops_t {
+        op_t *matmul_qk = nullptr;
+        op_t *scale = nullptr;
+        op_t *mask = nullptr;
+        op_t *softmax = nullptr;
+        op_t *quantize_probs = nullptr;
+        op_t *dequantize_probs = nullptr;
+        op_t *matmul_v = nullptr;
+        op_t *transpose = nullptr;
+        op_t *reshape = nullptr;
+        op_t *quantize_dst = nullptr;
+        op_t *dequantize_q = nullptr;
+        op_t *dequantize_k = nullptr;
+        op_t *dequantize_v = nullptr;
+    };
+
+    static bool get_quant(const op_t *op, sdpa_quant_t &quant) {
+        if (op->get_attr<std::string>(op_attr::qtype) != "per_tensor")
+            return false;
+        const auto &scales = op->get_attr<std::vector<float>>(op_attr::scales);
+        if (scales.size() != 1) return false;
+        quant.scale = scales[0];
+        quant.zero_point = 0;
+        if (op->has_attr(op_attr::zps)) {
+            const auto &zps
+                    = op->get_attr<std::vector<int64_t>>(op_attr::zps);
+            if (zps.size() > 1) return false;
+            if (zps.size() == 1) quant.zero_point = static_cast<int>(zps[0]);
+        }
+        return true;
+    }
+
+    // Returns the producer of the value if it belongs to the partition.
+    static op_t *get_producer(const std::unordered_set<const op_t *> &ops,
+            const std::shared_ptr<value_t> &val, op_kind_t kind) {
+        if (!val->has_producer()) return nullptr;
+        op_t *op = &val->get_producer();
+        return ops.count(op) && op->get_kind() == kind ? op : nullptr;
+    }
+
+    // Returns the only consumer of the output of the operation.
+    static op_t *get_consumer(const std::unordered_set<const op_t *> &ops,
+            const op_t *op, op_kind_t kind) {
+        const auto &consumers = op->get_output_value(0)->get_consumers();
+        if (consumers.size() != 1) return nullptr;
+        op_t *next = &consumers[0].get_op();
+        return ops.count(next) && next->get_kind() == kind ? next : nullptr;
+    }
+
+    static bool match_ops(
+            const dnnl_partition_impl_t *part, sdp_ops_t &sdp) {
+        using namespace graph::op_kind;
+        std::unordered_set<const op_t *> ops;
+        for (const auto &op : part->get_ops()) {
+            ops.insert(op.get());
+            if (op->get_kind() == SoftMax) sdp.softmax = op.get();
+        }
+        if (!sdp.softmax) return false;
+
+        sdp.mask = get_producer(ops, sdp.softmax->get_input_value(0), Add);
+        if (!sdp.mask) return false;
+        for (size_t i = 0; i < 2 && !sdp.scale; ++i) {
+            auto val = sdp.mask->get_input_value(i);
+            sdp.scale = get_producer(ops, val, Divide);
+            if (!sdp.scale) sdp.scale = get_producer(ops, val, Multiply);
+        }
+        if (!sdp.scale) return false;
+        for (size_t i = 0; i < 2 && !sdp.matmul_qk; ++i)
+            sdp.matmul_qk = get_producer(
+                    ops, sdp.scale->get_input_value(i), MatMul);
+        if (!sdp.matmul_qk) return false;
+
+        sdp.quantize_probs = get_consumer(ops, sdp.softmax, Quantize);
+        if (sdp.quantize_probs) {
+            sdp.dequantize_probs
+                    = get_consumer(ops, sdp.quantize_probs, Dequantize);
+            if (!sdp.dequantize_probs) return false;
+        }
+        sdp.matmul_v = get_consumer(ops,
+                sdp.dequantize_probs ? sdp.dequantize_probs : sdp.softmax,
+                MatMul);
+        if (!sdp.matmul_v) return false;
+        sdp.transpose = get_consumer(ops, sdp.matmul_v, StaticTranspose);
+        if (!sdp.transpose) return false;
+        sdp.reshape = get_consumer(ops, sdp.transpose, StaticReshape);
+        if (!sdp.reshape)
+            sdp.reshape = get_consumer(ops, sdp.transpose, Reorder);
+        if (!sdp.reshape) return false;
+        sdp.quantize_dst = get_consumer(ops, sdp.reshape, Quantize);
+
+        sdp.dequantize_q = get_producer(
+                ops, sdp.matmul_qk->get_input_value(0), Dequantize);
+        sdp.dequantize_k = get_producer(
+                ops, sdp.matmul_qk->get_input_value(1), Dequantize);
+        sdp.dequantize_v = get_producer(
+                ops, sdp.matmul_v->get_input_value(1), Dequantize);
+
+        // All the operations are expected to be covered.
+        const size_t n_ops = 7 + (sdp.quantize_probs != nullptr) * 2
+                + (sdp.quantize_dst != nullptr)
+                + (sdp.dequantize_q != nullptr) + (sdp.dequantize_k != nullptr)
+                + (sdp.dequantize_v != nullptr);
+        return n_ops == ops.size();
+    }
+
+    // Initializes a 4D memory descriptor of a partition input. If `swap` is
+    // set, the last two dimensions are swapped.
+    static status_t init_input_md(memory_desc_t &md,
+            const logical_tensor_t &lt, bool swap = false) {
+        const logical_tensor_wrapper_t ltw(lt);
+        if (!ltw.is_strided() || ltw.is_shape_unknown()
+                || ltw.is_stride_unknown() || ltw.ndims() < 1
+                || ltw.ndims() > 4)
+            return status::unimplemented;
+        // Missing leading dimensions are prepended as broadcast ones.
+        const int shift = 4 - ltw.ndims();
+        dims_t dims, strides;
+        for (int d = 3; d >= 0; --d) {
+            dims[d] = d < shift ? 1 : ltw.dims()[d - shift];
+            strides[d] = d < shift ? strides[d + 1] * dims[d + 1]
+                                   : ltw.strides()[d - shift];
+        }
+        if (swap) {
+            std::swap(dims[2], dims[3]);
+            std::swap(strides[2], strides[3]);
+        }
+        return memory_desc_init_by_strides(
+                md, 4, dims, ltw.data_type(), strides);
+    }
+
+    status_t compile_fused(const dnnl_partition_impl_t *part,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) {
+        if (p_engine_.get_kind() != dnnl::engine::kind::cpu
+                || outputs.size() != 1)
+            return status::unimplemented;
+
+        sdp_ops_t sdp;
+        if (!match_ops(part, sdp)) return status::unimplemented;
+
+        // Finds the partition input corresponding to the value.
+        auto find_input = [&](const std::shared_ptr<value_t> &val,
+                                  size_t &idx) {
+            const auto id = val->get_logical_tensor().id;
+            for (idx = 0; idx < inputs.size(); ++idx)
+                if (inputs[idx].id == id) return true;
+            return false;
+        };
+        input_args_.clear();
+        auto add_input = [&](int arg, const std::shared_ptr<value_t> &val,
+                                 const op_t *dequantize) -> const
+                logical_tensor_t * {
+            size_t idx = 0;
+            if (!find_input(dequantize ? dequantize->get_input_value(0) : val,
+                        idx))
+                return nullptr;
+            input_args_.emplace_back(arg, idx);
+            return &inputs[idx];
+        };
+
+        const auto &mm_qk = *sdp.matmul_qk;
+        const auto &mm_v = *sdp.matmul_v;
+        auto transposed = [](const op_t &op, op_attr_t attr) {
+            return op.has_attr(attr) && op.get_attr<bool>(attr);
+        };
+        if (mm_qk.num_inputs() != 2 || mm_v.num_inputs() != 2
+                || transposed(mm_v, op_attr::transpose_a))
+            return status::unimplemented;
+
+        // Queries, transposed keys and values.
+        memory_desc_t q_md, k_md, v_md;
+        const auto *q_lt = add_input(
+                DNNL_ARG_QUERIES, mm_qk.get_input_value(0), sdp.dequantize_q);
+        const auto *k_lt = add_input(
+                DNNL_ARG_KEYS, mm_qk.get_input_value(1), sdp.dequantize_k);
+        const auto *v_lt = add_input(
+                DNNL_ARG_VALUES, mm_v.get_input_value(1), sdp.dequantize_v);
+        if (impl::utils::any_null(q_lt, k_lt, v_lt))
+            return status::unimplemented;
+        BACKEND_DNNL_CHECK(init_input_md(
+                q_md, *q_lt, transposed(mm_qk, op_attr::transpose_a)));
+        BACKEND_DNNL_CHECK(init_input_md(
+                k_md, *k_lt, transposed(mm_qk, op_attr::transpose_b)));
+        BACKEND_DNNL_CHECK(init_input_md(
+                v_md, *v_lt, transposed(mm_v, op_attr::transpose_b)));
+
+        // Scale: a scalar the scores are multiplied or divided by.
+        const auto &scale_op = *sdp.scale;
+        const size_t scale_idx
+                = scale_op.get_input_value(0)->has_producer()
+                        && &scale_op.get_input_value(0)->get_producer()
+                                == sdp.matmul_qk
+                ? 1
+                : 0;
+        const bool invert_scale = scale_op.get_kind() == graph::op_kind::Divide;
+        if (invert_scale && scale_idx != 1) return status::unimplemented;
+        const auto *scale_lt = add_input(
+                DNNL_ARG_SCALE, scale_op.get_input_value(scale_idx), nullptr);
+        if (!scale_lt) return status::unimplemented;
+        memory_desc_t scale_md;
+        BACKEND_DNNL_CHECK(init_input_md(scale_md, *scale_lt));
+
+        // Attention mask added to the scaled scores.
+        const auto &mask_op = *sdp.mask;
+        const size_t mask_idx
+                = mask_op.get_input_value(0)->has_producer()
+                        && &mask_op.get_input_value(0)->get_producer()
+                                == sdp.scale
+                ? 1
+                : 0;
+        const auto *mask_lt = add_input(
+                DNNL_ARG_ATTN_MASK, mask_op.get_input_value(mask_idx), nullptr);
+        if (!mask_lt) return status::unimplemented;
+        memory_desc_t mask_md;
+        BACKEND_DNNL_CHECK(init_input_md(mask_md, *mask_lt));
+
+        const auto axis = sdp.softmax->get_attr<int64_t>(op_attr::axis);
+        if (!impl::utils::one_of(axis, -1, 3)) return status::unimplemented;
+
+        // Destination: the output is the [batch, queries, heads, values]
+        // tensor which is viewed as [batch, heads, queries, values].
+        const auto &perm
+                = sdp.transpose->get_attr<std::vector<int64_t>>(op_attr::order);
+        if (perm != std::vector<int64_t> {0, 2, 1, 3})
+            return status::unimplemented;
+        const auto &mm_v_lt = mm_v.get_output_value(0)->get_logical_tensor();
+        const logical_tensor_wrapper_t mm_v_ltw(mm_v_lt);
+        if (mm_v_ltw.ndims() != 4 || mm_v_ltw.is_shape_unknown())
+            return status::unimplemented;
+        const auto o_dims = mm_v_ltw.vdims();
+
+        // The output shape is inferred if not given, and a dense layout is
+        // used if the layout is not defined.
+        auto out_lt = outputs[0];
+        logical_tensor_wrapper_t out_ltw(out_lt);
+        if (!out_ltw.is_any() && !out_ltw.is_strided())
+            return status::unimplemented;
+        const auto &inferred_lt = (sdp.quantize_dst ? sdp.quantize_dst
+                                                    : sdp.reshape)
+                                          ->get_output_value(0)
+                                          ->get_logical_tensor();
+        if (out_ltw.is_any() || out_ltw.is_shape_unknown()
+                || out_ltw.is_stride_unknown()) {
+            if (logical_tensor_wrapper_t(inferred_lt).is_shape_unknown())
+                return status::unimplemented;
+            out_lt.ndims = inferred_lt.ndims;
+            out_lt.layout_type = layout_type::strided;
+            dim_t stride = 1;
+            for (int d = out_lt.ndims - 1; d >= 0; --d) {
+                out_lt.dims[d] = inferred_lt.dims[d];
+                out_lt.layout.strides[d] = stride;
+                stride *= out_lt.dims[d];
+            }
+        }
+        const auto out_dims = out_ltw.vdims();
+        const auto out_strides = out_ltw.vstrides();
+        dims_t dst_strides;
+        if (sdp.reshape->get_kind() == graph::op_kind::Reorder) {
+            if (out_dims
+                    != std::vector<dim_t> {
+                            o_dims[0], o_dims[2], o_dims[1], o_dims[3]})
+                return status::unimplemented;
+            dst_strides[0] = out_strides[0];
+            dst_strides[1] = out_strides[2];
+            dst_strides[2] = out_strides[1];
+            dst_strides[3] = out_strides[3];
+        } else {
+            // The reshape requires a dense row-major output.
+            dim_t stride = 1;
+            for (int d = out_ltw.ndims() - 1; d >= 0; --d) {
+                if (out_dims[d] != 1 && out_strides[d] != stride)
+                    return status::unimplemented;
+                stride *= out_dims[d];
+            }
+            if (stride != impl::utils::array_product(o_dims))
+                return status::unimplemented;
+            dst_strides[3] = 1;
+            dst_strides[1] = o_dims[3];
+            dst_strides[2] = o_dims[1] * o_dims[3];
+            dst_strides[0] = o_dims[2] * dst_strides[2];
+        }
+        memory_desc_t dst_md;
+        BACKEND_DNNL_CHECK(memory_desc_init_by_strides(
+                dst_md, 4, o_dims.data(), out_ltw.data_type(), dst_strides));
+
+        sdpa_desc_t desc;
+        BACKEND_DNNL_CHECK(create_sdpa_desc(&desc, &q_md, &k_md, &v_md,
+                &dst_md, &mask_md, &scale_md, invert_scale,
+                attn_mask_type::buffer));
+        if (sdp.dequantize_q && !get_quant(sdp.dequantize_q, desc.q_quant))
+            return status::unimplemented;
+        if (sdp.dequantize_k && !get_quant(sdp.dequantize_k, desc.k_quant))
+            return status::unimplemented;
+        if (sdp.dequantize_v && !get_quant(sdp.dequantize_v, desc.v_quant))
+            return status::unimplemented;
+        if (sdp.quantize_dst && !get_quant(sdp.quantize_dst, desc.dst_quant))
+            return status::unimplemented;
+        if (sdp.quantize_probs) {
+            if (!get_quant(sdp.quantize_probs, desc.probs_quant)
+                    || !get_quant(sdp.dequantize_probs, desc.probs_dequant))
+                return status::unimplemented;
+            desc.probs_dt = sdp.quantize_probs->get_output_value(0)
+                                    ->get_logical_tensor()
+                                    .data_type;
+        }
+
+        primitive_attr_t attr;
+        BACKEND_DNNL_CHECK(attr.set_scratchpad_mode(scratchpad_mode::user));
+        primitive_desc_iface_t *pd_iface = nullptr;
+        BACKEND_DNNL_CHECK(primitive_desc_create(&pd_iface, p_engine_.get(),
+                reinterpret_cast<const op_desc_t *>(&desc), nullptr, &attr));
+        dnnl::primitive_desc_base pd(pd_iface);
+        dnnl_primitive_t c_prim = nullptr;
+        BACKEND_DNNL_CHECK(dnnl_primitive_create(&c_prim, pd.get()));
+        prim_ = dnnl::primitive(c_prim);
+        impl_info_ = pd.impl_info_str();
+
+        arg_mds_.clear();
+        for (const auto &arg : input_args_)
+            arg_mds_[arg.first]
+                    = pd.query_md(dnnl::query::exec_arg_md, arg.first);
+        arg_mds_[DNNL_ARG_DST] = pd.query_md(dnnl::query::dst_md);
+        scratchpad_md_ = pd.scratchpad_desc();
+
+        // fill the layout of the output if it was not defined by the user
+        const_cast<logical_tensor_t &>(outputs[0]) = out_lt;
+        return status::success;
+    }
+
+public:
+    // The implementation of the fused primitive, empty if the partition is
+    // executed by the larger partition kernel.
+    const std::string &get_impl_info() const { return impl_info_; }
+
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override {
+        p_engine_ = make_dnnl_engine(*g_engine);
+        g_alloc_ = reinterpret_cast<graph::allocator_t *>(
+                g_engine->get_allocator());
+
+        if (compile_fused(part, inputs, outputs) == status::success)
+            return status::success;
+
+        fallback_ = std::make_shared<larger_partition_kernel_t>();
+        return fallback_->compile_impl(part, g_engine, inputs, outputs);
+    }
+
+    status_t prepare_inplace_pairs_impl() override {
+        if (!fallback_) return status::success;
+        BACKEND_DNNL_CHECK(fallback_->prepare_inplace_pairs_impl());
+        inplace_pairs_ = fallback_->inplace_pairs_;
+        return status::success;
+    }
+
+    // The fused primitive has no constant tensors, the ones of the fallback
+    // kernel are reported on its behalf.
+    size_t get_constant_cache_key() const override {
+        return fallback_ ? fallback_->get_constant_cache_key() : 0;
+    }
+
+    size_t get_constant_size() const override {
+        return fallback_ ? fallback_->get_constant_size() : 0;
+    }
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override {
+        if (fallback_)
+            return fallback_->execute_impl(g_stream, inputs, outputs);
+
+        dnnl::stream p_stream = make_dnnl_stream(p_engine_, *g_stream);
+
+        temporary_scratchpad_t scratchpad(
+                scratchpad_md_.get_size(), p_engine_, *g_alloc_);
+        assertm(scratchpad.size() >= scratchpad_md_.get_size(),
+                "no enough scratchpad memory");
+
+        std::unordered_map<int, dnnl::memory> args;
+        for (const auto &arg : input_args_)
+            args[arg.first] = make_dnnl_memory(arg_mds_[arg.first], p_engine_,
+                    inputs[arg.second].get_data_handle());
+        args[DNNL_ARG_DST] = make_dnnl_memory(arg_mds_[DNNL_ARG_DST],
+                p_engine_, outputs[0].get_data_handle());
+        if (scratchpad_md_.get_size() > 0)
+            args[DNNL_ARG_SCRATCHPAD] = make_dnnl_memory(
+                    scratchpad_md_, p_engine_, scratchpad.get_buffer());
+
+        prim_.execute(p_stream, args);
+        return status::success;
+    }
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        // The fused primitive is only used on CPU engines.
+        if (!fallback_) return status::unimplemented;
+        return fallback_->sycl_execute_impl(
+                g_stream, inputs, outputs, sycl_deps, sycl_event);
+    }
+#endif
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -740,11 +740,17 @@ layernorm_executable_t::desc_t layernorm_executable_t::create_desc(
     bool use_affine = true;
     if (op->has_attr(op_attr::use_affine))
         use_affine = op->get_attr<bool>(op_attr::use_affine);
+    const bool is_rms_norm = op->has_attr(op_attr::is_rms_norm)
+            && op->get_attr<bool>(op_attr::is_rms_norm);
 
     auto flags = dnnl::normalization_flags::none;
-    if (use_affine)
+    if (is_rms_norm) {
+        flags |= dnnl::normalization_flags::rms_norm;
+        if (use_affine) flags |= dnnl::normalization_flags::use_scale;
+    } else if (use_affine) {
         flags |= (dnnl::normalization_flags::use_scale
                 | dnnl::normalization_flags::use_shift);
+    }
 
     prop_kind pkind = keep_stats ? prop_kind::forward_training
                                  : prop_kind::forward_inference;
@@ -2084,7 +2090,11 @@ arg_indices_t layernorm_executable_t::get_arg_indices(
     if (!op->has_attr(op_attr::use_affine)
             || op->get_attr<bool>(op_attr::use_affine)) {
         arg_indices.insert({DNNL_ARG_SCALE, indices_t {input, in_index++}});
-        arg_indices.insert({DNNL_ARG_SHIFT, indices_t {input, in_index++}});
+        // RMS normalization has no shift
+        if (!op->has_attr(op_attr::is_rms_norm)
+                || !op->get_attr<bool>(op_attr::is_rms_norm))
+            arg_indices.insert(
+                    {DNNL_ARG_SHIFT, indices_t {input, in_index++}});
     }
 
     const fusion_info_t &fusion_info
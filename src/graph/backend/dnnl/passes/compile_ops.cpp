@@ -21,6 +21,7 @@
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/value.hpp"
 
+#include "graph/backend/dnnl/inter_op_executor.hpp"
 #include "graph/backend/dnnl/internal_attrs.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
 #include "graph/backend/dnnl/passes/compile_ops.hpp"
@@ -58,8 +59,12 @@ status_t compile_ops(std::shared_ptr<subgraph_t> &sg) {
         auto cur_op = op->shared_from_this();
         auto creator = opm->get_additional_item<executable_creator_func>(
                 "executable_creator");
-        std::shared_ptr<op_executable_t> exec
-                = creator(cur_op, p_engine, mgr, pd_cache);
+        // The primitives are created with the number of threads the op is
+        // executed with
+        std::shared_ptr<op_executable_t> exec;
+        run_with_nthr(get_inter_op_nthr(op), [&]() {
+            exec = creator(cur_op, p_engine, mgr, pd_cache);
+        });
 
         if (!exec) {
             assertm(false, "unimplemented op, can't compile it");
@@ -24,6 +24,7 @@
 #include "graph/interface/value.hpp"
 
 #include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/inter_op_executor.hpp"
 #include "graph/backend/dnnl/layout_propagator.hpp"
 
 namespace dnnl {
@@ -126,8 +127,13 @@ status_t layout_propagation(std::shared_ptr<subgraph_t> &sg) {
             auto cur_op = op->shared_from_this();
             auto propagator = opm->get_additional_item<layout_propagator_func>(
                     "layout_propagator");
-            status_t status
-                    = propagator(cur_op, p_engine, mgr, pd_cache, rewriter);
+            // The primitive descriptors are created with the number of threads
+            // the op is executed with
+            status_t status = status::success;
+            run_with_nthr(get_inter_op_nthr(op), [&]() {
+                status = propagator(
+                        cur_op, p_engine, mgr, pd_cache, rewriter);
+            });
 
             visited.insert(op);
             return status;
@@ -171,6 +171,20 @@ static status_t batchnorm_fwd_handler(
     return status::success;
 }
 
+static status_t rms_norm_handler(
+        const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
+    auto new_op = std::make_shared<op_t>(op_kind::dnnl_layernorm);
+    new_op->set_attr<bool>(op_attr::is_rms_norm, true);
+    // RMSNorm has no statistics outputs and no shift input
+    new_op->set_attr<bool>(op_attr::keep_stats, false);
+    new_op->set_attr<bool>(op_attr::use_affine, op->num_inputs() > 1);
+    new_op->merge_attributes(op->get_attributes());
+
+    rewriter.replace_op(op, new_op);
+    insert_empty_scratchpad(new_op);
+    return status::success;
+}
+
 static status_t reduction_handler(
         const std::shared_ptr<op_t> &op, subgraph_rewriter_t &rewriter) {
     auto new_op = std::make_shared<op_t>(op_kind::dnnl_reduction);
@@ -655,6 +669,7 @@ static const std::unordered_map<graph::op_kind_t, handler_func> handler_table {
         // layernorm
         ITEM(LayerNorm, common_handler<op_kind::kDnnl_layernorm>),
         ITEM(LayerNormBackward, common_handler<op_kind::kDnnl_layernorm_bwd>),
+        ITEM(RMSNorm, rms_norm_handler),
         // quantization
         ITEM(Quantize, static_quant_handler),
         ITEM(Dequantize, static_dequant_handler),
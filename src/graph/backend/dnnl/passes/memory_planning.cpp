@@ -464,7 +464,25 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
         fusion_info_mgr_t &mgr, bool enable_standard_sharing) {
     std::unordered_map<size_t, size_t> temporary_buffer_ref_count;
 
+    // With an inter-op schedule, the ops of a wave run concurrently. So a
+    // buffer can only be reused by an op of a later wave than all the ops
+    // which used it, which is tracked by the last wave of each buffer.
+    const auto &waves = sg->schedule_.wave_;
+    const bool concurrent = !waves.empty();
+    std::unordered_map<size_t, size_t> temporary_buffer_last_wave;
+    size_t op_idx = 0;
+
     auto func = [&](op_t *op) {
+        assertm(!concurrent || op_idx < waves.size(),
+                "the schedule doesn't match the subgraph");
+        const size_t wave = concurrent ? waves[op_idx] : 0;
+        op_idx++;
+        auto use_in_wave = [&](size_t buf_idx) {
+            if (!concurrent) return;
+            auto &last_wave = temporary_buffer_last_wave[buf_idx];
+            last_wave = std::max(last_wave, wave);
+        };
+
         // Handle alias first
         auto inputs = op->get_input_values();
         for (auto &in : inputs) {
@@ -487,7 +505,10 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
                 if (info.kind_ != internal_temporary) continue;
 
                 bool reuse_in_buffer
-                        = temporary_buffer_ref_count[info.index_] == 1;
+                        = temporary_buffer_ref_count[info.index_] == 1
+                        && (!concurrent
+                                || temporary_buffer_last_wave[info.index_]
+                                        < wave);
                 if (reuse_in_buffer) {
                     value_t *out = op->get_output_value(pair.out_idx_).get();
                     if (!buffer_assignments_.count(out)) {
@@ -507,22 +528,30 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             // this output need a new buffer, record it
             auto lt = out->get_logical_tensor();
             size_t idx = temporary_buffer_assigner_.request(
-                    make_dnnl_memory_desc(lt).get_size());
+                    make_dnnl_memory_desc(lt).get_size(),
+                    concurrent ? wave : static_cast<size_t>(-1));
             buffer_assignments_.insert(std::make_pair(
                     out.get(), assign_info_t(internal_temporary, idx)));
             temporary_buffer_ref_count[idx] = edge_ref_count.at(out.get());
         }
 
+        for (auto &out : op->get_output_values()) {
+            assign_info_t info = buffer_assignments_.at(out.get());
+            if (info.kind_ == internal_temporary) use_in_wave(info.index_);
+        }
+
         // Free inputs
         for (auto &in : op->get_input_values()) {
             assign_info_t info = buffer_assignments_.at(in.get());
             if (info.kind_ != internal_temporary) continue;
 
+            use_in_wave(info.index_);
             --temporary_buffer_ref_count[info.index_];
             // if we decrease it to zero, we are ready to release
             if (enable_standard_sharing
                     && temporary_buffer_ref_count[info.index_] == 0) {
-                temporary_buffer_assigner_.release(info.index_);
+                temporary_buffer_assigner_.release(info.index_,
+                        temporary_buffer_last_wave[info.index_]);
             }
         }
 
@@ -535,7 +564,8 @@ status_t memory_planner_t::assign_internal_temporary_buffer(
             if (consumers.empty()) {
                 --temporary_buffer_ref_count[info.index_];
                 if (enable_standard_sharing) {
-                    temporary_buffer_assigner_.release(info.index_);
+                    temporary_buffer_assigner_.release(info.index_,
+                            temporary_buffer_last_wave[info.index_]);
                 }
             }
         }
@@ -869,9 +899,13 @@ status_t memory_planner_t::run(std::shared_ptr<subgraph_t> &sg) {
     ret = assign_internal_temporary_buffer(sg, edge_ref_count, mgr, true);
     if (ret != status::success) return ret;
 
-    // Check which input/output pair of the subgraph can be inplaced
-    ret = prepare_subgraph_inplace_pairs(sg, false);
-    if (ret != status::success) return ret;
+    // Check which input/output pair of the subgraph can be inplaced. The pairs
+    // are not reported for concurrent execution since an input may still be
+    // read by another op of the wave writing the output.
+    if (sg->schedule_.empty()) {
+        ret = prepare_subgraph_inplace_pairs(sg, false);
+        if (ret != status::success) return ret;
+    }
 
     ret = book_buffers(sg);
     if (ret != status::success) return ret;
@@ -17,6 +17,7 @@
 #define GRAPH_BACKEND_DNNL_PASSES_MEMORY_PLANNING_HPP
 
 #include <algorithm>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <queue>
@@ -189,22 +190,30 @@ private:
 // the request. If found, return it directly. If not found, the assigner will
 // allocate a new buffer and return it. When users free a buffer, the assigner
 // will put it into the free list for next usage.
+// For subgraphs executed with an inter-op schedule, a freed buffer is tagged
+// with the last wave it is used in and can only be returned to the requests
+// of later waves.
 class buffer_assigner_t {
 public:
     // constructor
     explicit buffer_assigner_t(const size_t match_range)
         : match_range_(match_range), free_(), data_() {}
 
-    // request a free buffer
-    size_t request(size_t size) {
+    // request a free buffer for an op of the given wave
+    size_t request(size_t size, size_t wave = static_cast<size_t>(-1)) {
         if (size == 0) return -1;
         // search buffers in [size / match_range_, size * match_range_)
         if (match_range_ == 0) return this->alloc(size);
         auto begin = free_.lower_bound(size / match_range_);
         auto mid = free_.lower_bound(size);
         auto end = free_.upper_bound(size * match_range_);
+        auto is_ready = [&](const buffer_info_t *e) {
+            return e->ready_wave_ < wave;
+        };
         // search for buffers larger than requested
         auto it = mid;
+        while (it != end && !is_ready(it->second))
+            ++it;
         if (it != end) {
             buffer_info_t *e = it->second;
             // Use exact matching strategy
@@ -214,6 +223,9 @@ public:
             return e->id_;
         }
         // then search for buffers smaller than requested space
+        it = mid;
+        while (it != begin && !is_ready(std::prev(it)->second))
+            --it;
         if (it != begin) {
             --it;
             buffer_info_t *e = it->second;
@@ -227,12 +239,13 @@ public:
         return this->alloc(size);
     }
 
-    // release a buffer.
-    void release(size_t id) {
+    // release a buffer last used in the given wave.
+    void release(size_t id, size_t ready_wave = 0) {
         assertm(id < data_.size() || id == static_cast<size_t>(-1),
                 "invalid buffer id");
         if (id == static_cast<size_t>(-1)) return;
         buffer_info_t *e = data_[id].get();
+        e->ready_wave_ = ready_wave;
         free_.insert({e->max_bytes_, e});
     }
 
@@ -263,6 +276,8 @@ private:
         size_t id_;
         // maximum size of buffer requested.
         size_t max_bytes_;
+        // the last wave the freed buffer is used in.
+        size_t ready_wave_ = 0;
     };
 
     // scale used for rough match
@@ -293,6 +308,10 @@ private:
 //   as an example: when writing data to t4, t2 is not used any more, so they
 //   have disjoint live range and we can make them share same buffer.
 //
+// When the subgraph has an inter-op schedule, the ops of a wave may run in any
+// order, so the live ranges are counted in waves: a buffer is only shared with
+// an op of a later wave than all the ops using it before.
+//
 // The following internal env vars can be used to control the memory planning:
 // - _ONEDNN_GRAPH_ENABLE_MEM_REUSE
 //     - 0: Disable memory sharing
@@ -324,6 +343,9 @@ public:
     }
 
     execution_args_set_t &get_exec_args_set() { return exec_args_set_; }
+    const execution_args_set_t &get_exec_args_set() const {
+        return exec_args_set_;
+    }
 
     status_t run(std::shared_ptr<subgraph_t> &sg);
 
@@ -0,0 +1,165 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+#include "common/dnnl_thread.hpp"
+
+#include "graph/interface/c_types_map.hpp"
+#include "graph/interface/value.hpp"
+
+#include "graph/backend/dnnl/inter_op_executor.hpp"
+#include "graph/backend/dnnl/internal_attrs.hpp"
+#include "graph/backend/dnnl/passes/schedule_ops.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+namespace {
+
+// Groups the ops of the subgraph by wave. The ops are indexed in the
+// topological order used by the memory planning and compile_ops passes. The
+// constant ops are in wave 0, the other ops are in the wave following the
+// latest wave of their producers.
+status_t group_ops_by_wave(std::shared_ptr<subgraph_t> &sg,
+        std::vector<op_t *> &ops, std::vector<size_t> &waves,
+        std::vector<std::vector<size_t>> &ops_by_wave) {
+    std::unordered_map<const op_t *, size_t> op_wave;
+    status_t ret = topo_order_visit(sg->get_output_ops(), [&](op_t *op) {
+        size_t wave = 0;
+        const bool is_constant = op->has_attr(op_attr::is_constant)
+                && op->get_attr<bool>(op_attr::is_constant);
+        if (!is_constant) {
+            wave = 1;
+            for (const auto &in : op->get_input_values()) {
+                if (!in->has_producer()) continue;
+                auto pos = op_wave.find(&in->get_producer());
+                if (pos == op_wave.end()) continue;
+                wave = std::max(wave, pos->second + 1);
+            }
+        }
+        op_wave[op] = wave;
+        ops.emplace_back(op);
+        waves.emplace_back(wave);
+        if (ops_by_wave.size() <= wave) ops_by_wave.resize(wave + 1);
+        ops_by_wave[wave].emplace_back(ops.size() - 1);
+        return status::success;
+    });
+    return ret;
+}
+
+// Returns the number of lanes the @p nops ops of a wave are distributed over
+int get_nlanes(size_t nops, int nthr) {
+    return static_cast<int>(std::min(nops, static_cast<size_t>(nthr)));
+}
+
+// Sets the number of threads of the op. The primitive descriptor created by
+// the layout propagation for a different number of threads is dropped, so that
+// compile_ops creates it again for the new one.
+void set_inter_op_nthr(std::shared_ptr<subgraph_t> &sg, op_t *op, int nthr) {
+    if (get_inter_op_nthr(op) == nthr) return;
+    if (nthr > 0)
+        op->set_attr<int64_t>(op_attr::inter_op_nthr, nthr);
+    else
+        op->remove_attr(op_attr::inter_op_nthr);
+    sg->pd_cache_.erase(op);
+}
+
+} // namespace
+
+status_t assign_inter_op_nthr(std::shared_ptr<subgraph_t> &sg) {
+    if (!is_inter_op_parallelism_supported(*sg->p_engine_))
+        return status::success;
+
+    std::vector<op_t *> ops;
+    std::vector<size_t> waves;
+    std::vector<std::vector<size_t>> ops_by_wave;
+    status_t ret = group_ops_by_wave(sg, ops, waves, ops_by_wave);
+    if (ret != status::success) return ret;
+
+    const int nthr = dnnl_get_max_threads();
+    for (const auto &wave_ops : ops_by_wave) {
+        const int nlanes = get_nlanes(wave_ops.size(), nthr);
+        if (nlanes <= 1) continue;
+        for (size_t i = 0; i < wave_ops.size(); i++) {
+            const int lane = static_cast<int>(i % nlanes);
+            int start = 0, end = 0;
+            balance211(nthr, nlanes, lane, start, end);
+            ops[wave_ops[i]]->set_attr<int64_t>(
+                    op_attr::inter_op_nthr, end - start);
+        }
+    }
+    return status::success;
+}
+
+status_t schedule_ops(std::shared_ptr<subgraph_t> &sg) {
+    auto &schedule = sg->schedule_;
+    schedule.clear();
+    if (!is_inter_op_parallelism_supported(*sg->p_engine_))
+        return status::success;
+
+    std::vector<op_t *> ops;
+    std::vector<size_t> waves;
+    std::vector<std::vector<size_t>> ops_by_wave;
+    status_t ret = group_ops_by_wave(sg, ops, waves, ops_by_wave);
+    if (ret != status::success) return ret;
+
+    // The threads are split again from the final waves: the ops inserted or
+    // removed after assign_inter_op_nthr change them. The constant ops are
+    // executed one after another with all the threads before the others.
+    size_t max_width = 0;
+    for (size_t w = 1; w < ops_by_wave.size(); w++)
+        max_width = std::max(max_width, ops_by_wave[w].size());
+    if (max_width <= 1) {
+        for (op_t *op : ops)
+            set_inter_op_nthr(sg, op, 0);
+        return status::success;
+    }
+
+    const int nthr = dnnl_get_max_threads();
+    for (size_t i : ops_by_wave[0])
+        set_inter_op_nthr(sg, ops[i], 0);
+
+    schedule.wave_ = waves;
+    schedule.lanes_.resize(ops_by_wave.size());
+    for (size_t w = 1; w < ops_by_wave.size(); w++) {
+        const auto &wave_ops = ops_by_wave[w];
+        const int nlanes = get_nlanes(wave_ops.size(), nthr);
+        schedule.lanes_[w].resize(nlanes);
+        for (size_t i = 0; i < wave_ops.size(); i++) {
+            const int lane = static_cast<int>(i % nlanes);
+            int start = 0, end = 0;
+            if (nlanes > 1) balance211(nthr, nlanes, lane, start, end);
+            set_inter_op_nthr(sg, ops[wave_ops[i]], end - start);
+            schedule.lanes_[w][lane].emplace_back(wave_ops[i]);
+        }
+    }
+
+    schedule.nthr_.reserve(ops.size());
+    for (const op_t *op : ops)
+        schedule.nthr_.emplace_back(get_inter_op_nthr(op));
+    return status::success;
+}
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,54 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_PASSES_SCHEDULE_OPS_HPP
+#define GRAPH_BACKEND_DNNL_PASSES_SCHEDULE_OPS_HPP
+
+#include <memory>
+
+#include "graph/interface/c_types_map.hpp"
+
+#include "graph/backend/dnnl/subgraph.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+/// Splits the available threads between the independent ops of the subgraph
+/// and records the number of threads of each op in its inter_op_nthr
+/// attribute, so that the layout propagation picks the layouts for this number
+/// of threads. Must run before the layout propagation. The numbers are only
+/// preliminary: schedule_ops assigns the final ones.
+status_t assign_inter_op_nthr(std::shared_ptr<subgraph_t> &sg);
+
+/// Builds the inter-op schedule of the subgraph (see inter_op_schedule_t) and
+/// assigns the final number of threads of each op from it. The constant ops
+/// and the ops of the waves with a single lane use all the threads, as do all
+/// the ops if the schedule is left empty: when the subgraph has no independent
+/// ops or when the threading runtime doesn't support inter-op parallelism.
+/// Must run after the constant propagation and before the memory planning,
+/// which makes the buffers of the ops that may run concurrently distinct, and
+/// the compile_ops pass, which creates the primitives for these numbers of
+/// threads.
+status_t schedule_ops(std::shared_ptr<subgraph_t> &sg);
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -49,6 +49,31 @@ namespace dnnl_impl {
 struct op_executable_t;
 class subgraph_rewriter_t;
 
+// The inter-op schedule of a subgraph. The ops are grouped into waves: an op
+// belongs to the wave following the latest wave of its producers, so the ops
+// of a wave don't depend on each other and can be executed concurrently once
+// the previous waves are completed. The constant ops belong to wave 0. The
+// ops of a wave are distributed over lanes, each lane being executed by a
+// separate thread with a part of the available threads.
+struct inter_op_schedule_t {
+    // The wave of each op, indexed in the same order as subgraph_t::execs_
+    std::vector<size_t> wave_;
+    // The number of threads each op is created and executed with, 0 means
+    // all the available threads. Indexed in the same order as wave_.
+    std::vector<int> nthr_;
+    // The indices of the non-constant ops executed by each lane of each wave:
+    // lanes_[wave][lane]. lanes_[0] is empty.
+    std::vector<std::vector<std::vector<size_t>>> lanes_;
+
+    bool empty() const { return wave_.empty(); }
+
+    void clear() {
+        wave_.clear();
+        nthr_.clear();
+        lanes_.clear();
+    }
+};
+
 // The subgraph_t class is a subclass of graph_t, which is used as the only
 // parameter of transformation passes. Each transformation pass will process the
 // subgraph_t object, and after that, the content of subgraph_t object will be
@@ -90,6 +115,10 @@ public:
 
     // The executable for each op in subgraph
     std::vector<std::shared_ptr<op_executable_t>> execs_;
+
+    // The schedule used to execute the independent ops concurrently. It is
+    // empty if the ops are executed one after another.
+    inter_op_schedule_t schedule_;
 };
 
 class subgraph_visualizer_t {
@@ -416,6 +416,7 @@ public:
             CASE(ReLU);
             CASE(ReLUBackward);
             CASE(Reorder);
+            CASE(RMSNorm);
             CASE(Round);
             CASE(Select);
             CASE(Sigmoid);
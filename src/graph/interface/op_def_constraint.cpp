@@ -192,6 +192,22 @@ bool check_ln_fwd_outputs_num(const op_t *n) {
     return true;
 }
 
+// check function for data_type of RMSNorm.
+// gamma can be bf16 only when data is bf16.
+bool check_rms_norm_data_type(const op_t *n) {
+    const auto input_values = n->get_input_values();
+    if (input_values.size() < 2) return true;
+
+    const logical_tensor_t &src_lt = input_values[0]->get_logical_tensor();
+    const logical_tensor_t &gamma_lt = input_values[1]->get_logical_tensor();
+    VCHECK_SHAPE_INFER(!(src_lt.data_type != data_type::bf16
+                               && gamma_lt.data_type == data_type::bf16),
+            "%s, given data type %s v.s. expected data type bf16.",
+            op_t::kind2str(n->get_kind()).c_str(),
+            dnnl_dt2str(src_lt.data_type));
+    return true;
+}
+
 // check function for output number of LayerNorm backward.
 // if use_affine == true, outputs should include mean and variance.
 bool check_ln_bwd_use_affine(const op_t *n) {
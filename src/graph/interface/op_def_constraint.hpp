@@ -42,6 +42,8 @@ bool check_interpolate_sizes_scales(const op_t *n);
 
 bool check_ln_fwd_outputs_num(const op_t *n);
 
+bool check_rms_norm_data_type(const op_t *n);
+
 bool check_ln_bwd_use_affine(const op_t *n);
 
 bool check_reduce_axes(const op_t *n);
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <limits>
@@ -24,7 +25,12 @@
 #include "oneapi/dnnl/dnnl_graph.h"
 #include "oneapi/dnnl/dnnl_graph_sycl.h"
 
+#include "common/cache_blob_pool.hpp"
+#include "common/primitive_desc_iface.hpp"
+#include "common/primitive_iface.hpp"
+#include "common/serialization_stream.hpp"
 #include "common/stream.hpp"
+#include "common/trace.hpp"
 #include "common/verbose.hpp"
 
 #include "graph/interface/allocator.hpp"
@@ -36,12 +42,140 @@
 #include "graph/interface/partition.hpp"
 #include "graph/interface/partition_cache.hpp"
 
+#include "graph/utils/debug.hpp"
+
 #ifdef DNNL_WITH_SYCL
 #include "graph/utils/sycl_check.hpp"
 #endif
 
 using namespace dnnl::impl::graph;
 
+namespace {
+
+size_t get_attribute_value_hash(
+        size_t seed, const graph::utils::attribute_value_t &value) {
+    seed = dnnl::impl::hash_combine(seed, value.get_kind());
+    if (value.check_type<bool>()) {
+        seed = dnnl::impl::hash_combine(seed, value.get<bool>());
+    } else if (value.check_type<int64_t>()) {
+        seed = dnnl::impl::hash_combine(seed, value.get<int64_t>());
+    } else if (value.check_type<float>()) {
+        seed = partition_hashing::get_array_hash(seed, &value.get<float>(), 1);
+    } else if (value.check_type<std::vector<float>>()) {
+        const auto &v = value.get<std::vector<float>>();
+        seed = partition_hashing::get_array_hash(seed, v.data(), v.size());
+    } else if (value.check_type<std::vector<int64_t>>()) {
+        const auto &v = value.get<std::vector<int64_t>>();
+        seed = partition_hashing::get_array_hash(seed, v.data(), v.size());
+    } else if (value.check_type<std::string>()) {
+        seed = dnnl::impl::hash_combine(seed, value.get<std::string>());
+    }
+    return seed;
+}
+
+// Unlike partition_hashing::get_op_hash(), takes the op attributes and the
+// logical tensors of the op into account. Attributes are hashed in the order
+// of their names, so the hash does not depend on the order of insertion.
+size_t get_cache_blob_op_hash(const op_t &op) {
+    size_t seed = partition_hashing::get_op_hash(op);
+
+    std::vector<op_attr_t> names;
+    for (const auto &attr : op.get_attributes())
+        names.push_back(attr.first);
+    std::sort(names.begin(), names.end());
+    for (const auto name : names) {
+        seed = dnnl::impl::hash_combine(seed, name);
+        seed = get_attribute_value_hash(seed, op.get_attributes().at(name));
+    }
+
+    for (size_t i = 0; i < op.num_inputs(); i++)
+        seed = dnnl::impl::hash_combine(seed,
+                logical_tensor_wrapper_t(
+                        op.get_input_value(i)->get_logical_tensor())
+                        .hash());
+    for (size_t i = 0; i < op.num_outputs(); i++)
+        seed = dnnl::impl::hash_combine(seed,
+                logical_tensor_wrapper_t(
+                        op.get_output_value(i)->get_logical_tensor())
+                        .hash());
+    return seed;
+}
+
+// Returns a hash of the compilation key that does not depend on the process
+// specific partition, op, and engine objects so that it can be stored in a
+// cache blob.
+size_t get_cache_blob_key_hash(const partition_hashing::key_t &key) {
+    size_t seed = 0;
+    seed = dnnl::impl::hash_combine(seed, key.nthread_);
+    seed = dnnl::impl::hash_combine(seed, key.inter_op_parallelism_);
+    seed = dnnl::impl::hash_combine(
+            seed, static_cast<size_t>(key.engine_id_.kind()));
+    seed = dnnl::impl::hash_combine(
+            seed, static_cast<size_t>(key.engine_id_.runtime_kind()));
+    for (const op_t *op : key.ops_)
+        seed = dnnl::impl::hash_combine(seed, get_cache_blob_op_hash(*op));
+    seed = partition_hashing::get_array_hash(
+            seed, key.ins_.data(), key.ins_.size());
+    seed = partition_hashing::get_array_hash(
+            seed, key.outs_.data(), key.outs_.size());
+    return seed;
+}
+
+// The cache blob of a compiled partition consists of a header and the cache
+// blobs of the primitives created during the compilation:
+//   header: format version, library version, CPU ISA, key hash
+//   number of primitives
+//   for each primitive: cache blob ID size, cache blob ID, cache blob size,
+//   cache blob
+void serialize_cache_blob_header(
+        dnnl::impl::serialization_stream_t &sstream, size_t key_hash) {
+    const uint32_t format_version = 1;
+    sstream.write(&format_version);
+
+    const auto version = dnnl_version();
+    sstream.write(&version->major);
+    sstream.write(&version->minor);
+    sstream.write(&version->patch);
+    const size_t hash_len = std::strlen(version->hash);
+    sstream.write(&hash_len);
+    sstream.write(version->hash, hash_len);
+
+    const auto isa = dnnl_get_effective_cpu_isa();
+    sstream.write(&isa);
+    sstream.write(&key_hash);
+}
+
+// Parses the primitive cache blobs, returns false if the cache blob is
+// malformed.
+bool deserialize_cache_blob_entries(const uint8_t *data, size_t size,
+        dnnl::impl::cache_blob_pool_t::blob_map_t &blobs) {
+    size_t pos = 0;
+    const auto read = [&](void *dst, size_t n) {
+        if (n > size - pos) return false;
+        std::memcpy(dst, data + pos, n);
+        pos += n;
+        return true;
+    };
+    const auto read_vector = [&](std::vector<uint8_t> &v) {
+        size_t n = 0;
+        if (!read(&n, sizeof(n)) || n > size - pos) return false;
+        v.assign(data + pos, data + pos + n);
+        pos += n;
+        return true;
+    };
+
+    size_t nentries = 0;
+    if (!read(&nentries, sizeof(nentries))) return false;
+    for (size_t i = 0; i < nentries; i++) {
+        std::vector<uint8_t> id, blob;
+        if (!read_vector(id) || !read_vector(blob)) return false;
+        blobs.emplace(std::move(id), std::move(blob));
+    }
+    return pos == size;
+}
+
+} // namespace
+
 /// This allows to create a partition directly with an op and an engine kind. In
 /// order to not break backend API and change the existing graph and partition
 /// implementation, we internally construct a temporal graph object, add the
@@ -173,6 +307,14 @@ status_t DNNL_API dnnl_graph_partition_get_id(
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_partition_set_inter_op_parallelism(
+        partition_t *partition, int enable) {
+    if (utils::any_null(partition)) return status::invalid_arguments;
+
+    partition->set_inter_op_parallelism(enable != 0);
+    return status::success;
+}
+
 status_t DNNL_API dnnl_graph_partition_compile(partition_t *partition,
         compiled_partition_t *compiled_partition, size_t in_num,
         const logical_tensor_t **inputs, size_t out_num,
@@ -207,6 +349,41 @@ status_t DNNL_API dnnl_graph_partition_compile(partition_t *partition,
     return status::success;
 }
 
+status_t DNNL_API dnnl_graph_partition_compile_from_cache_blob(
+        partition_t *partition, compiled_partition_t *compiled_partition,
+        size_t in_num, const logical_tensor_t **inputs, size_t out_num,
+        const logical_tensor_t **outputs, engine_t *engine, size_t size,
+        const uint8_t *cache_blob) {
+    if (utils::any_null(partition, compiled_partition, engine, cache_blob)
+            || size == 0) {
+        return status::invalid_arguments;
+    }
+
+    if (!partition->is_supported()) return status::invalid_arguments;
+
+    std::vector<const logical_tensor_t *> in {inputs, inputs + in_num};
+    std::vector<const logical_tensor_t *> out {outputs, outputs + out_num};
+
+    std::pair<compiled_partition_t *, bool> cp {compiled_partition, false};
+
+    if (get_verbose(dnnl::impl::verbose_t::create_profile,
+                dnnl::impl::component_t::graph)) {
+        double start_ms = dnnl::impl::get_msec();
+        CHECK(partition->compile_from_cache_blob(
+                cp, in, out, engine, size, cache_blob));
+        double duration_ms = dnnl::impl::get_msec() - start_ms;
+
+        const char *cache_status
+                = cp.second ? ":cache_hit" : ":from_cache_blob";
+        VPROF(start_ms, graph, compile, cache_status,
+                compiled_partition->info(), duration_ms);
+    } else {
+        CHECK(partition->compile_from_cache_blob(
+                cp, in, out, engine, size, cache_blob));
+    }
+    return status::success;
+}
+
 status_t DNNL_API dnnl_graph_partition_get_input_ports_num(
         const partition_t *partition, size_t *num) {
     if (utils::any_null(partition, num)) { return status::invalid_arguments; }
@@ -455,6 +632,14 @@ status_t DNNL_API dnnl_graph_compiled_partition_query_logical_tensor(
     return compiled_partition->query_logical_tensor(tid, lt);
 }
 
+status_t DNNL_API dnnl_graph_compiled_partition_get_cache_blob(
+        const compiled_partition_t *compiled_partition, size_t *size,
+        uint8_t *cache_blob) {
+    if (utils::any_null(compiled_partition, size))
+        return status::invalid_arguments;
+    return compiled_partition->get_cache_blob(size, cache_blob);
+}
+
 status_t DNNL_API dnnl_graph_compiled_partition_get_inplace_ports(
         const compiled_partition_t *compiled_partition,
         size_t *num_inplace_pairs, const inplace_pair_t **inplace_pairs) {
@@ -547,7 +732,8 @@ bool dnnl_graph_partition::is_supported() const {
 status_t dnnl_graph_partition::compile(compiled_partition_t *cp,
         std::vector<const logical_tensor_t *> &inputs,
         std::vector<const logical_tensor_t *> &outputs,
-        const engine_t *aengine) const {
+        const engine_t *aengine,
+        const dnnl::impl::cache_blob_pool_t::blob_map_t *blobs) const {
     status_t ret;
 
     if (!aengine || aengine->kind() != pimpl_->get_engine_kind())
@@ -584,6 +770,8 @@ status_t dnnl_graph_partition::compile(compiled_partition_t *cp,
             = effective_backends == 1 && kind == engine_kind::gpu;
     const_cast<partition_impl_t *>(pimpl_.get())
             ->set_use_blocked_layout(can_use_blocked_layout);
+    const_cast<partition_impl_t *>(pimpl_.get())
+            ->set_inter_op_parallelism(inter_op_parallelism_);
 
 #ifdef DNNL_ENABLE_GRAPH_DUMP
     if (dnnl::impl::getenv_int_user("GRAPH_DUMP", 0) > 1
@@ -609,9 +797,21 @@ status_t dnnl_graph_partition::compile(compiled_partition_t *cp,
 #endif
 
     // The impl's compile will generate the compiled_partition_impl and
-    // modify the given inputs outputs logical tensor
-    ret = pimpl_->compile(cp, tmp_inputs, tmp_outputs, aengine);
+    // modify the given inputs outputs logical tensor. The primitives created
+    // by the backend are recorded to be able to export the compiled partition
+    // as a cache blob.
+    dnnl::impl::cache_blob_pool_t pool(
+            blobs ? *blobs : dnnl::impl::cache_blob_pool_t::blob_map_t());
+    {
+        dnnl::impl::cache_blob_pool_t::scoped_activation_t scope(pool);
+        ret = pimpl_->compile(cp, tmp_inputs, tmp_outputs, aengine);
+    }
     if (status::success != ret) return ret;
+    if (cp->pimpl_) {
+        partition_hashing::key_t key(this, aengine, inputs, outputs);
+        cp->pimpl_->set_cache_blob_info(get_cache_blob_key_hash(key),
+                pool.get_recorded_primitives());
+    }
 
     // Post-process the modified logical tensor and store them
     // to compiled_partition_impl. The post-process includes
@@ -631,7 +831,8 @@ status_t dnnl_graph_partition::compile(
         std::pair<compiled_partition_t *, bool> &compiled_partition,
         std::vector<const logical_tensor_t *> &inputs,
         std::vector<const logical_tensor_t *> &outputs,
-        const engine_t *aengine) const {
+        const engine_t *aengine,
+        const dnnl::impl::cache_blob_pool_t::blob_map_t *blobs) const {
     namespace partition_hashing = partition_hashing;
     auto &global_compiled_partition_cache = compiled_partition_cache();
     partition_hashing::key_t key(this, aengine, inputs, outputs);
@@ -641,18 +842,19 @@ status_t dnnl_graph_partition::compile(
         std::vector<const logical_tensor_t *> &inputs;
         std::vector<const logical_tensor_t *> &outputs;
         const engine_t *engine;
+        const dnnl::impl::cache_blob_pool_t::blob_map_t *blobs;
         bool is_create_called;
     };
-    create_context_t context {this, inputs, outputs, aengine, false};
+    create_context_t context {this, inputs, outputs, aengine, blobs, false};
 
     compiled_partition_cache_t::create_func_ptr_t create = [](void *context) {
         auto &c = *static_cast<create_context_t *>(context);
         c.is_create_called = true;
         std::shared_ptr<compiled_partition_t> cp
                 = std::make_shared<compiled_partition_t>(*c.partition);
-        status_t status
-                = (c.partition)
-                          ->compile(cp.get(), c.inputs, c.outputs, c.engine);
+        status_t status = (c.partition)
+                                  ->compile(cp.get(), c.inputs, c.outputs,
+                                          c.engine, c.blobs);
         return compiled_partition_cache_t::result_t {std::move(cp), status};
     };
 
@@ -667,6 +869,87 @@ status_t dnnl_graph_partition::compile(
     return result.status;
 }
 
+status_t dnnl_graph_partition::compile_from_cache_blob(
+        std::pair<compiled_partition_t *, bool> &compiled_partition,
+        std::vector<const logical_tensor_t *> &inputs,
+        std::vector<const logical_tensor_t *> &outputs,
+        const engine_t *aengine, size_t size,
+        const uint8_t *cache_blob) const {
+    if (!aengine) return status::invalid_arguments;
+    // Primitives support cache blobs for the OpenCL runtime only.
+    if (aengine->kind() != engine_kind::gpu
+            || aengine->runtime_kind() != dnnl::impl::runtime_kind::ocl)
+        return status::unimplemented;
+
+    // The cache blob must be created for the same compilation key, CPU ISA,
+    // and library version.
+    partition_hashing::key_t key(this, aengine, inputs, outputs);
+    dnnl::impl::serialization_stream_t header;
+    serialize_cache_blob_header(header, get_cache_blob_key_hash(key));
+    const auto &header_data = header.get_data();
+    if (size < header_data.size()
+            || std::memcmp(cache_blob, header_data.data(), header_data.size())
+                    != 0)
+        return status::invalid_arguments;
+
+    // A valid cache blob holds at least one primitive cache blob.
+    dnnl::impl::cache_blob_pool_t::blob_map_t blobs;
+    if (!deserialize_cache_blob_entries(cache_blob + header_data.size(),
+                size - header_data.size(), blobs)
+            || blobs.empty())
+        return status::invalid_arguments;
+
+    return compile(compiled_partition, inputs, outputs, aengine, &blobs);
+}
+
+status_t dnnl_graph_compiled_partition::get_cache_blob(
+        size_t *size, uint8_t *cache_blob) const {
+    if (!pimpl_) return status::invalid_arguments;
+
+    dnnl::impl::serialization_stream_t sstream;
+    serialize_cache_blob_header(sstream, pimpl_->get_cache_blob_key_hash());
+
+    // The cache blob is supported only when all the kernels of the compiled
+    // partition can be serialized, i.e. the partition is implemented with
+    // primitives and all of them support cache blobs. Otherwise, importing
+    // the cache blob would silently compile the partition from scratch.
+    const auto &primitives = pimpl_->get_primitives();
+    if (primitives.empty()) return status::unimplemented;
+
+    dnnl::impl::cache_blob_pool_t::blob_map_t blobs;
+    for (const auto &p : primitives) {
+        const auto &id = p->pd()->impl()->get_cache_blob_id(p->engine());
+        if (id.empty()) return status::unimplemented;
+        if (blobs.count(id)) continue;
+
+        size_t blob_size = 0;
+        CHECK(dnnl_primitive_get_cache_blob(p.get(), &blob_size, nullptr));
+        std::vector<uint8_t> blob(blob_size);
+        CHECK(dnnl_primitive_get_cache_blob(p.get(), &blob_size, blob.data()));
+        blobs.emplace(id, std::move(blob));
+    }
+
+    const size_t nentries = blobs.size();
+    sstream.write(&nentries);
+    for (const auto &e : blobs) {
+        const size_t id_size = e.first.size();
+        const size_t blob_size = e.second.size();
+        sstream.write(&id_size);
+        sstream.write(e.first.data(), id_size);
+        sstream.write(&blob_size);
+        sstream.write(e.second.data(), blob_size);
+    }
+
+    const auto &data = sstream.get_data();
+    if (!cache_blob) {
+        *size = data.size();
+        return status::success;
+    }
+    if (*size != data.size()) return status::invalid_arguments;
+    std::memcpy(cache_blob, data.data(), data.size());
+    return status::success;
+}
+
 status_t dnnl_graph_compiled_partition::execute(const stream_t *astream,
         const std::vector<tensor_t> &inputs,
         const std::vector<tensor_t> &outputs) const {
@@ -696,6 +979,13 @@ status_t dnnl_graph_compiled_partition::execute(const stream_t *astream,
         pre_process(processed_inputs, inputs, backend);
         pre_process(processed_outputs, outputs, backend);
 
+        namespace trace = dnnl::impl::trace;
+        trace::scope_t trace_scope;
+        if (trace::is_enabled())
+            trace_scope.start(trace::category_t::partition,
+                    utils::partition_kind2str(src_partition_.get_kind()),
+                    info());
+
         return pimpl_->execute(astream, processed_inputs, processed_outputs);
 #endif
     }
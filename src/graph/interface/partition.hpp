@@ -27,6 +27,8 @@
 #include <unordered_map>
 #include <unordered_set>
 
+#include "common/cache_blob_pool.hpp"
+
 #include "graph/interface/c_types_map.hpp"
 #include "graph/interface/logical_tensor.hpp"
 #include "graph/interface/op.hpp"
@@ -116,16 +118,36 @@ public:
 
     size_t get_outputs_num() const { return pimpl_->get_outputs().size(); }
 
+    // Independent ops of the partition are executed concurrently by the
+    // partitions compiled after enabling inter-op parallelism.
+    void set_inter_op_parallelism(bool flag) { inter_op_parallelism_ = flag; }
+
+    bool get_inter_op_parallelism() const { return inter_op_parallelism_; }
+
+    // The primitives the compiled partition consists of are created using the
+    // given cache blobs, if any.
     graph::status_t compile(graph::compiled_partition_t *compiled_partition,
             std::vector<const graph::logical_tensor_t *> &inputs,
             std::vector<const graph::logical_tensor_t *> &outputs,
-            const graph::engine_t *e = nullptr) const;
+            const graph::engine_t *e = nullptr,
+            const dnnl::impl::cache_blob_pool_t::blob_map_t *blobs
+            = nullptr) const;
 
     graph::status_t compile(
             std::pair<graph::compiled_partition_t *, bool> &compiled_partition,
             std::vector<const graph::logical_tensor_t *> &inputs,
             std::vector<const graph::logical_tensor_t *> &outputs,
-            const graph::engine_t *aengine) const;
+            const graph::engine_t *aengine,
+            const dnnl::impl::cache_blob_pool_t::blob_map_t *blobs
+            = nullptr) const;
+
+    // Compiles the partition using a cache blob of a compiled partition.
+    graph::status_t compile_from_cache_blob(
+            std::pair<graph::compiled_partition_t *, bool> &compiled_partition,
+            std::vector<const graph::logical_tensor_t *> &inputs,
+            std::vector<const graph::logical_tensor_t *> &outputs,
+            const graph::engine_t *aengine, size_t size,
+            const uint8_t *cache_blob) const;
 
     graph::status_t infer_shape(
             std::vector<const graph::logical_tensor_t *> &inputs,
@@ -133,6 +155,7 @@ public:
 
 private:
     std::shared_ptr<const graph::partition_impl_t> pimpl_;
+    bool inter_op_parallelism_ = false;
 };
 
 ///
@@ -193,6 +216,8 @@ public:
 
     const graph::engine_t *get_engine() const { return pimpl_->get_engine(); }
 
+    graph::status_t get_cache_blob(size_t *size, uint8_t *cache_blob) const;
+
     std::vector<graph::logical_tensor_t> &get_mutable_inputs() {
         return pimpl_->get_mutable_inputs();
     }
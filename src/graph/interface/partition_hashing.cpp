@@ -29,10 +29,12 @@ namespace partition_hashing {
 key_t::key_t(size_t partition_id, const impl::engine_t *engine,
         const std::vector<std::shared_ptr<op_t>> &ops,
         const std::vector<const logical_tensor_t *> &ins,
-        const std::vector<const logical_tensor_t *> &outs)
+        const std::vector<const logical_tensor_t *> &outs,
+        bool inter_op_parallelism)
     : partition_id_(partition_id)
     , ops_(get_raw_ptrs(ops))
     , nthread_(dnnl_get_max_threads())
+    , inter_op_parallelism_(inter_op_parallelism)
     , engine_id_(engine->engine_id())
     , thread_id_(std::this_thread::get_id()) {
     ins_.reserve(ins.size());
@@ -48,7 +50,8 @@ key_t::key_t(size_t partition_id, const impl::engine_t *engine,
 key_t::key_t(const partition_t *partition, const impl::engine_t *engine,
         const std::vector<const logical_tensor_t *> &ins,
         const std::vector<const logical_tensor_t *> &outs)
-    : key_t(partition->id(), engine, partition->get_ops(), ins, outs) {}
+    : key_t(partition->id(), engine, partition->get_ops(), ins, outs,
+            partition->get_inter_op_parallelism()) {}
 
 bool key_t::operator==(const key_t &rhs) const {
     if (this == &rhs) return true;
@@ -63,6 +66,7 @@ bool key_t::operator==(const key_t &rhs) const {
     bool ret = true && lhs_num_ops == rhs_num_ops && lhs_num_ins == rhs_num_ins
             && lhs_num_outs == rhs_num_outs
             && partition_id_ == rhs.partition_id_ && nthread_ == rhs.nthread_
+            && inter_op_parallelism_ == rhs.inter_op_parallelism_
             && engine_id_ == rhs.engine_id_;
     if (!ret) return false;
 
@@ -55,7 +55,8 @@ struct key_t {
     key_t(size_t partition_id, const impl::engine_t *engine,
             const std::vector<std::shared_ptr<op_t>> &ops,
             const std::vector<const logical_tensor_t *> &ins,
-            const std::vector<const logical_tensor_t *> &outs);
+            const std::vector<const logical_tensor_t *> &outs,
+            bool inter_op_parallelism = false);
     key_t(const partition_t *partition, const impl::engine_t *engine,
             const std::vector<const logical_tensor_t *> &ins,
             const std::vector<const logical_tensor_t *> &outs);
@@ -72,6 +73,7 @@ struct key_t {
     mutable std::vector<logical_tensor_t> ins_;
     mutable std::vector<logical_tensor_t> outs_;
     int nthread_;
+    bool inter_op_parallelism_;
     impl::engine_id_t engine_id_;
 
 private:
@@ -149,9 +151,11 @@ struct hash<dnnl::impl::graph::partition_hashing::key_t> {
         using namespace dnnl::impl::graph::partition_hashing;
 
         size_t seed = 0;
-        // Compute hash for partition_id_, nthread_, engine_kind_
+        // Compute hash for partition_id_, nthread_, inter_op_parallelism_,
+        // engine_kind_
         seed = dnnl::impl::hash_combine(seed, key.partition_id_);
         seed = dnnl::impl::hash_combine(seed, key.nthread_);
+        seed = dnnl::impl::hash_combine(seed, key.inter_op_parallelism_);
         seed = dnnl::impl::hash_combine(seed, key.engine_id_.hash());
 
         // Combine hash for op_kinds & attributes with the computed hash
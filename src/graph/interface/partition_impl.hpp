@@ -184,6 +184,18 @@ public:
         return can_use_blocked_layout_;
     }
 
+    /// Used to set if independent ops of the partition can be executed
+    /// concurrently
+    virtual void set_inter_op_parallelism(bool flag) {
+        inter_op_parallelism_ = flag;
+    }
+
+    /// Used to check if independent ops of the partition can be executed
+    /// concurrently
+    virtual bool get_inter_op_parallelism() const {
+        return inter_op_parallelism_;
+    }
+
 protected:
     // Engine kind
     engine_kind_t engine_kind_;
@@ -244,6 +256,8 @@ protected:
 
     bool can_use_blocked_layout_;
 
+    bool inter_op_parallelism_ = false;
+
 private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(partition_impl_t);
 };
@@ -315,6 +329,23 @@ public:
 
     std::vector<logical_tensor_t> &get_mutable_outputs() { return outputs_; }
 
+    /// The setter and getters for the information used to export the
+    /// compiled partition as a cache blob: the persistent hash of the
+    /// compilation key and the primitives created during compilation
+    void set_cache_blob_info(size_t key_hash,
+            const std::vector<std::shared_ptr<primitive_iface_t>>
+                    &primitives) {
+        cache_blob_key_hash_ = key_hash;
+        primitives_ = primitives;
+    }
+
+    size_t get_cache_blob_key_hash() const { return cache_blob_key_hash_; }
+
+    const std::vector<std::shared_ptr<primitive_iface_t>> &
+    get_primitives() const {
+        return primitives_;
+    }
+
     /// Execute a compiled_partition with given inputs/outputs tensors
     /// @param astream For different device target, stream represent
     ///     different runtime object, which can be used to execute the
@@ -381,6 +412,10 @@ protected:
     /// If B and C can share same buffer, then the inplace_pairs_
     /// should be [{2, 3}]
     std::vector<inplace_pair_t> inplace_pairs_;
+
+private:
+    size_t cache_blob_key_hash_ = 0;
+    std::vector<std::shared_ptr<primitive_iface_t>> primitives_;
 };
 
 } // namespace graph
@@ -62,6 +62,17 @@ void check_correctness(
 int verify_input(const settings_t &s) {
     const int n_inputs = s.prb_vdims.n_inputs();
 
+    for (const auto &i_sdt : s.sdt) {
+        const int n_sdts = static_cast<int>(i_sdt.size());
+        if (n_sdts != n_inputs && n_sdts != 1) {
+            BENCHDNN_PRINT(0,
+                    "ERROR: Expected number of sdt arguments is `1` or `%d`, "
+                    "provided `%d`.\n",
+                    n_inputs, n_sdts);
+            SAFE_V(FAIL);
+        }
+    }
+
     for (const auto &i_stag : s.stag) {
         const int n_stags = static_cast<int>(i_stag.size());
         if (n_stags != n_inputs && n_stags != 1) {
@@ -85,7 +96,7 @@ int bench(int argc, char **argv) {
     for (; argc > 0; --argc, ++argv) {
         const bool parsed_options = parse_bench_settings(argv[0])
                 || parse_batch(bench, argv[0])
-                || parse_dt(s.sdt, def.sdt, argv[0], "sdt")
+                || parse_multi_dt(s.sdt, def.sdt, argv[0])
                 || parse_dt(s.ddt, def.ddt, argv[0], "ddt")
                 || parse_multi_tag(s.stag, def.stag, argv[0])
                 || parse_tag(s.dtag, def.dtag, argv[0], "dtag")
@@ -40,7 +40,8 @@ dnnl_status_t init_pd(init_pd_args_t<prb_t> &init_pd_args) {
     for (int i_input = 0; i_input < prb->n_inputs(); ++i_input) {
         const dims_t &i_vdims = prb->vdims[i_input];
         src_d_wrappers[i_input] = dnn_mem_t::init_md(
-                prb->ndims, i_vdims.data(), prb->sdt, prb->stag[i_input]);
+                prb->ndims, i_vdims.data(), prb->sdt[i_input],
+                prb->stag[i_input]);
     }
 
     benchdnn_dnnl_wrapper_t<dnnl_memory_desc_t> dst_d {};
@@ -100,25 +101,28 @@ int fill_src(int input_idx, dnnl_data_type_t dt, dnn_mem_t &mem_dt,
 }
 
 void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
-    skip_unimplemented_data_type({prb->sdt, prb->ddt}, prb->dir, res);
-    skip_unimplemented_sum_po(prb->attr, res, dnnl_concat, prb->sdt);
+    std::vector<dnnl_data_type_t> dts = prb->sdt;
+    dts.push_back(prb->ddt);
+    skip_unimplemented_data_type(dts, prb->dir, res);
+    skip_unimplemented_sum_po(prb->attr, res, dnnl_concat, prb->sdt[0]);
     skip_unimplemented_prelu_po(prb->attr, res, dnnl_concat);
     skip_unimplemented_arg_scale(prb->attr, res);
 
     // ref concat is reorder-based, hence, inherits some reorder limitations.
     // bf16, f16 reorders on cpu supports only [bf16, f16]<->f32
-    bool valid_xf16_input
-            = IMPLICATION(prb->sdt == dnnl_bf16 || prb->sdt == dnnl_f16,
-                    prb->dtag == tag::undef || prb->ddt == dnnl_f32
-                            || prb->ddt == prb->sdt);
-    bool valid_xf16_output
-            = IMPLICATION((prb->ddt == dnnl_bf16 || prb->ddt == dnnl_f16)
-                            && prb->dtag != tag::undef,
-                    (prb->sdt == dnnl_f32 || prb->sdt == prb->ddt));
-
-    if (is_cpu() && (!valid_xf16_input || !valid_xf16_output)) {
-        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
-        return;
+    const auto ddt = prb->get_ddt();
+    for (const auto &sdt : prb->sdt) {
+        bool valid_xf16_input
+                = IMPLICATION(sdt == dnnl_bf16 || sdt == dnnl_f16,
+                        ddt == dnnl_f32 || ddt == sdt);
+        bool valid_xf16_output
+                = IMPLICATION(ddt == dnnl_bf16 || ddt == dnnl_f16,
+                        sdt == dnnl_f32 || sdt == ddt);
+
+        if (is_cpu() && (!valid_xf16_input || !valid_xf16_output)) {
+            res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+            return;
+        }
     }
 }
 
@@ -156,7 +160,8 @@ int init_ref_memory_args(dnn_mem_map_t &ref_mem_map, dnn_mem_map_t &mem_map,
                 bool is_src_arg = (exec_arg & DNNL_ARG_MULTIPLE_SRC);
                 bool is_scales_arg = (exec_arg & DNNL_ARG_ATTR_SCALES);
                 if (is_src_arg && !is_scales_arg) {
-                    SAFE(fill_src(exec_arg, prb->ddt, mem, ref_mem), WARN);
+                    SAFE(fill_src(exec_arg, prb->get_ddt(), mem, ref_mem),
+                            WARN);
                 } else if (is_scales_arg) {
                     int exec_src_arg = exec_arg ^ DNNL_ARG_ATTR_SCALES;
                     // Leave hard coded until supported mask is 0 only.
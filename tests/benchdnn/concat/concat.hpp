@@ -39,7 +39,8 @@ struct settings_t : public base_settings_t {
 
     prb_vdims_t prb_vdims;
 
-    std::vector<dnnl_data_type_t> sdt {dnnl_f32}, ddt {dnnl_f32};
+    std::vector<std::vector<dnnl_data_type_t>> sdt {{dnnl_f32}};
+    std::vector<dnnl_data_type_t> ddt {dnnl_f32};
     std::vector<std::vector<std::string>> stag {{tag::abx}};
     std::vector<std::string> dtag {tag::undef};
     std::vector<int> axis {1};
@@ -69,8 +70,9 @@ struct prb_t : public prb_vdims_t {
         SAFE_V(s.has_single_setup() ? OK : FAIL);
     }
 
-    prb_t(const prb_vdims_t &prb_vdims, dnnl_data_type_t sdt,
-            dnnl_data_type_t ddt, const std::vector<std::string> &stag,
+    prb_t(const prb_vdims_t &prb_vdims,
+            const std::vector<dnnl_data_type_t> &sdt, dnnl_data_type_t ddt,
+            const std::vector<std::string> &stag,
             const std::string &dtag, int axis, const attr_t &attr,
             const thr_ctx_t &ctx_init, const thr_ctx_t &ctx_exe)
         : prb_vdims_t(prb_vdims)
@@ -85,7 +87,11 @@ struct prb_t : public prb_vdims_t {
         // If dst is omitted by `dtag = tag::undef`, omit `ddt` as well.
         if (dtag == tag::undef) this->ddt = dnnl_data_type_undef;
 
-        // Broadcast tag if needed
+        // Broadcast data type and tag if needed
+        if (sdt.size() == 1) {
+            const auto val = sdt[0]; // Need a copy here.
+            this->sdt.assign(prb_vdims.n_inputs(), val);
+        }
         if (stag.size() == 1) {
             const auto val = stag[0]; // Need a copy here.
             this->stag.assign(prb_vdims.n_inputs(), val);
@@ -96,13 +102,20 @@ struct prb_t : public prb_vdims_t {
     }
 
     dir_t dir = FLAG_FWD; // Lack of prop_kind, always considered as forward.
-    dnnl_data_type_t sdt, ddt;
+    std::vector<dnnl_data_type_t> sdt;
+    dnnl_data_type_t ddt;
     std::vector<std::string> stag;
     std::string dtag;
     int axis;
     attr_t attr;
     thr_ctx_t ctx_init, ctx_exe;
 
+    // The data type of the destination, which is the data type of the first
+    // source when the destination is omitted.
+    dnnl_data_type_t get_ddt() const {
+        return dtag == tag::undef ? sdt[0] : ddt;
+    }
+
     int64_t axis_size() const {
         int64_t as = 0;
         for (int i = 0; i < n_inputs(); ++i)
@@ -129,7 +142,6 @@ struct perf_report_t : public base_perf_report_t {
     perf_report_t(const prb_t *prb, const char *perf_template)
         : base_perf_report_t(perf_template)
         , p_(prb)
-        , sdt_({p_->sdt})
         , stag_({})
         , dtag_(normalize_tag(p_->dtag, p_->ndims)) {
         for (size_t d = 0; d < p_->stag.size(); d++)
@@ -147,14 +159,15 @@ struct perf_report_t : public base_perf_report_t {
     const thr_ctx_t *ctx_exe() const override { return &p_->ctx_exe; }
     const std::string *name() const override { return &p_->name; }
     const int *axis() const override { return &p_->axis; }
-    const std::vector<dnnl_data_type_t> *sdt() const override { return &sdt_; }
+    const std::vector<dnnl_data_type_t> *sdt() const override {
+        return &p_->sdt;
+    }
     const dnnl_data_type_t *ddt() const override { return &p_->ddt; }
     const std::vector<std::string> *stag() const override { return &stag_; }
     const std::string *dtag() const override { return &dtag_; }
 
 private:
     const prb_t *p_;
-    std::vector<dnnl_data_type_t> sdt_;
     std::vector<std::string> stag_;
     std::string dtag_;
 };
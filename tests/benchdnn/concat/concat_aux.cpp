@@ -28,11 +28,15 @@ std::string prb_t::set_repro_line() {
     dump_global_params(s);
     settings_t def;
 
+    bool has_default_dts = true;
+    for (const auto &i_sdt : sdt)
+        has_default_dts = has_default_dts && i_sdt == def.sdt[0][0];
+
     bool has_default_tags = true;
     for (const auto &i_stag : stag)
         has_default_tags = has_default_tags && i_stag == tag::abx;
 
-    if (canonical || sdt != def.sdt[0]) s << "--sdt=" << sdt << " ";
+    if (canonical || !has_default_dts) s << "--sdt=" << sdt << " ";
     if (canonical || (dtag != def.dtag[0] && ddt != def.ddt[0]))
         s << "--ddt=" << ddt << " ";
     if (canonical || !has_default_tags) s << "--stag=" << stag << " ";
@@ -376,7 +376,8 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
 
     float trh = 0.f;
     if (prb->alg & WINO) {
-        trh = prb->dt[1] == dnnl_f16 ? 7e-3f : 2e-5f;
+        const bool is_xf16 = prb->dt[1] == dnnl_f16 || prb->dt[1] == dnnl_bf16;
+        trh = is_xf16 ? 7e-3f : 2e-5f;
         if (prb->dir & FLAG_WEI) {
             // This is an empirical equation derived by observing growth error
             // with increasing 'k' dimension in gemm of winograd
@@ -771,6 +771,8 @@ std::ostream &dump_global_params(std::ostream &s) {
 #endif
     if (canonical || cold_cache_mode != default_cold_cache_mode)
         s << "--cold-cache=" << cold_cache_mode << " ";
+    if (canonical || cold_start != false)
+        s << "--cold-start=" << bool2str(cold_start) << " ";
 
     return s;
 }
@@ -50,6 +50,7 @@
 
 extern "C" dnnl_status_t dnnl_impl_notify_profiling_complete(
         dnnl_stream_t stream);
+extern "C" dnnl_status_t dnnl_impl_get_jit_generation_time(double *ms);
 
 int check_pd_cache(const_dnnl_primitive_desc_t pd, res_t *res) {
     // Disable this check for threadpool. A threadpool is always defined in
@@ -231,6 +232,72 @@ int test_persistent_cache_api(
     return OK;
 }
 
+// Creates a primitive from a `pd` returned by `create_pd` and from
+// `cache_blob` if it's not empty. The JIT code generation time is accounted by
+// the library per thread.
+static int create_primitive_timed(
+        benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &primw,
+        const create_pd_func_t &create_pd,
+        const std::vector<uint8_t> &cache_blob, res_t *res,
+        const std::string &cpd_timer, const std::string &cp_timer,
+        const std::string &jit_timer) {
+    benchdnn_dnnl_wrapper_t<dnnl_primitive_desc_t> pdw;
+    TIME_FUNC(SAFE(create_pd(pdw), WARN), res, cpd_timer);
+    // The tested primitive was created, so the same `pd` is expected.
+    if (!pdw) return FAIL;
+
+    double jit_start_ms = 0, jit_end_ms = 0;
+    DNN_SAFE(dnnl_impl_get_jit_generation_time(&jit_start_ms), WARN);
+    dnnl_primitive_t prim {};
+    if (cache_blob.empty()) {
+        TIME_FUNC(DNN_SAFE(dnnl_primitive_create(&prim, pdw), WARN), res,
+                cp_timer);
+    } else {
+        TIME_FUNC(DNN_SAFE(dnnl_primitive_create_from_cache_blob(&prim, pdw,
+                                   cache_blob.size(), cache_blob.data()),
+                          WARN),
+                res, cp_timer);
+    }
+    primw.reset(prim);
+    DNN_SAFE(dnnl_impl_get_jit_generation_time(&jit_end_ms), WARN);
+    res->timer_map.get_timer(jit_timer).stop(1, 0, jit_end_ms - jit_start_ms);
+    return OK;
+}
+
+int measure_cold_start(const create_pd_func_t &create_pd, res_t *res) {
+    using namespace timer::names;
+    const std::vector<uint8_t> no_cache_blob;
+
+    // Cold: re-setting the capacity flushes the primitive cache.
+    int capacity = 0;
+    DNN_SAFE(dnnl_get_primitive_cache_capacity(&capacity), WARN);
+    DNN_SAFE(dnnl_set_primitive_cache_capacity(0), WARN);
+    DNN_SAFE(dnnl_set_primitive_cache_capacity(capacity), WARN);
+    benchdnn_dnnl_wrapper_t<dnnl_primitive_t> cold_prim;
+    SAFE(create_primitive_timed(cold_prim, create_pd, no_cache_blob, res,
+                 cold_cpd_timer, cold_cp_timer, cold_jit_timer),
+            WARN);
+
+    // Warm: the primitive is expected to come from the primitive cache.
+    benchdnn_dnnl_wrapper_t<dnnl_primitive_t> warm_prim;
+    SAFE(create_primitive_timed(warm_prim, create_pd, no_cache_blob, res,
+                 warm_cpd_timer, warm_cp_timer, warm_jit_timer),
+            WARN);
+
+    // Persistent warm: the primitive cache is disabled. The primitive is
+    // created from a cache blob where the API is supported, the x64 JIT code
+    // is loaded from ONEDNN_JIT_CACHE_DIR when it's set.
+    std::vector<uint8_t> cache_blob;
+    if (is_gpu() && DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL)
+        SAFE(get_cache_blob(cache_blob, cold_prim), WARN);
+    const auto old_capacity = set_primitive_cache_capacity_without_clearing(0);
+    benchdnn_dnnl_wrapper_t<dnnl_primitive_t> pwarm_prim;
+    const int status = create_primitive_timed(pwarm_prim, create_pd,
+            cache_blob, res, pwarm_cpd_timer, pwarm_cp_timer, pwarm_jit_timer);
+    set_primitive_cache_capacity_without_clearing(old_capacity);
+    return status;
+}
+
 // Engine kind used to run oneDNN primitives for testing
 dnnl_engine_kind_t engine_tgt_kind = dnnl_cpu;
 // Engine index used to run oneDNN primitives for testing
@@ -338,8 +405,18 @@ int execute_and_wait(perf_function_t &exec_func, const dnnl_engine_t &engine,
 
     execute_unmap_args(args, dnnl_args);
 
+    // Cold start mode: the first execution of a problem is timed.
+    const bool time_first_exec = res && cold_start
+            && has_bench_mode_bit(mode_bit_t::perf)
+            && res->timer_map.get_timer(timer::names::first_exec_timer).times()
+                    == 0;
+
+    timer::timer_t t;
     auto status = exec_func(stream, dnnl_args);
     DNN_SAFE(dnnl_stream_wait(stream), CRIT);
+    t.stamp();
+    if (time_first_exec && status == dnnl_success)
+        res->timer_map.get_timer(timer::names::first_exec_timer) = t;
     if (res) res->state = EXECUTED;
 
     execute_map_args(args);
@@ -20,6 +20,7 @@
 #include <functional>
 #include <stddef.h>
 #include <stdint.h>
+#include <type_traits>
 #include <vector>
 
 #include "oneapi/dnnl/dnnl.h"
@@ -407,6 +408,15 @@ int check_pd_w_and_wo_attr(dnnl_engine_t engine, const func_t &init_pd_func,
     return OK;
 }
 
+typedef std::function<int(benchdnn_dnnl_wrapper_t<dnnl_primitive_desc_t> &)>
+        create_pd_func_t;
+
+// Cold start mode: times the creation of a primitive from a `pd` returned by
+// `create_pd` with the primitive cache flushed, with the primitive cache hit
+// and with the primitive cache disabled while the persistent caches are
+// populated.
+int measure_cold_start(const create_pd_func_t &create_pd, res_t *res);
+
 template <typename func_t, typename prb_t>
 int init_prim(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &user_prim,
         const func_t &init_pd_func, const prb_t *prb, res_t *res,
@@ -462,6 +472,20 @@ int init_prim(benchdnn_dnnl_wrapper_t<dnnl_primitive_t> &user_prim,
                 WARN);
     }
 
+    if (cold_start && has_bench_mode_bit(mode_bit_t::perf)) {
+        using pd_args_t
+                = init_pd_args_t<typename std::remove_const<prb_t>::type>;
+        const auto create_pd
+                = [&](benchdnn_dnnl_wrapper_t<dnnl_primitive_desc_t> &pdw) {
+                      pd_args_t init_pd_args(res, get_test_engine(), prb, dir,
+                              hint, /* src_md = */ nullptr);
+                      DNN_SAFE(init_pd_func(init_pd_args), WARN);
+                      return fetch_impl(pdw, init_pd_args, res,
+                              /* is_service_prim = */ false);
+                  };
+        SAFE(measure_cold_start(create_pd, res), WARN);
+    }
+
     user_prim.reset(primw.release());
     return res->state = INITIALIZED, OK;
 }
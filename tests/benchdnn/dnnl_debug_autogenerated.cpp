@@ -45,6 +45,8 @@ dnnl_data_type_t str2dt(const char *str) {
     CASE(boolean);
     CASE(f8_e5m2);
     CASE(f8_e4m3);
+    CASE(s4);
+    CASE(u4);
     CASE(data_type_max);
 #undef CASE
     if (!strcmp("undef", str) || !strcmp("dnnl_data_type_undef", str))
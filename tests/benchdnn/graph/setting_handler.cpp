@@ -451,7 +451,7 @@ bool get_concat_sdt_and_ddt(const deserialized_op &base_op_ref,
     if (rewrite_lt_ids.find(base_op_ref.in_lts_.front().id_)
             != rewrite_lt_ids.end())
         dt = dnnl_f32;
-    op_setting.sdt.front() = dt;
+    op_setting.sdt.front() = {dt};
     op_setting.ddt.front() = dt;
     return true;
 }
@@ -90,6 +90,10 @@ static int prepare_fwd(const prb_t *prb, const dnn_mem_t &src,
 
     if (exact_bits / 2 == flex_bits) alg = ALG_2;
 
+    // For RMS normalization the statistic is the mean of squares and the
+    // mean itself is zero.
+    const bool skip_mean = prb->skip_mean();
+
     if ((alg == ALG_0 || alg == ALG_1) && !is_integral_dt(prb->dt[0])) {
         const int64_t flex_mask = (static_cast<int64_t>(1) << flex_bits) - 1;
 
@@ -104,6 +108,7 @@ static int prepare_fwd(const prb_t *prb, const dnn_mem_t &src,
 
         benchdnn_parallel_nd(prb->n, [&](int64_t n) {
             const float m = alg == ALG_0 ? 0.f : 0.25f * (1 << (n % 7));
+            const float sm = skip_mean ? 0.f : m; /* subtracted mean */
             float v = 0; /* current variance */
 
             float *s = (float *)src + n * prb->c;
@@ -121,9 +126,9 @@ static int prepare_fwd(const prb_t *prb, const dnn_mem_t &src,
 
                 src.set_elem(n * prb->c + c, alg == ALG_0 ? f : m * (1.f + f));
                 if (L % 2 && (c == L - 1)) { s[c] = m; }
-                v += (s[c] - m) * (s[c] - m);
+                v += (s[c] - sm) * (s[c] - sm);
             }
-            mean.set_elem(n, m);
+            mean.set_elem(n, sm);
             var.set_elem(n, v / prb->c);
         });
     } else {
@@ -144,6 +149,7 @@ static int prepare_fwd(const prb_t *prb, const dnn_mem_t &src,
             std::uniform_int_distribution<> int_dist(0 + distr_shift, 6);
             std::bernoulli_distribution b_dist(0.5f);
             const float m = val_coeff * 0.25f * (1 << int_dist(int_seed));
+            const float sm = skip_mean ? 0.f : m; /* subtracted mean */
             float v = 0; /* current variance */
 
             const int64_t c_shift = n * prb->c;
@@ -165,14 +171,15 @@ static int prepare_fwd(const prb_t *prb, const dnn_mem_t &src,
                 }
                 src.set_elem(idx, val);
 
-                v += (s[c] - m) * (s[c] - m);
+                v += (s[c] - sm) * (s[c] - sm);
             }
             // Update last element with s[c] = m.
             if (prb->c % 2 == 1) {
-                v -= (s[prb->c - 1] - m) * (s[prb->c - 1] - m);
+                v -= (s[prb->c - 1] - sm) * (s[prb->c - 1] - sm);
                 s[prb->c - 1] = m;
+                v += (m - sm) * (m - sm);
             }
-            mean.set_elem(n, m);
+            mean.set_elem(n, sm);
             var.set_elem(n, v / prb->c);
         });
     }
@@ -249,8 +256,9 @@ static int prepare_bwd(const prb_t *prb, const dnn_mem_t &src,
         std::uniform_int_distribution<> data_dist(0, 6);
         std::bernoulli_distribution half_dist(0.5f);
 
-        // mean = {-0.5f, 0.f, 0.5f}
-        const float m = 0.5f * (stat_dist(int_seed) - 1);
+        // mean = {-0.5f, 0.f, 0.5f}, always 0 for RMS normalization
+        const float m_gen = 0.5f * (stat_dist(int_seed) - 1);
+        const float m = prb->skip_mean() ? 0.f : m_gen;
         mean.set_elem(n, m);
 
         // final variance = {0.25f, 1.f, 4.f}
@@ -476,7 +484,10 @@ int init_ref_memory_args(dnn_mem_map_t &ref_mem_map, dnn_mem_map_t &mem_map,
         switch (exec_arg) {
             case DNNL_ARG_MEAN:
             case DNNL_ARG_VARIANCE:
-                if (prb->dir & FLAG_INF) {
+                // The library doesn't expose the mean for RMS normalization,
+                // but the reference still relies on it being zero.
+                if ((prb->dir & FLAG_INF)
+                        || (exec_arg == DNNL_ARG_MEAN && prb->skip_mean())) {
                     const auto &src_md = mem_map[DNNL_ARG_SRC].md_;
                     const auto stat_dims = query_md_dims(src_md);
                     ref_mem_map[exec_arg] = dnn_mem_t(prb->ndims - 1, stat_dims,
@@ -511,7 +522,7 @@ std::vector<data_kind_t> get_kinds_to_check(const prb_t *prb) {
     if (prb->dir & FLAG_FWD) {
         check_kinds = {DST};
         if (!(prb->flags & GLOB_STATS) && !(prb->dir & FLAG_INF)) {
-            check_kinds.push_back(MEAN);
+            if (!prb->skip_mean()) check_kinds.push_back(MEAN);
             check_kinds.push_back(VAR);
         }
     } else {
@@ -103,7 +103,8 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
                 float ds = d_dst.get_elem(off);
                 const float x = src.get_elem(off) - smean;
                 float gamma = use_sc ? sc.get_elem(c) : 1;
-                dd_gamma += gamma * ds;
+                // The mean is a constant for RMS normalization.
+                if (!prb->skip_mean()) dd_gamma += gamma * ds;
                 dd_gamma_x += gamma * ds * x;
             }
             dd_gamma_x *= rcp_denom;
@@ -33,6 +33,7 @@ static int check_flags() {
     SELF_CHECK_CASE_CPP_STR_EQ(flags2str(FUSE_NORM_RELU), "R");
     SELF_CHECK_CASE_CPP_STR_EQ(flags2str(GLOB_STATS | FUSE_NORM_RELU), "GR");
     SELF_CHECK_CASE_CPP_STR_EQ(flags2str(FUSE_NORM_ADD_RELU), "A");
+    SELF_CHECK_CASE_CPP_STR_EQ(flags2str(RMS_NORM), "M");
     SELF_CHECK_CASE_CPP_STR_EQ(
             flags2str(GLOB_STATS | FUSE_NORM_ADD_RELU), "GA");
 
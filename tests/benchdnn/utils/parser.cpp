@@ -557,14 +557,22 @@ bool parse_perf_template(const char *&pt, const char *pt_def,
         const std::string &option_name /* = "perf-template"*/) {
     static const std::string help
             = "TEMPLATE    (Default: `def`)\n    Specifies performance output "
-              "template for perf mode. `TEMPLATE` values can be `def`, `csv` "
-              "or customized set.\n    More details at "
+              "template for perf mode. `TEMPLATE` values can be `def`, `csv`, "
+              "`cold-start` or customized set.\n    More details at "
             + doc_url + "knobs_perf_report.md\n";
+    static const char *pt_cold_start
+            = "perf,%engine%,%impl%,%prb%,%cold-cpdtime%,%cold-cptime%,%cold-"
+              "jittime%,%warm-cpdtime%,%warm-cptime%,%pwarm-cpdtime%,%pwarm-"
+              "cptime%,%pwarm-jittime%,%fetime%,%-time%,%0time%";
     const auto str2pt = [&pt_def, &pt_csv](const char *str_) {
         const std::string csv_pattern = "csv";
         const std::string def_pattern = "def";
+        const std::string cold_start_pattern = "cold-start";
         if (csv_pattern.find(str_, 0, csv_pattern.size()) != eol)
             return pt_csv;
+        else if (cold_start_pattern.find(str_, 0, cold_start_pattern.size())
+                != eol)
+            return pt_cold_start;
         else if (def_pattern.find(str_, 0, def_pattern.size()) != eol)
             return pt_def;
         else
@@ -733,6 +741,20 @@ static bool parse_cold_cache(
             str2cold_cache_mode, str, option_name, help);
 }
 
+static bool parse_cold_start(
+        const char *str, const std::string &option_name = "cold-start") {
+    static const std::string help
+            = "BOOL    (Default: `false`)\n    Instructs the driver to measure "
+              "the creation and the first execution of primitives for "
+              "performance mode.\n    When set to `true`, primitives are "
+              "created with the primitive cache flushed, with the primitive "
+              "cache hit and with the persistent caches populated, and the "
+              "first execution is timed.\n    More details at "
+            + doc_url + "knobs_common.md\n";
+    return parse_single_value_option(
+            cold_start, false, str2bool, str, option_name, help);
+}
+
 static bool parse_cpu_isa_hints(
         const char *str, const std::string &option_name = "cpu-isa-hints") {
     static const std::string help
@@ -1127,7 +1149,8 @@ bool parse_bench_settings(const char *str) {
 
     bool parsed = parse_allow_enum_tags_only(str)
             || parse_attr_same_pd_check(str) || parse_canonical(str)
-            || parse_cold_cache(str) || parse_cpu_isa_hints(str)
+            || parse_cold_cache(str) || parse_cold_start(str)
+            || parse_cpu_isa_hints(str)
             || parse_engine(str) || parse_fast_ref_gpu(str)
             || parse_fix_times_per_prb(str) || parse_max_ms_per_prb(str)
             || parse_repeats_per_prb(str) || parse_mem_check(str)
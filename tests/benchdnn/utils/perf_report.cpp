@@ -92,6 +92,16 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
         return t.ms(create_mode) / unit;
     };
 
+    // Cold start timers are stamped once per problem.
+    auto get_cold_start_time = [&](const std::string &name) -> double {
+        return res->timer_map.get_timer(name).ms() / unit;
+    };
+
+    auto get_non_jit_time = [&](const std::string &cp_name,
+                                    const std::string &jit_name) -> double {
+        return get_cold_start_time(cp_name) - get_cold_start_time(jit_name);
+    };
+
     // Please update doc/knobs_perf_report.md in case of any new options!
 
 #define HANDLE(opt, ...) \
@@ -147,6 +157,35 @@ void base_perf_report_t::handle_option(std::ostream &s, const char *&option,
                             + get_create_time(res->timer_map.cpd_timer()));
     HANDLE("cptime", s << get_create_time(res->timer_map.cp_timer()));
     HANDLE("cpdtime", s << get_create_time(res->timer_map.cpd_timer()));
+    // Cold start options.
+    HANDLE("cold-cpdtime",
+            s << get_cold_start_time(timer::names::cold_cpd_timer));
+    HANDLE("cold-cptime",
+            s << get_cold_start_time(timer::names::cold_cp_timer));
+    HANDLE("cold-jittime",
+            s << get_cold_start_time(timer::names::cold_jit_timer));
+    HANDLE("cold-nonjittime",
+            s << get_non_jit_time(timer::names::cold_cp_timer,
+                    timer::names::cold_jit_timer));
+    HANDLE("warm-cpdtime",
+            s << get_cold_start_time(timer::names::warm_cpd_timer));
+    HANDLE("warm-cptime",
+            s << get_cold_start_time(timer::names::warm_cp_timer));
+    HANDLE("warm-jittime",
+            s << get_cold_start_time(timer::names::warm_jit_timer));
+    HANDLE("warm-nonjittime",
+            s << get_non_jit_time(timer::names::warm_cp_timer,
+                    timer::names::warm_jit_timer));
+    HANDLE("pwarm-cpdtime",
+            s << get_cold_start_time(timer::names::pwarm_cpd_timer));
+    HANDLE("pwarm-cptime",
+            s << get_cold_start_time(timer::names::pwarm_cp_timer));
+    HANDLE("pwarm-jittime",
+            s << get_cold_start_time(timer::names::pwarm_jit_timer));
+    HANDLE("pwarm-nonjittime",
+            s << get_non_jit_time(timer::names::pwarm_cp_timer,
+                    timer::names::pwarm_jit_timer));
+    HANDLE("fetime", s << get_cold_start_time(timer::names::first_exec_timer));
 
 #undef HANDLE
 
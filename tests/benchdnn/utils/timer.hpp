@@ -101,6 +101,21 @@ const std::string cp_timer = "create_prim_timer";
 const std::string compare_timer = "compare_timer";
 // Driver's memory filling.
 const std::string fill_timer = "fill_timer";
+// Cold start mode: creation of a primitive descriptor, a primitive and the JIT
+// code generation part of the latter in three scenarios - with the primitive
+// cache flushed (cold), with the primitive cache hit (warm) and with the
+// persistent caches populated but the primitive cache disabled (pwarm).
+const std::string cold_cpd_timer = "cold_create_pd_timer";
+const std::string cold_cp_timer = "cold_create_prim_timer";
+const std::string cold_jit_timer = "cold_create_jit_timer";
+const std::string warm_cpd_timer = "warm_create_pd_timer";
+const std::string warm_cp_timer = "warm_create_prim_timer";
+const std::string warm_jit_timer = "warm_create_jit_timer";
+const std::string pwarm_cpd_timer = "pwarm_create_pd_timer";
+const std::string pwarm_cp_timer = "pwarm_create_prim_timer";
+const std::string pwarm_jit_timer = "pwarm_create_jit_timer";
+// Cold start mode: the first execution of a problem.
+const std::string first_exec_timer = "first_exec_timer";
 } // namespace names
 
 struct timer_map_t {
@@ -0,0 +1,137 @@
+#===============================================================================
+# Copyright 2024 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#===============================================================================
+
+# Runs benchdnn with ONEDNN_VERBOSE_OUTPUT set and checks the verbose file.
+# Arguments:
+#   BENCHDNN -- path to the benchdnn executable
+#   FORMAT   -- value of ONEDNN_VERBOSE_OUTPUT_FORMAT: csv or binary
+#   OUTPUT   -- path to the verbose file
+
+if(NOT BENCHDNN OR NOT FORMAT OR NOT OUTPUT)
+    message(FATAL_ERROR "BENCHDNN, FORMAT and OUTPUT must be set")
+endif()
+
+file(REMOVE ${OUTPUT})
+execute_process(
+    COMMAND ${CMAKE_COMMAND} -E env
+        ONEDNN_VERBOSE=profile_exec
+        ONEDNN_VERBOSE_OUTPUT=${OUTPUT}
+        ONEDNN_VERBOSE_OUTPUT_FORMAT=${FORMAT}
+        ${BENCHDNN} --mode=C --eltwise --alg=relu 8x16x4x4
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE stdout
+    ERROR_VARIABLE stdout)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "benchdnn failed (${result}):\n${stdout}")
+endif()
+if(stdout MATCHES "onednn_verbose")
+    message(FATAL_ERROR "verbose messages printed to stdout:\n${stdout}")
+endif()
+if(NOT EXISTS ${OUTPUT})
+    message(FATAL_ERROR "${OUTPUT} was not created")
+endif()
+
+if(FORMAT STREQUAL "csv")
+    file(STRINGS ${OUTPUT} lines)
+    set(n_exec 0)
+    foreach(line ${lines})
+        if(NOT line MATCHES "^onednn_verbose,")
+            message(FATAL_ERROR "unexpected line in ${OUTPUT}: ${line}")
+        endif()
+        if(line MATCHES ",primitive,exec.*,cpu,eltwise,")
+            math(EXPR n_exec "${n_exec} + 1")
+        endif()
+    endforeach()
+elseif(FORMAT STREQUAL "binary")
+    # Converts @hex, a little-endian hexadecimal string, to a decimal number.
+    function(hex_to_dec hex var)
+        set(digits "0123456789abcdef")
+        string(LENGTH ${hex} len)
+        set(value 0)
+        set(pos ${len})
+        while(pos GREATER 0)
+            math(EXPR pos "${pos} - 2")
+            foreach(i 0 1)
+                math(EXPR idx "${pos} + ${i}")
+                string(SUBSTRING ${hex} ${idx} 1 digit)
+                string(FIND ${digits} ${digit} digit)
+                math(EXPR value "${value} * 16 + ${digit}")
+            endforeach()
+        endwhile()
+        set(${var} ${value} PARENT_SCOPE)
+    endfunction()
+
+    # "onednn_verbose," in hexadecimal.
+    set(prefix "6f6e65646e6e5f766572626f73652c")
+    string(LENGTH ${prefix} prefix_len)
+    # "primitive,exec" and ",cpu,eltwise," in hexadecimal.
+    set(exec_msg "7072696d69746976652c65786563")
+    set(eltwise_msg "2c6370752c656c74776973652c")
+    # The header is 16 bytes: the message size, the thread index and the time
+    # stamp. The machines running the test are little-endian.
+    set(hdr_len 32)
+
+    file(READ ${OUTPUT} data HEX)
+    string(LENGTH "${data}" data_len)
+    set(n_exec 0)
+    set(pos 0)
+    while(pos LESS data_len)
+        math(EXPR msg_pos "${pos} + ${hdr_len}")
+        if(msg_pos GREATER data_len)
+            message(FATAL_ERROR "truncated record header at ${pos}")
+        endif()
+        string(SUBSTRING ${data} ${pos} 8 size_hex)
+        hex_to_dec(${size_hex} size)
+        math(EXPR end "${msg_pos} + 2 * ${size}")
+        if(end GREATER data_len OR size LESS prefix_len)
+            message(FATAL_ERROR "bad record size ${size} at ${pos}")
+        endif()
+        math(EXPR len "2 * ${size}")
+        string(SUBSTRING ${data} ${msg_pos} ${len} msg)
+        string(FIND ${msg} ${prefix} idx)
+        if(NOT idx EQUAL 0)
+            message(FATAL_ERROR "bad record message at ${pos}")
+        endif()
+        string(FIND ${msg} "0a" idx)
+        # A new line may only be found across the byte boundaries.
+        while(NOT idx EQUAL -1)
+            math(EXPR odd "${idx} % 2")
+            if(odd EQUAL 0)
+                message(FATAL_ERROR "new line in the record message at ${pos}")
+            endif()
+            math(EXPR idx "${idx} + 1")
+            string(SUBSTRING ${msg} ${idx} -1 rest)
+            string(FIND ${rest} "0a" rest_idx)
+            if(rest_idx EQUAL -1)
+                set(idx -1)
+            else()
+                math(EXPR idx "${idx} + ${rest_idx}")
+            endif()
+        endwhile()
+        string(FIND ${msg} ${exec_msg} exec_idx)
+        string(FIND ${msg} ${eltwise_msg} eltwise_idx)
+        if(NOT exec_idx EQUAL -1 AND NOT eltwise_idx EQUAL -1)
+            math(EXPR n_exec "${n_exec} + 1")
+        endif()
+        set(pos ${end})
+    endwhile()
+else()
+    message(FATAL_ERROR "unknown FORMAT: ${FORMAT}")
+endif()
+
+if(n_exec EQUAL 0)
+    message(FATAL_ERROR "no eltwise execution message in ${OUTPUT}")
+endif()
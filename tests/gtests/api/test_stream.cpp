@@ -137,6 +137,84 @@ TEST(stream_test_c_t, GetStream) {
 }
 #endif
 
+#if defined(DNNL_EXPERIMENTAL_PROFILING) \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL \
+        && DNNL_CPU_RUNTIME != DNNL_RUNTIME_THREADPOOL
+TEST(stream_test_cpp_t, TestCpuProfilingAPI) {
+    engine eng(engine::kind::cpu, 0);
+    memory::dims dims = {2, 3, 4, 5};
+    memory::desc md(dims, memory::data_type::f32, memory::format_tag::nchw);
+
+    auto eltwise_pd = eltwise_forward::primitive_desc(
+            eng, prop_kind::forward, algorithm::eltwise_relu, md, md, 0.0f);
+    auto eltwise = eltwise_forward(eltwise_pd);
+    auto mem = memory(md, eng);
+
+    auto strm = dnnl::stream(eng, stream::flags::profiling);
+
+    // Reset profiler's state.
+    ASSERT_NO_THROW(reset_profiling(strm));
+
+    eltwise.execute(strm, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    eltwise.execute(strm, {{DNNL_ARG_SRC, mem}, {DNNL_ARG_DST, mem}});
+    strm.wait();
+
+    // Query profiling data.
+    std::vector<uint64_t> nsec, start, kind;
+    std::vector<std::string> names;
+    ASSERT_NO_THROW(
+            nsec = get_profiling_data(strm, profiling_data_kind::time));
+    ASSERT_NO_THROW(
+            start = get_profiling_data(strm, profiling_data_kind::start_time));
+    ASSERT_NO_THROW(kind = get_profiling_data(
+                            strm, profiling_data_kind::primitive_kind));
+    ASSERT_NO_THROW(names = get_profiling_impl_names(strm));
+    ASSERT_EQ(nsec.size(), 2u);
+    ASSERT_EQ(start.size(), 2u);
+    ASSERT_EQ(names.size(), 2u);
+    ASSERT_LE(start[0], start[1]);
+    for (size_t i = 0; i < kind.size(); i++) {
+        ASSERT_EQ(kind[i], (uint64_t)dnnl_eltwise);
+        ASSERT_EQ(names[i], std::string(eltwise_pd.impl_info_str()));
+    }
+
+    // Query into a smaller buffer: the data is truncated to the capacity
+    // and the number of available entries is returned.
+    int num_entries = 1;
+    uint64_t first_nsec = 0;
+    ASSERT_EQ(dnnl_query_profiling_data(strm.get(),
+                      dnnl_profiling_data_kind_time, &num_entries,
+                      &first_nsec),
+            dnnl_success);
+    ASSERT_EQ(num_entries, 2);
+    ASSERT_EQ(first_nsec, nsec[0]);
+
+    // Invalid arguments are rejected before anything is written.
+    num_entries = 1;
+    first_nsec = 0;
+    ASSERT_EQ(dnnl_query_profiling_data(strm.get(),
+                      dnnl_profiling_data_kind_undef, &num_entries,
+                      &first_nsec),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(num_entries, 1);
+    ASSERT_EQ(first_nsec, 0u);
+    num_entries = -1;
+    ASSERT_EQ(dnnl_query_profiling_data(strm.get(),
+                      dnnl_profiling_data_kind_time, &num_entries,
+                      &first_nsec),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(num_entries, -1);
+
+    // Reset profiler's state.
+    ASSERT_NO_THROW(reset_profiling(strm));
+    // Test that the profiler's state was reset.
+    ASSERT_NO_THROW(
+            nsec = get_profiling_data(strm, profiling_data_kind::time));
+    ASSERT_TRUE(nsec.empty());
+}
+#endif
+
 namespace {
 struct print_to_string_param_name_t {
     template <class ParamType>
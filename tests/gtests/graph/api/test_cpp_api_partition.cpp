@@ -308,6 +308,83 @@ TEST(APIPartition, CompileWildcardPartition) {
     EXPECT_THROW(part.compile({lt1}, {lt2}, eng), dnnl::error);
 }
 
+TEST(APIPartition, CompileFromCacheBlob) {
+    using namespace dnnl::graph;
+    dnnl::engine::kind engine_kind
+            = static_cast<dnnl::engine::kind>(api_test_engine_kind);
+    dnnl::engine eng = cpp_api_test_dnnl_engine_create(engine_kind);
+    std::vector<int64_t> data_dims {8, 16, 7, 7};
+    std::vector<int64_t> other_dims {8, 16, 5, 5};
+
+    logical_tensor lt1 {0, logical_tensor::data_type::f32, data_dims,
+            logical_tensor::layout_type::strided};
+    logical_tensor lt2 {1, logical_tensor::data_type::f32, data_dims,
+            logical_tensor::layout_type::strided};
+    logical_tensor lt1_other {0, logical_tensor::data_type::f32, other_dims,
+            logical_tensor::layout_type::strided};
+    logical_tensor lt2_other {1, logical_tensor::data_type::f32, other_dims,
+            logical_tensor::layout_type::strided};
+
+    op relu(0, op::kind::ReLU, "relu");
+    relu.add_input(lt1);
+    relu.add_output(lt2);
+
+    partition part {relu, engine_kind};
+    ASSERT_TRUE(part.is_supported());
+
+    compiled_partition cp = part.compile({lt1}, {lt2}, eng);
+
+    const bool is_ocl_gpu = eng.get_kind() == dnnl::engine::kind::gpu
+            && DNNL_GPU_RUNTIME == DNNL_RUNTIME_OCL;
+    if (!is_ocl_gpu) {
+        // Cache blobs are supported for the OpenCL runtime only.
+        try {
+            cp.get_cache_blob();
+            FAIL() << "cache blob is not expected to be supported";
+        } catch (const dnnl::error &e) {
+            ASSERT_EQ(e.status, dnnl_unimplemented);
+        }
+        EXPECT_THROW(
+                part.compile({lt1}, {lt2}, eng, {1, 2, 3}), dnnl::error);
+        return;
+    }
+
+    std::vector<uint8_t> cache_blob = cp.get_cache_blob();
+
+    // The cache blob holds the cache blob of the eltwise primitive the
+    // partition is implemented with.
+    dnnl::memory::desc md(data_dims, dnnl::memory::data_type::f32,
+            dnnl::memory::format_tag::nchw);
+    auto eltwise_pd = dnnl::eltwise_forward::primitive_desc(eng,
+            dnnl::prop_kind::forward_inference, dnnl::algorithm::eltwise_relu,
+            md, md, 0.f);
+    const auto eltwise_blob
+            = dnnl::eltwise_forward(eltwise_pd).get_cache_blob();
+    ASSERT_GT(cache_blob.size(), eltwise_blob.size());
+
+    // Flush the compiled partition cache, otherwise the compiled partition
+    // is taken from it and the cache blob is not used.
+    const int capacity = get_compiled_partition_cache_capacity();
+    set_compiled_partition_cache_capacity(0);
+    compiled_partition cp_from_blob
+            = part.compile({lt1}, {lt2}, eng, cache_blob);
+    set_compiled_partition_cache_capacity(capacity);
+    ASSERT_EQ(cp_from_blob.query_logical_tensor(1).get_dims(), data_dims);
+
+    // The cache blob is created for other logical tensors.
+    EXPECT_THROW(part.compile({lt1_other}, {lt2_other}, eng, cache_blob),
+            dnnl::error);
+
+    // Malformed cache blobs.
+    EXPECT_THROW(part.compile({lt1}, {lt2}, eng, {}), dnnl::error);
+    std::vector<uint8_t> truncated_blob(
+            cache_blob.begin(), cache_blob.end() - 1);
+    EXPECT_THROW(part.compile({lt1}, {lt2}, eng, truncated_blob), dnnl::error);
+    std::vector<uint8_t> corrupted_blob = cache_blob;
+    corrupted_blob[0] ^= 0xff;
+    EXPECT_THROW(part.compile({lt1}, {lt2}, eng, corrupted_blob), dnnl::error);
+}
+
 TEST(APIPartitionCache, GetSetCapacity) {
     ASSERT_EQ(dnnl_graph_set_compiled_partition_cache_capacity(-1),
             dnnl_invalid_arguments);
@@ -14,12 +14,21 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <functional>
 #include <random>
 
+#include "oneapi/dnnl/dnnl.hpp"
 #include "oneapi/dnnl/dnnl_graph.hpp"
 #include "gtest/gtest.h"
 
+#include "backend/dnnl/dnnl_constant_tensor_cache.hpp"
+#include "backend/dnnl/dnnl_partition_impl.hpp"
+#include "backend/dnnl/inter_op_executor.hpp"
+#include "backend/dnnl/kernels/dynamic_shape.hpp"
+#include "backend/dnnl/kernels/large_partition.hpp"
+#include "backend/dnnl/kernels/sdp.hpp"
+
 #include "graph/unit/backend/dnnl/dnnl_test_common.hpp"
 #include "graph/unit/unit_test_common.hpp"
 #include "graph/unit/utils.hpp"
@@ -44,6 +53,25 @@ static void fill_data(
     }
 }
 
+// Checks that a compiled sdp partition is executed by the fused sdpa
+// primitive, the jit one if the cpu supports it.
+static void check_fused_sdpa(const graph::compiled_partition_t &cp) {
+    const auto *cp_impl = dynamic_cast<
+            const graph::dnnl_impl::dnnl_compiled_partition_impl_t *>(
+            cp.get_pimpl());
+    ASSERT_NE(cp_impl, nullptr);
+    const auto sdp = std::dynamic_pointer_cast<graph::dnnl_impl::sdp_kernel_t>(
+            cp_impl->get_kernel());
+    ASSERT_NE(sdp, nullptr);
+    const std::string &impl_info = sdp->get_impl_info();
+    ASSERT_FALSE(impl_info.empty());
+#if DNNL_X64
+    if (dnnl::get_effective_cpu_isa() >= dnnl::cpu_isa::avx2) {
+        ASSERT_EQ(impl_info.find("brg:"), 0U);
+    }
+#endif
+}
+
 TEST(Execute, Int8Resnet50Stage2Block) {
     graph::engine_t *eng = get_engine();
     graph::stream_t *strm = get_stream();
@@ -329,6 +357,124 @@ TEST(Execute, F32Resnet50Stage2Block) {
                     /*atol*/ 1e-5f));
 }
 
+TEST(Execute, F32Resnet50Stage2BlockInterOp) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    utils::id_generator id_gen;
+    graph::graph_t g(eng->kind());
+    utils::construct_f32_resnet50_stage2_block(
+            &g, id_gen, 3, /* use biasadd */ true);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("f32_resnet50_stage_2_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile the partition with and without inter-op parallelism, the
+    // shortcut convolution of the first block is independent of the main
+    // branch
+    graph::partition_t p, p_inter_op;
+    p.init(part);
+    p_inter_op.init(part);
+    p_inter_op.set_inter_op_parallelism(true);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        // set output to be strided
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    graph::compiled_partition_t cp(p), cp_inter_op(p_inter_op);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+    ASSERT_EQ(p_inter_op.compile(&cp_inter_op, inputs, outputs, eng),
+            graph::status::success);
+
+    // the branches must be scheduled concurrently when the runtime allows it
+    const auto *cp_impl = dynamic_cast<
+            const graph::dnnl_impl::dnnl_compiled_partition_impl_t *>(
+            cp_inter_op.get_pimpl());
+    ASSERT_NE(cp_impl, nullptr);
+    const auto kernel = std::dynamic_pointer_cast<
+            graph::dnnl_impl::larger_partition_kernel_t>(
+            cp_impl->get_kernel());
+    ASSERT_NE(kernel, nullptr);
+    const auto &schedule = kernel->get_subgraph()->schedule_;
+    if (graph::dnnl_impl::is_inter_op_parallelism_supported(
+                graph::dnnl_impl::make_dnnl_engine(*eng))) {
+        ASSERT_FALSE(schedule.empty());
+    } else {
+        ASSERT_TRUE(schedule.empty());
+    }
+
+    std::vector<test_tensor> inputs_ts, outputs_ts, inter_op_outputs_ts;
+    for (auto &lt : inputs) {
+        inputs_ts.emplace_back(*lt, eng);
+        inputs_ts.back().fill<float>();
+    }
+
+    for (auto &lt : outputs) {
+        graph::logical_tensor_t compiled_output;
+        cp.query_logical_tensor(lt->id, &compiled_output);
+        outputs_ts.emplace_back(compiled_output, eng);
+        inter_op_outputs_ts.emplace_back(compiled_output, eng);
+    }
+
+    ASSERT_EQ(cp.execute(strm, test_tensor::to_graph_tensor(inputs_ts),
+                      test_tensor::to_graph_tensor(outputs_ts)),
+            graph::status::success);
+    // execute several iterations to check that concurrent ops don't corrupt
+    // each other's buffers
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(cp_inter_op.execute(strm,
+                          test_tensor::to_graph_tensor(inputs_ts),
+                          test_tensor::to_graph_tensor(inter_op_outputs_ts)),
+                graph::status::success);
+    }
+    strm->wait();
+
+    ASSERT_TRUE(allclose<float>(inter_op_outputs_ts[0], outputs_ts[0],
+            /*rtol*/ 1e-5f, /*atol*/ 1e-5f));
+
+#ifdef DNNL_EXPERIMENTAL_PROFILING
+    // the ops executed by the lanes are recorded on a profiling stream of the
+    // partition
+    if (eng->kind() != graph::engine_kind::cpu) return;
+    dnnl_stream_t prof_strm = nullptr;
+    ASSERT_EQ(dnnl_stream_create(&prof_strm, eng,
+                      static_cast<unsigned>(dnnl_stream_in_order)
+                              | static_cast<unsigned>(dnnl_stream_profiling)),
+            dnnl_success);
+    auto n_records = [&](const graph::compiled_partition_t &c) {
+        EXPECT_EQ(dnnl_reset_profiling(prof_strm), dnnl_success);
+        EXPECT_EQ(c.execute(prof_strm, test_tensor::to_graph_tensor(inputs_ts),
+                          test_tensor::to_graph_tensor(outputs_ts)),
+                graph::status::success);
+        EXPECT_EQ(dnnl_stream_wait(prof_strm), dnnl_success);
+        int n = 0;
+        EXPECT_EQ(dnnl_query_profiling_data(prof_strm,
+                          dnnl_profiling_data_kind_time, &n, nullptr),
+                dnnl_success);
+        return n;
+    };
+    const int n_expected = n_records(cp);
+    const int n_inter_op = n_records(cp_inter_op);
+    dnnl_stream_destroy(prof_strm);
+    ASSERT_GT(n_expected, 0);
+    ASSERT_EQ(n_inter_op, n_expected);
+#endif
+}
+
 TEST(Execute, ItexInt8Resnet50Stage2Block) {
     graph::engine_t *eng = get_engine();
     graph::stream_t *strm = get_stream();
@@ -584,6 +730,212 @@ TEST(Execute, F32Mha) {
     strm->wait();
 }
 
+TEST(Execute, F32MhaMaskedAccuracy) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    const int batch = 2, seq = 19, heads = 3, head_size = 20;
+    graph::graph_t g(eng->kind());
+    utils::construct_dnnl_float_MHA(
+            &g, graph::data_type::f32, batch, seq, heads, heads * head_size);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_sdp_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        // set output to be strided
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+    if (eng->kind() == graph::engine_kind::cpu) check_fused_sdpa(cp);
+
+    // The ids of the mask and the scale are defined by
+    // construct_dnnl_float_MHA().
+    const size_t mask_id = 0, scale_id = 4;
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<test_tensor> inputs_ts, outputs_ts, ref_outputs_ts;
+    for (auto &lt : inputs) {
+        using ltw = graph::logical_tensor_wrapper_t;
+        std::vector<float> data(utils::product(ltw(lt).vdims()));
+        if (lt->id == scale_id) {
+            data[0] = 4.f;
+        } else if (lt->id == mask_id) {
+            // mask the last keys of the second batch
+            for (int i = 0; i < batch * seq; ++i)
+                data[i] = i >= 2 * seq - 5 ? -1e9f : 0.f;
+        } else {
+            std::generate(data.begin(), data.end(),
+                    [&]() { return distribution(generator); });
+        }
+        inputs_ts.emplace_back(*lt, eng, data);
+    }
+
+    for (auto &lt : outputs) {
+        graph::logical_tensor_t compiled_output;
+        cp.query_logical_tensor(lt->id, &compiled_output);
+        outputs_ts.emplace_back(compiled_output, eng);
+        ref_outputs_ts.emplace_back(compiled_output, eng);
+    }
+
+    ASSERT_EQ(run_graph(g, inputs_ts, ref_outputs_ts, *eng, *strm),
+            graph::status::success);
+
+    ASSERT_EQ(cp.execute(strm, test_tensor::to_graph_tensor(inputs_ts),
+                      test_tensor::to_graph_tensor(outputs_ts)),
+            graph::status::success);
+    strm->wait();
+
+    ASSERT_TRUE(allclose<float>(outputs_ts[0], ref_outputs_ts[0],
+            /*rtol*/ 1e-4f, /*atol*/ 1e-5f));
+}
+
+// The constant tensors of an sdp partition count against the constant budget
+// of its shape buckets, including the ones of the fallback kernel.
+TEST(Execute, F32MhaDynamicShapeConstantSize) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    graph::graph_t g(eng->kind());
+    utils::construct_dnnl_float_MHA(&g, graph::data_type::f32, 1, 16, 2, 32);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_sdp_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = std::dynamic_pointer_cast<
+            graph::dnnl_impl::dnnl_partition_impl_t>(g.get_partitions()[0]);
+    ASSERT_NE(part, nullptr);
+
+    // flush the constant tensor cache and set its capacity as 1GB
+    auto *cache = graph::get_constant_tensor_cache(eng->kind(), eng->index());
+    ASSERT_NE(cache, nullptr);
+    cache->set_capacity(0);
+    cache->set_capacity(1024 * 1024 * 1024);
+
+    graph::dnnl_impl::dynamic_shape_kernel_t kernel(
+            part->get_kernel_creator(), 64, 1024 * 1024 * 1024);
+    std::vector<graph::logical_tensor_t> inputs = part->get_inputs();
+    std::vector<graph::logical_tensor_t> outputs;
+    for (const auto &lt : part->get_outputs())
+        outputs.emplace_back(utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided));
+    ASSERT_EQ(kernel.compile(part.get(), eng, inputs, outputs),
+            graph::status::success);
+
+    std::vector<test_tensor> inputs_ts, outputs_ts;
+    for (const auto &lt : inputs) {
+        inputs_ts.emplace_back(lt, eng);
+        inputs_ts.back().fill<float>();
+    }
+    for (const auto &lt : part->get_outputs()) {
+        auto out_lt = utils::logical_tensor_init(lt.id,
+                graph::logical_tensor_wrapper_t(lt).vdims(), lt.data_type);
+        outputs_ts.emplace_back(out_lt, eng);
+    }
+
+    ASSERT_EQ(kernel.execute(strm, test_tensor::to_graph_tensor(inputs_ts),
+                      test_tensor::to_graph_tensor(outputs_ts)),
+            graph::status::success);
+    strm->wait();
+    ASSERT_EQ(kernel.get_num_buckets(), 1U);
+    ASSERT_EQ(kernel.get_constant_size(), cache->get_size());
+
+    cache->set_capacity(0);
+}
+
+TEST(Execute, Int8MhaAccuracy) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    SKIP_IF(eng->kind() == graph::engine_kind::gpu,
+            "Skip for GPU - not supported yet.");
+
+    graph::graph_t g(eng->kind());
+    utils::construct_int8_MHA(&g, 2, 19, 3, 60);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("int8_sdp_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    // compile
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        // set output to be strided
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+    check_fused_sdpa(cp);
+
+    std::default_random_engine generator(7);
+    std::uniform_int_distribution<int> distribution(0, 16);
+    std::vector<test_tensor> inputs_ts, outputs_ts, ref_outputs_ts;
+    for (auto &lt : inputs) {
+        using ltw = graph::logical_tensor_wrapper_t;
+        const auto nelems = utils::product(ltw(lt).vdims());
+        if (lt->data_type == graph::data_type::u8) {
+            std::vector<uint8_t> data(nelems);
+            std::generate(data.begin(), data.end(), [&]() {
+                return static_cast<uint8_t>(distribution(generator));
+            });
+            inputs_ts.emplace_back(*lt, eng, data);
+        } else {
+            // the scale and the mask
+            inputs_ts.emplace_back(*lt, eng);
+            inputs_ts.back().fill<float>(nelems == 1 ? 8.f : 0.f);
+        }
+    }
+
+    for (auto &lt : outputs) {
+        graph::logical_tensor_t compiled_output;
+        cp.query_logical_tensor(lt->id, &compiled_output);
+        outputs_ts.emplace_back(compiled_output, eng);
+        ref_outputs_ts.emplace_back(compiled_output, eng);
+    }
+
+    ASSERT_EQ(run_graph(g, inputs_ts, ref_outputs_ts, *eng, *strm),
+            graph::status::success);
+
+    ASSERT_EQ(cp.execute(strm, test_tensor::to_graph_tensor(inputs_ts),
+                      test_tensor::to_graph_tensor(outputs_ts)),
+            graph::status::success);
+    strm->wait();
+
+    ASSERT_TRUE(allclose<uint8_t>(outputs_ts[0], ref_outputs_ts[0],
+            /*rtol*/ 0.01f, /*atol*/ 1.f));
+}
+
 namespace {
 union bit32_t {
     float f32;
@@ -26,6 +26,8 @@
 #include "graph/unit/utils.hpp"
 
 #include "backend/dnnl/dnnl_constant_tensor_cache.hpp"
+#include "backend/dnnl/dnnl_partition_impl.hpp"
+#include "backend/dnnl/kernels/dynamic_shape.hpp"
 
 namespace graph = dnnl::impl::graph;
 namespace utils = dnnl::graph::tests::unit::utils;
@@ -112,6 +114,183 @@ TEST(Execute, MatmulFp32) {
     }
 }
 
+TEST(Execute, MatmulDynamicShape) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    graph::op_t matmul_op(graph::op_kind::MatMul);
+
+    // the number of rows of src and dst is only known at execution
+    graph::logical_tensor_t src
+            = utils::logical_tensor_init(0, {-1, 4}, graph::data_type::f32);
+    graph::logical_tensor_t weight
+            = utils::logical_tensor_init(1, {4, 3}, graph::data_type::f32);
+    graph::logical_tensor_t dst
+            = utils::logical_tensor_init(2, {-1, 3}, graph::data_type::f32);
+
+    matmul_op.add_input(src);
+    matmul_op.add_input(weight);
+    matmul_op.add_output(dst);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&matmul_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("matmul_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+    graph::compiled_partition_t cp(p);
+
+    std::vector<const graph::logical_tensor_t *> inputs {&src, &weight};
+    std::vector<const graph::logical_tensor_t *> outputs {&dst};
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    const auto *cp_impl = dynamic_cast<
+            const graph::dnnl_impl::dnnl_compiled_partition_impl_t *>(
+            cp.get_pimpl());
+    ASSERT_NE(cp_impl, nullptr);
+    const auto kernel = std::dynamic_pointer_cast<
+            graph::dnnl_impl::dynamic_shape_kernel_t>(cp_impl->get_kernel());
+    ASSERT_NE(kernel, nullptr);
+    ASSERT_EQ(kernel->get_num_buckets(), 0U);
+
+    std::vector<float> weight_data(12);
+    for (size_t i = 0; i < weight_data.size(); ++i)
+        weight_data[i] = static_cast<float>(i % 5) - 2.f;
+
+    // the second execution with one row reuses the kernel of the first one,
+    // so it adds no bucket
+    const std::vector<size_t> n_buckets {1, 2, 2};
+    const std::vector<graph::dim_t> ms {1, 5, 1};
+    for (size_t iter = 0; iter < ms.size(); ++iter) {
+        const graph::dim_t m = ms[iter];
+        graph::logical_tensor_t src_m = utils::logical_tensor_init(
+                0, {m, 4}, graph::data_type::f32);
+        graph::logical_tensor_t dst_m = utils::logical_tensor_init(
+                2, {m, 3}, graph::data_type::f32);
+
+        std::vector<float> src_data(m * 4);
+        for (size_t i = 0; i < src_data.size(); ++i)
+            src_data[i] = static_cast<float>(i % 7) - 3.f;
+        std::vector<float> ref_dst_data(m * 3, 0.f);
+        for (graph::dim_t i = 0; i < m; ++i)
+            for (graph::dim_t j = 0; j < 3; ++j)
+                for (graph::dim_t k = 0; k < 4; ++k)
+                    ref_dst_data[i * 3 + j]
+                            += src_data[i * 4 + k] * weight_data[k * 3 + j];
+        std::vector<float> dst_data(ref_dst_data.size(), 0.f);
+
+        test_tensor src_ts(src_m, eng, src_data);
+        test_tensor weight_ts(weight, eng, weight_data);
+        test_tensor dst_ts(dst_m, eng, dst_data);
+
+        ASSERT_EQ(cp.execute(strm, {src_ts.get(), weight_ts.get()},
+                          {dst_ts.get()}),
+                graph::status::success);
+        strm->wait();
+        dst_data = dst_ts.as_vec_type<float>();
+        for (size_t i = 0; i < ref_dst_data.size(); ++i) {
+            ASSERT_FLOAT_EQ(dst_data[i], ref_dst_data[i]);
+        }
+        ASSERT_EQ(kernel->get_num_buckets(), n_buckets[iter]);
+    }
+}
+
+TEST(Execute, MatmulDynamicShapeConstantWeights) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    graph::op_t matmul_op(graph::op_kind::MatMul);
+
+    graph::logical_tensor_t src
+            = utils::logical_tensor_init(0, {-1, 64}, graph::data_type::f32);
+    graph::logical_tensor_t weight
+            = utils::logical_tensor_init(1, {64, 64}, graph::data_type::f32);
+    weight.property = graph::property_type::constant;
+    graph::logical_tensor_t dst
+            = utils::logical_tensor_init(2, {-1, 64}, graph::data_type::f32);
+
+    matmul_op.add_input(src);
+    matmul_op.add_input(weight);
+    matmul_op.add_output(dst);
+
+    graph::graph_t g(eng->kind());
+    g.add_op(&matmul_op);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("matmul_pass");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = std::dynamic_pointer_cast<
+            graph::dnnl_impl::dnnl_partition_impl_t>(g.get_partitions()[0]);
+    ASSERT_NE(part, nullptr);
+
+    // flush the constant tensor cache and set its capacity as 1GB
+    auto *cache = graph::get_constant_tensor_cache(eng->kind(), eng->index());
+    ASSERT_NE(cache, nullptr);
+    cache->set_capacity(0);
+    cache->set_capacity(1024 * 1024 * 1024);
+
+    // no constant memory is allowed, so only the last used bucket is kept
+    // when the weights are held in the constant cache
+    graph::dnnl_impl::dynamic_shape_kernel_t kernel(
+            part->get_kernel_creator(), 64, 0);
+    std::vector<graph::logical_tensor_t> inputs {src, weight};
+    std::vector<graph::logical_tensor_t> outputs {dst};
+    ASSERT_EQ(kernel.compile(part.get(), eng, inputs, outputs),
+            graph::status::success);
+
+    std::vector<float> weight_data(64 * 64);
+    for (size_t i = 0; i < weight_data.size(); ++i)
+        weight_data[i] = static_cast<float>(i % 5) - 2.f;
+
+    const std::vector<graph::dim_t> ms {1, 5, 1};
+    for (size_t iter = 0; iter < ms.size(); ++iter) {
+        const graph::dim_t m = ms[iter];
+        graph::logical_tensor_t src_m = utils::logical_tensor_init(
+                0, {m, 64}, graph::data_type::f32);
+        graph::logical_tensor_t dst_m = utils::logical_tensor_init(
+                2, {m, 64}, graph::data_type::f32);
+
+        std::vector<float> src_data(m * 64);
+        for (size_t i = 0; i < src_data.size(); ++i)
+            src_data[i] = static_cast<float>(i % 7) - 3.f;
+        std::vector<float> ref_dst_data(m * 64, 0.f);
+        for (graph::dim_t i = 0; i < m; ++i)
+            for (graph::dim_t j = 0; j < 64; ++j)
+                for (graph::dim_t k = 0; k < 64; ++k)
+                    ref_dst_data[i * 64 + j]
+                            += src_data[i * 64 + k] * weight_data[k * 64 + j];
+        std::vector<float> dst_data(ref_dst_data.size(), 0.f);
+
+        test_tensor src_ts(src_m, eng, src_data);
+        test_tensor weight_ts(weight, eng, weight_data);
+        test_tensor dst_ts(dst_m, eng, dst_data);
+
+        ASSERT_EQ(kernel.execute(strm, {src_ts.get(), weight_ts.get()},
+                          {dst_ts.get()}),
+                graph::status::success);
+        strm->wait();
+        dst_data = dst_ts.as_vec_type<float>();
+        for (size_t i = 0; i < ref_dst_data.size(); ++i) {
+            ASSERT_FLOAT_EQ(dst_data[i], ref_dst_data[i]);
+        }
+
+        // the constant tensors of the evicted buckets are removed from the
+        // cache, the buckets with the same weights layout share one copy
+        if (kernel.get_constant_size() > 0) {
+            ASSERT_EQ(kernel.get_num_buckets(), 1U);
+        }
+        ASSERT_EQ(kernel.get_constant_size(), cache->get_size());
+    }
+
+    cache->set_capacity(0);
+}
+
 TEST(Execute, MatmulF16F16F16) {
     graph::op_t matmul_op(graph::op_kind::MatMul);
 
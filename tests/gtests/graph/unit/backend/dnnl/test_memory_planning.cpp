@@ -37,3 +37,19 @@ TEST(MemoryPlanning, GetMemoryInfo) {
     graph::value_t val {op, 0, lt};
     ASSERT_NO_THROW(mp.get_memory_info(&val));
 }
+
+TEST(MemoryPlanning, BufferAssignerWaves) {
+    dnnl_impl::buffer_assigner_t assigner(16);
+    const size_t buf0 = assigner.request(64, 1);
+    assigner.release(buf0, 1);
+
+    // a buffer used by an op of wave 1 can't be shared with the other ops of
+    // the wave which may run concurrently
+    const size_t buf1 = assigner.request(64, 1);
+    ASSERT_NE(buf1, buf0);
+    ASSERT_EQ(assigner.request(32, 2), buf0);
+
+    // without a schedule the buffers are reused right after their release
+    assigner.release(buf1, 1);
+    ASSERT_EQ(assigner.request(64), buf1);
+}
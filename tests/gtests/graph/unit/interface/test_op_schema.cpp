@@ -5089,3 +5089,21 @@ TEST(OpSchema, InferPowOutputShape) {
 
     verify_single_in_identity_shape_infer(op_kind_);
 }
+
+TEST(OpSchema, RMSNorm) {
+    const op_kind_t op_kind_ = op_kind::RMSNorm;
+    const size_t expected_in_size = 2;
+    const size_t expected_out_size = 1;
+    const size_t expected_attr_size = 2;
+    const std::map<op_attr_t, bool> attrs_data
+            = {{op_attr::begin_norm_axis, false}, {op_attr::epsilon, false}};
+
+    verify_op_schema(op_kind_, expected_in_size, expected_out_size,
+            expected_attr_size, attrs_data);
+}
+
+TEST(OpSchema, InferRMSNormOutputShape) {
+    const op_kind_t op_kind_ = op_kind::RMSNorm;
+
+    verify_single_in_identity_shape_infer(op_kind_);
+}
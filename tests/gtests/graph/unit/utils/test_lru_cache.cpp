@@ -0,0 +1,118 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "common/cache_utils.hpp"
+
+// The unit tests are linked with the library objects, hence the header only
+// lru_cache_t that backs the primitive, kernel and compiled partition caches
+// can be instantiated with a trivial key here.
+namespace {
+
+struct test_key_t {
+    test_key_t(int id) : id_(id) {}
+    bool operator==(const test_key_t &other) const { return id_ == other.id_; }
+    bool has_runtime_dependencies() const { return false; }
+    std::thread::id thread_id() const { return thread_id_; }
+
+    int id_;
+    std::thread::id thread_id_ = std::this_thread::get_id();
+};
+
+struct test_value_t {
+    int id_;
+};
+
+struct test_result_t {
+    test_result_t() : status(dnnl::impl::status::success) {}
+    test_result_t(std::shared_ptr<test_value_t> v, dnnl::impl::status_t s)
+        : value(std::move(v)), status(s) {}
+    bool is_empty() const { return value == nullptr; }
+    test_value_t &get_value() const { return *value; }
+    std::shared_ptr<test_value_t> value;
+    dnnl::impl::status_t status;
+};
+
+} // namespace
+
+namespace std {
+template <>
+struct hash<test_key_t> {
+    size_t operator()(const test_key_t &key) const {
+        return std::hash<int>()(key.id_);
+    }
+};
+} // namespace std
+
+namespace {
+
+using test_cache_t = dnnl::impl::utils::lru_cache_t<test_key_t, test_value_t,
+        test_result_t>;
+
+test_result_t create_test_value(void *context) {
+    int id = *static_cast<int *>(context);
+    return {std::make_shared<test_value_t>(test_value_t {id}),
+            dnnl::impl::status::success};
+}
+
+void touch(test_cache_t &cache, int id) {
+    auto r = cache.get_or_create(test_key_t(id), create_test_value, &id);
+    ASSERT_EQ(r.status, dnnl::impl::status::success);
+    ASSERT_EQ(r.get_value().id_, id);
+}
+
+// Returns the average latency of a cache miss that evicts an entry from a
+// full cache of the given capacity, in nanoseconds.
+double miss_latency_ns(int capacity) {
+    test_cache_t cache(capacity);
+    for (int i = 0; i < capacity; i++)
+        touch(cache, i);
+    // Hit every other entry so that the least recently used entries are
+    // spread over the whole eviction queue.
+    for (int i = 0; i < capacity; i += 2)
+        touch(cache, i);
+
+    const int n_misses = 10000;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n_misses; i++)
+        touch(cache, capacity + i);
+    auto end = std::chrono::steady_clock::now();
+    EXPECT_EQ(cache.get_size(), capacity);
+
+    return std::chrono::duration<double, std::nano>(end - start).count()
+            / n_misses;
+}
+
+} // namespace
+
+// The miss path has O(1) complexity, therefore the latency should not grow
+// with the capacity. A linear scan over 100k entries is two orders of
+// magnitude slower than over 1k entries; the bound leaves room for the
+// cache misses of the larger hash table.
+TEST(lru_cache_test, MissLatency) {
+    double latency_1k = 0;
+    for (int capacity : {1000, 10000, 100000}) {
+        double ns = miss_latency_ns(capacity);
+        printf("capacity: %d, miss latency: %.1f ns\n", capacity, ns);
+        if (capacity == 1000) latency_1k = ns;
+        ASSERT_LT(ns, 20 * latency_1k);
+    }
+}
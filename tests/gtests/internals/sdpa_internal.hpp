@@ -0,0 +1,39 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GTESTS_INTERNALS_SDPA_INTERNAL_HPP
+#define GTESTS_INTERNALS_SDPA_INTERNAL_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "src/common/sdpa_types.hpp"
+
+/// Creates a primitive descriptor of the scaled dot-product attention, see
+/// sdpa_desc_t for the meaning of the arguments. `attn_mask_desc`,
+/// `scale_desc` and `kv_block_table_desc` may be NULL. With the block table
+/// the keys and the values are pools of pages and `kv_keys` is the number of
+/// keys.
+dnnl_status_t DNNL_API sdpa_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc_iface, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t q_desc, const_dnnl_memory_desc_t k_desc,
+        const_dnnl_memory_desc_t v_desc, const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t attn_mask_desc,
+        const_dnnl_memory_desc_t scale_desc, bool invert_scale,
+        dnnl::impl::attn_mask_type_t mask_type,
+        const_dnnl_memory_desc_t kv_block_table_desc, dnnl_dim_t kv_keys,
+        const_dnnl_primitive_attr_t attr);
+
+#endif
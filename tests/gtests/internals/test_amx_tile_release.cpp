@@ -0,0 +1,149 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <string>
+#include <thread>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "tests/test_isa_common.hpp"
+
+#include "cpu/x64/amx_tile_configure.hpp"
+
+namespace dnnl {
+
+namespace {
+using impl::cpu::x64::AMX_PALETTE_SIZE;
+
+struct palette_t {
+    char data[AMX_PALETTE_SIZE];
+};
+
+// A palette with a single 16 x 64 bytes tile.
+palette_t make_palette() {
+    palette_t p;
+    std::memset(p.data, 0, AMX_PALETTE_SIZE);
+    p.data[0] = 1; // palette id
+    p.data[16] = 64; // colsb of tile 0
+    p.data[48] = 16; // rows of tile 0
+    return p;
+}
+
+// Returns the tile configuration of the calling thread, all zeros if the
+// tiles are released.
+palette_t get_tile_config() {
+    palette_t p;
+    std::memset(p.data, 0xff, AMX_PALETTE_SIZE);
+    // sttilecfg [rdi], encoded for the assemblers without AMX support.
+    asm volatile(".byte 0xc4, 0xe2, 0x79, 0x49, 0x07"
+                 :
+                 : "D"(p.data)
+                 : "memory");
+    return p;
+}
+
+bool is_configured(const palette_t &expected) {
+    return std::memcmp(get_tile_config().data, expected.data, AMX_PALETTE_SIZE)
+            == 0;
+}
+
+bool is_released() {
+    const palette_t zeros {};
+    return std::memcmp(get_tile_config().data, zeros.data, AMX_PALETTE_SIZE)
+            == 0;
+}
+
+bool is_release_deferred() {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_OMP
+    const char *s = std::getenv("ONEDNN_AMX_DEFER_TILE_RELEASE");
+    return s == nullptr || std::string(s) != "0";
+#else
+    return false;
+#endif
+}
+} // namespace
+
+class amx_tile_release_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(!mayiuse(cpu_isa::avx512_core_amx),
+                "The test requires AMX support.");
+    }
+};
+
+TEST_F(amx_tile_release_test_t, TestDeferredRelease) {
+    using namespace impl::cpu::x64;
+    const palette_t palette = make_palette();
+
+    ASSERT_EQ(amx_tile_configure(palette.data), impl::status::success);
+    ASSERT_TRUE(is_configured(palette));
+
+    // By default the tiles stay configured until the deferred release.
+    ASSERT_EQ(amx_tile_maybe_release(), impl::status::success);
+    ASSERT_EQ(is_configured(palette), is_release_deferred());
+
+    ASSERT_EQ(amx_tile_release_deferred(), impl::status::success);
+    ASSERT_TRUE(is_released());
+    ASSERT_EQ(amx_tile_release_deferred(), impl::status::success);
+    ASSERT_TRUE(is_released());
+
+    // An explicit release clears the pending one.
+    ASSERT_EQ(amx_tile_lazy_configure(palette.data), impl::status::success);
+    ASSERT_TRUE(is_configured(palette));
+    ASSERT_EQ(amx_tile_maybe_release(), impl::status::success);
+    ASSERT_EQ(amx_tile_release(), impl::status::success);
+    ASSERT_TRUE(is_released());
+}
+
+// The deferred release of a thread does not drop the pending release of a
+// thread outside of its team.
+TEST_F(amx_tile_release_test_t, TestDeferredReleaseOtherThread) {
+    using namespace impl::cpu::x64;
+    const palette_t palette = make_palette();
+
+    std::promise<void> configured, released;
+    std::future<void> released_future = released.get_future();
+    bool other_configured = false, other_released = false;
+    std::thread other([&]() {
+        amx_tile_configure(palette.data);
+        amx_tile_maybe_release();
+        other_configured = is_configured(palette);
+        configured.set_value();
+
+        released_future.wait();
+        amx_tile_release_deferred();
+        other_released = is_released();
+    });
+
+    // The other thread must be joined before any assertion returns.
+    configured.get_future().wait();
+    EXPECT_EQ(amx_tile_configure(palette.data), impl::status::success);
+    EXPECT_EQ(amx_tile_maybe_release(), impl::status::success);
+    EXPECT_EQ(amx_tile_release_deferred(), impl::status::success);
+    EXPECT_TRUE(is_released());
+    released.set_value();
+    other.join();
+
+    ASSERT_EQ(other_configured, is_release_deferred());
+    ASSERT_TRUE(other_released);
+}
+
+} // namespace dnnl
@@ -0,0 +1,337 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "tests/test_isa_common.hpp"
+
+#include "sdpa_internal.hpp"
+
+namespace dnnl {
+
+using impl::attn_mask_type_t;
+namespace attn_mask_type = impl::attn_mask_type;
+
+namespace {
+memory::dim product(const memory::dims &dims) {
+    return std::accumulate(dims.begin(), dims.end(), (memory::dim)1,
+            std::multiplies<memory::dim>());
+}
+} // namespace
+
+struct sdpa_params_t {
+    memory::data_type dt;
+    memory::dim mb, q_heads, kv_heads, queries, keys, head_size, values;
+    attn_mask_type_t mask_type;
+    // The number of keys per page of paged KV, 0 for contiguous tensors.
+    memory::dim page_size;
+};
+
+class sdpa_test_t : public ::testing::TestWithParam<sdpa_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+                "SDPA requires cpu.");
+        Test();
+    }
+
+    // Fills a tensor of the data type of the test with random values and
+    // returns the values rounded to it.
+    std::vector<float> init_tensor(memory &mem, float lo, float hi) {
+        const auto &md = mem.get_desc();
+        const auto nelems = product(md.get_dims());
+        std::uniform_real_distribution<float> dist(lo, hi);
+        std::vector<float> data(nelems);
+        for (auto &v : data)
+            v = dist(gen_);
+
+        memory::desc f32_md(md.get_dims(), memory::data_type::f32,
+                memory::format_tag::abcd);
+        memory f32_mem(f32_md, eng_, data.data());
+        reorder(f32_mem, mem).execute(strm_, f32_mem, mem);
+        reorder(mem, f32_mem).execute(strm_, mem, f32_mem);
+        strm_.wait();
+        return data;
+    }
+
+    std::vector<float> to_f32(memory &mem) {
+        const auto &md = mem.get_desc();
+        std::vector<float> data(product(md.get_dims()));
+        memory::desc f32_md(md.get_dims(), memory::data_type::f32,
+                memory::format_tag::abcd);
+        memory f32_mem(f32_md, eng_, data.data());
+        reorder(mem, f32_mem).execute(strm_, mem, f32_mem);
+        strm_.wait();
+        return data;
+    }
+
+    void Test() {
+        const auto &p = GetParam();
+        eng_ = engine(engine::kind::cpu, 0);
+        strm_ = stream(eng_);
+
+        using tag = memory::format_tag;
+        const bool with_mask = p.mask_type == attn_mask_type::buffer;
+        // With paged KV the keys and the values are pools of the shuffled
+        // pages of all the sequences and of a spare page.
+        const bool paged = p.page_size > 0;
+        const memory::dim n_pages
+                = paged ? (p.keys + p.page_size - 1) / p.page_size : 0;
+        const memory::dim pool = p.mb * n_pages + 1;
+        const memory::dim kv_mb = paged ? pool : p.mb;
+        const memory::dim kv_len = paged ? p.page_size : p.keys;
+
+        memory::desc q_md(
+                {p.mb, p.q_heads, p.queries, p.head_size}, p.dt, tag::abcd);
+        // The keys are transposed.
+        memory::desc k_md(
+                {kv_mb, p.kv_heads, p.head_size, kv_len}, p.dt, tag::abdc);
+        memory::desc v_md(
+                {kv_mb, p.kv_heads, kv_len, p.values}, p.dt, tag::abcd);
+        memory::desc bt_md({p.mb, n_pages}, memory::data_type::s32, tag::ab);
+        memory::desc dst_md(
+                {p.mb, p.q_heads, p.queries, p.values}, p.dt, tag::abcd);
+        memory::desc mask_md({1, 1, p.queries, p.keys},
+                memory::data_type::f32, tag::abcd);
+
+        dnnl_primitive_desc_t c_pd = nullptr;
+        const auto st = sdpa_primitive_desc_create(&c_pd, eng_.get(),
+                q_md.get(), k_md.get(), v_md.get(), dst_md.get(),
+                with_mask ? mask_md.get() : nullptr, nullptr, false,
+                p.mask_type, paged ? bt_md.get() : nullptr, p.keys, nullptr);
+        SKIP_IF(st == dnnl_unimplemented, "SDPA is not supported.");
+        ASSERT_EQ(st, dnnl_success);
+        primitive_desc pd(c_pd);
+
+#if DNNL_X64
+        // The jit implementation is expected to be the first one.
+        if (mayiuse(cpu_isa::avx2)) {
+            ASSERT_EQ(std::string(pd.impl_info_str()).find("brg:"), 0U);
+        }
+#endif
+
+        memory q_mem(q_md, eng_), k_mem(k_md, eng_), v_mem(v_md, eng_);
+        const auto q = init_tensor(q_mem, -1.f, 1.f);
+        auto k = init_tensor(k_mem, -1.f, 1.f);
+        auto v = init_tensor(v_mem, -1.f, 1.f);
+        std::vector<int32_t> block_table(p.mb * n_pages);
+        memory bt_mem;
+        if (paged) {
+            std::iota(block_table.begin(), block_table.end(), 0);
+            std::shuffle(block_table.begin(), block_table.end(), gen_);
+            bt_mem = memory(bt_md, eng_, block_table.data());
+            k = gather_pages(p, k, block_table, true);
+            v = gather_pages(p, v, block_table, false);
+        }
+        std::vector<float> mask;
+        memory mask_mem;
+        if (with_mask) {
+            // A quarter of the scores is masked out, every seventh query
+            // attends to no keys.
+            std::uniform_real_distribution<float> dist(-1.f, 1.f);
+            mask.resize(p.queries * p.keys);
+            for (size_t i = 0; i < mask.size(); i++) {
+                const float m = dist(gen_);
+                const bool masked = m > 0.5f || (i / p.keys) % 7 == 3;
+                mask[i] = masked ? -INFINITY : m;
+            }
+            mask_mem = memory(mask_md, eng_, mask.data());
+        }
+
+        const auto ref = compute_ref(p, q, k, v, mask);
+        const float eps = p.dt == memory::data_type::f32 ? 1e-5f : 2e-2f;
+
+        int n_impls = 0;
+        do {
+            primitive prim(pd);
+            memory dst_mem(dst_md, eng_);
+            std::unordered_map<int, memory> args = {{DNNL_ARG_QUERIES, q_mem},
+                    {DNNL_ARG_KEYS, k_mem}, {DNNL_ARG_VALUES, v_mem},
+                    {DNNL_ARG_DST, dst_mem}};
+            if (with_mask) args.insert({DNNL_ARG_ATTN_MASK, mask_mem});
+            if (paged) args.insert({DNNL_ARG_KV_BLOCK_TABLE, bt_mem});
+            const auto scratchpad_md = pd.scratchpad_desc();
+            memory scratchpad(scratchpad_md, eng_);
+            args.insert({DNNL_ARG_SCRATCHPAD, scratchpad});
+            prim.execute(strm_, args);
+            strm_.wait();
+
+            const auto dst = to_f32(dst_mem);
+            for (size_t i = 0; i < dst.size(); i++)
+                ASSERT_NEAR(dst[i], ref[i], eps * (1.f + std::fabs(ref[i])))
+                        << pd.impl_info_str() << " at " << i;
+
+            if (paged) {
+                // A page out of the pool is rejected.
+                const int32_t page = block_table.back();
+                block_table.back() = (int32_t)pool;
+                dnnl_status_t status = dnnl_success;
+                try {
+                    prim.execute(strm_, args);
+                    strm_.wait();
+                } catch (const error &e) { status = e.status; }
+                block_table.back() = page;
+                ASSERT_EQ(status, dnnl_invalid_arguments)
+                        << pd.impl_info_str();
+            }
+            n_impls++;
+        } while (pd.next_impl());
+        ASSERT_GT(n_impls, 0);
+    }
+
+    // Gathers the keys (`is_k`) or the values of the sequences from the pool
+    // of pages into a contiguous tensor.
+    static std::vector<float> gather_pages(const sdpa_params_t &p,
+            const std::vector<float> &pool,
+            const std::vector<int32_t> &block_table, bool is_k) {
+        const auto ps = p.page_size;
+        const auto n_pages = (memory::dim)block_table.size() / p.mb;
+        const auto inner = is_k ? p.head_size : p.values;
+        std::vector<float> dst(p.mb * p.kv_heads * p.keys * inner);
+        for_(memory::dim mb = 0; mb < p.mb; mb++)
+        for_(memory::dim h = 0; h < p.kv_heads; h++)
+        for_(memory::dim j = 0; j < p.keys; j++)
+        for (memory::dim x = 0; x < inner; x++) {
+            const memory::dim page = block_table[mb * n_pages + j / ps];
+            const auto jp = j % ps;
+            if (is_k)
+                dst[((mb * p.kv_heads + h) * inner + x) * p.keys + j]
+                        = pool[((page * p.kv_heads + h) * inner + x) * ps + jp];
+            else
+                dst[((mb * p.kv_heads + h) * p.keys + j) * inner + x]
+                        = pool[((page * p.kv_heads + h) * ps + jp) * inner + x];
+        }
+        return dst;
+    }
+
+    static std::vector<float> compute_ref(const sdpa_params_t &p,
+            const std::vector<float> &q, const std::vector<float> &k,
+            const std::vector<float> &v, const std::vector<float> &mask) {
+        const float scale = 1.f / std::sqrt((float)p.head_size);
+        const auto q_per_kv = p.q_heads / p.kv_heads;
+        std::vector<float> dst(p.mb * p.q_heads * p.queries * p.values, 0.f);
+        std::vector<float> s(p.keys);
+        for_(memory::dim mb = 0; mb < p.mb; mb++)
+        for_(memory::dim h = 0; h < p.q_heads; h++)
+        for (memory::dim i = 0; i < p.queries; i++) {
+            const auto h_kv = h / q_per_kv;
+            const auto last_key = p.mask_type == attn_mask_type::top_left
+                    ? i
+                    : p.mask_type == attn_mask_type::bottom_right
+                    ? i + p.keys - p.queries
+                    : p.keys - 1;
+            float max = -INFINITY;
+            for (memory::dim j = 0; j < p.keys; j++) {
+                float acc = 0.f;
+                for (memory::dim d = 0; d < p.head_size; d++)
+                    acc += q[((mb * p.q_heads + h) * p.queries + i)
+                                         * p.head_size
+                                 + d]
+                            * k[((mb * p.kv_heads + h_kv) * p.head_size + d)
+                                            * p.keys
+                                    + j];
+                s[j] = acc * scale;
+                if (!mask.empty()) s[j] += mask[i * p.keys + j];
+                if (j > last_key) s[j] = -INFINITY;
+                max = std::max(max, s[j]);
+            }
+            // A query that attends to no keys produces zeros.
+            if (max == -INFINITY) continue;
+            float sum = 0.f;
+            for (memory::dim j = 0; j < p.keys; j++) {
+                s[j] = std::exp(s[j] - max);
+                sum += s[j];
+            }
+            for (memory::dim dv = 0; dv < p.values; dv++) {
+                float acc = 0.f;
+                for (memory::dim j = 0; j < p.keys; j++)
+                    acc += s[j]
+                            * v[((mb * p.kv_heads + h_kv) * p.keys + j)
+                                            * p.values
+                                    + dv];
+                dst[((mb * p.q_heads + h) * p.queries + i) * p.values + dv]
+                        = acc / sum;
+            }
+        }
+        return dst;
+    }
+
+private:
+    engine eng_;
+    stream strm_;
+    std::minstd_rand gen_;
+};
+
+TEST_P(sdpa_test_t, TestsSDPA) {}
+
+using dt = memory::data_type;
+
+INSTANTIATE_TEST_SUITE_P(TestSDPA, sdpa_test_t,
+        ::testing::Values(
+                sdpa_params_t {dt::f32, 2, 4, 4, 19, 37, 20, 24,
+                        attn_mask_type::undef, 0},
+                sdpa_params_t {dt::f32, 1, 2, 2, 33, 70, 16, 16,
+                        attn_mask_type::buffer, 0},
+                sdpa_params_t {dt::f32, 2, 3, 3, 5, 130, 8, 12,
+                        attn_mask_type::buffer, 0}));
+
+INSTANTIATE_TEST_SUITE_P(TestSDPACausal, sdpa_test_t,
+        ::testing::Values(
+                sdpa_params_t {dt::f32, 1, 3, 3, 40, 40, 32, 32,
+                        attn_mask_type::top_left, 0},
+                sdpa_params_t {dt::f32, 2, 2, 2, 7, 100, 8, 8,
+                        attn_mask_type::bottom_right, 0},
+                sdpa_params_t {dt::f32, 1, 2, 2, 70, 30, 16, 16,
+                        attn_mask_type::bottom_right, 0}));
+
+INSTANTIATE_TEST_SUITE_P(TestSDPAGroupedQueries, sdpa_test_t,
+        ::testing::Values(
+                sdpa_params_t {dt::f32, 2, 8, 2, 17, 65, 64, 32,
+                        attn_mask_type::undef, 0},
+                sdpa_params_t {dt::f32, 1, 6, 3, 33, 33, 16, 16,
+                        attn_mask_type::top_left, 0}));
+
+INSTANTIATE_TEST_SUITE_P(TestSDPALowPrecision, sdpa_test_t,
+        ::testing::Values(
+                sdpa_params_t {dt::bf16, 2, 4, 2, 33, 80, 32, 32,
+                        attn_mask_type::top_left, 0},
+                sdpa_params_t {dt::bf16, 1, 2, 2, 5, 9, 7, 5,
+                        attn_mask_type::buffer, 0},
+                sdpa_params_t {dt::f16, 2, 4, 2, 33, 80, 32, 32,
+                        attn_mask_type::bottom_right, 0},
+                sdpa_params_t {dt::f16, 1, 2, 1, 19, 19, 12, 20,
+                        attn_mask_type::undef, 0}));
+
+INSTANTIATE_TEST_SUITE_P(TestSDPAPagedKV, sdpa_test_t,
+        ::testing::Values(
+                sdpa_params_t {dt::f32, 3, 4, 2, 1, 150, 32, 32,
+                        attn_mask_type::undef, 16},
+                sdpa_params_t {dt::f32, 2, 2, 2, 9, 45, 20, 12,
+                        attn_mask_type::bottom_right, 7},
+                sdpa_params_t {dt::bf16, 2, 4, 4, 17, 64, 16, 16,
+                        attn_mask_type::buffer, 32}));
+
+} // namespace dnnl
@@ -0,0 +1,108 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+// The tracer reads ONEDNN_TRACE_FILE once, hence the test is built as a
+// separate binary.
+
+namespace dnnl {
+
+namespace {
+
+std::string read_file(const std::string &path) {
+    std::ifstream f(path);
+    std::stringstream ss;
+    ss << f.rdbuf();
+    return ss.str();
+}
+
+void run_relu() {
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+    memory::desc md({2, 16}, memory::data_type::f32, memory::format_tag::ab);
+    memory src(md, eng), dst(md, eng);
+    eltwise_forward::primitive_desc pd(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f);
+    eltwise_forward(pd).execute(
+            strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+}
+
+bool has_relu_event(const std::string &trace) {
+    return trace.find("\"traceEvents\":[") != std::string::npos
+            && trace.find("{\"name\":\"eltwise\",\"cat\":\"primitive\"")
+            != std::string::npos;
+}
+
+} // namespace
+
+TEST(trace_test, TestTraceFileAtExit) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Trace test requires cpu.");
+#if defined(DNNL_ENABLE_TRACE) && !defined(_WIN32)
+    // The file is written at exit, the primitive is run by a child process.
+    const std::string path = "test_trace_at_exit.json";
+    std::remove(path.c_str());
+    const pid_t pid = fork();
+    ASSERT_NE(pid, -1);
+    if (pid == 0) {
+        if (::setenv("ONEDNN_TRACE_FILE", path.c_str(), 1) != 0) _exit(1);
+        run_relu();
+        std::exit(0);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    EXPECT_TRUE(has_relu_event(read_file(path)));
+    std::remove(path.c_str());
+#endif
+}
+
+TEST(trace_test, TestDumpTrace) {
+    SKIP_IF(engine::get_count(engine::kind::cpu) == 0,
+            "Trace test requires cpu.");
+    const std::string path = "test_trace_dump.json";
+    std::remove(path.c_str());
+#if defined(DNNL_ENABLE_TRACE) && !defined(_WIN32)
+    ASSERT_EQ(::setenv("ONEDNN_TRACE_FILE", path.c_str(), 1), 0);
+    run_relu();
+
+    ASSERT_EQ(dnnl_dump_trace(path.c_str()), dnnl_success);
+    EXPECT_TRUE(has_relu_event(read_file(path)));
+    EXPECT_EQ(dnnl_dump_trace(nullptr), dnnl_invalid_arguments);
+    EXPECT_EQ(dnnl_dump_trace(""), dnnl_invalid_arguments);
+    // The file is written again at exit.
+#elif !defined(DNNL_ENABLE_TRACE)
+    EXPECT_EQ(dnnl_dump_trace(path.c_str()), dnnl_unimplemented);
+#endif
+}
+
+} // namespace dnnl
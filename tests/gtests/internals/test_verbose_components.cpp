@@ -0,0 +1,48 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "tests/gtests/dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "common/verbose.hpp"
+
+namespace dnnl {
+
+using impl::component_t;
+using impl::prim_kind2_comp_kind;
+namespace prim_kind = impl::primitive_kind;
+
+TEST(verbose_components_test, TestPrimitiveKinds) {
+    ASSERT_EQ(prim_kind2_comp_kind(prim_kind::convolution),
+            component_t::convolution | component_t::primitive);
+    ASSERT_EQ(prim_kind2_comp_kind(prim_kind::group_normalization),
+            component_t::group_normalization | component_t::primitive);
+    ASSERT_EQ(prim_kind2_comp_kind(prim_kind::topk),
+            component_t::topk | component_t::primitive);
+    ASSERT_EQ(prim_kind2_comp_kind(prim_kind::embedding_bag),
+            component_t::embedding_bag | component_t::primitive);
+}
+
+// The internal primitive kinds are out of the range of the component flags.
+TEST(verbose_components_test, TestInternalPrimitiveKinds) {
+    ASSERT_EQ(prim_kind2_comp_kind(prim_kind::sdpa),
+            component_t::sdpa | component_t::primitive);
+    ASSERT_EQ(prim_kind2_comp_kind(prim_kind::zero_pad), component_t::primitive);
+    ASSERT_EQ(prim_kind2_comp_kind(prim_kind::undefined),
+            component_t::primitive);
+}
+
+} // namespace dnnl
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+namespace {
+constexpr size_t page_2m = 2 * 1024 * 1024;
+
+size_t last_alignment = 0;
+
+void *test_allocate(size_t size, size_t alignment) {
+    last_alignment = alignment;
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    void *ptr;
+    return ::posix_memalign(&ptr, alignment, size) == 0 ? ptr : nullptr;
+#endif
+}
+
+void test_deallocate(void *ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    ::free(ptr);
+#endif
+}
+} // namespace
+
+class cpu_hugepages_test_t : public ::testing::Test {
+protected:
+    void TearDown() override { set_cpu_hugepages(0); }
+};
+
+HANDLE_EXCEPTIONS_FOR_TEST(cpu_hugepages_test_t, TestLargeBuffers) {
+    SKIP_IF(is_sycl_engine(engine::kind::cpu),
+            "Huge pages are not supported for SYCL engines.");
+
+    ASSERT_EQ(set_cpu_hugepages(1), status::success);
+
+    engine eng(engine::kind::cpu, 0);
+    stream strm(eng);
+
+    // A buffer of two huge pages and a bit.
+    const memory::dim nelems = 2 * page_2m / sizeof(float) + 17;
+    memory::desc md({nelems}, memory::data_type::f32, memory::format_tag::a);
+    memory src(md, eng), dst(md, eng);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(src.get_data_handle()) % page_2m,
+            0u);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(dst.get_data_handle()) % page_2m,
+            0u);
+
+    // The first touch of the library must not interfere with the data.
+    auto *s = static_cast<float *>(src.get_data_handle());
+    for (memory::dim i = 0; i < nelems; ++i)
+        s[i] = static_cast<float>(i % 7) - 3.f;
+    eltwise_forward::primitive_desc pd(eng, prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, md, 0.f);
+    eltwise_forward(pd).execute(
+            strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    strm.wait();
+    const auto *d = static_cast<const float *>(dst.get_data_handle());
+    for (memory::dim i = 0; i < nelems; ++i)
+        ASSERT_EQ(d[i], std::max(s[i], 0.f));
+
+    // Engines with a user allocator keep control of the placement.
+    engine user_eng(engine::kind::cpu, 0, test_allocate, test_deallocate);
+    memory user_mem(md, user_eng);
+    ASSERT_LT(last_alignment, page_2m);
+
+    ASSERT_EQ(set_cpu_hugepages(0), status::success);
+}
+
+} // namespace dnnl
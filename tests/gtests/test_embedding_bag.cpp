@@ -0,0 +1,203 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct embedding_bag_test_params_t {
+    algorithm aalgorithm;
+    memory::data_type src_dt;
+    memory::dim n_rows;
+    memory::dim emb_dim;
+    // Sizes of the bags.
+    std::vector<memory::dim> bags;
+    // Scales and zero points with one value per table row.
+    bool with_qparams;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class embedding_bag_test_t
+    : public ::testing::TestWithParam<embedding_bag_test_params_t> {
+private:
+    embedding_bag_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<embedding_bag_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+        SKIP_IF(unsupported_data_type(p.src_dt),
+                "Engine does not support this data type.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using pd_t = embedding_bag::primitive_desc;
+        using dt = memory::data_type;
+        using tag = memory::format_tag;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const memory::dim n_bags = (memory::dim)p.bags.size();
+        std::vector<int32_t> offsets, indices;
+        for (memory::dim b = 0; b < n_bags; ++b) {
+            offsets.push_back((int32_t)indices.size());
+            for (memory::dim i = 0; i < p.bags[b]; ++i)
+                indices.push_back((int32_t)((b * 7 + i * 13) % p.n_rows));
+        }
+        const memory::dim n_indices = (memory::dim)indices.size();
+
+        auto desc_src = memory::desc({p.n_rows, p.emb_dim}, p.src_dt, tag::ab);
+        auto desc_idx = memory::desc({n_indices}, dt::s32, tag::a);
+        auto desc_off = memory::desc({n_bags}, dt::s32, tag::a);
+        auto desc_dst = memory::desc({n_bags, p.emb_dim}, dt::f32, tag::any);
+
+        primitive_attr attr;
+        if (p.with_qparams) {
+            attr.set_scales_mask(DNNL_ARG_SRC, 1);
+            attr.set_zero_points_mask(DNNL_ARG_SRC, 1);
+        }
+
+        auto pd = pd_t(eng, p.aalgorithm, desc_src, desc_idx, desc_off,
+                desc_dst, attr);
+        auto prim = embedding_bag(pd);
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_INDICES)
+                == pd.indices_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_OFFSETS)
+                == pd.offsets_desc());
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+
+        auto mem_src = test::make_memory(pd.src_desc(), eng);
+        auto mem_idx = test::make_memory(pd.indices_desc(), eng);
+        auto mem_off = test::make_memory(pd.offsets_desc(), eng);
+        auto mem_dst = test::make_memory(pd.dst_desc(), eng);
+        auto mem_scales = test::make_memory(
+                memory::desc({p.n_rows}, dt::f32, tag::a), eng);
+        auto mem_zero_points = test::make_memory(
+                memory::desc({p.n_rows}, dt::s32, tag::a), eng);
+
+        const memory::dim nelems = p.n_rows * p.emb_dim;
+        std::vector<float> table(nelems);
+        std::vector<float> scales(p.n_rows, 1.f);
+        std::vector<int32_t> zero_points(p.n_rows, 0);
+        for (memory::dim r = 0; r < p.n_rows; ++r) {
+            if (p.with_qparams) {
+                scales[r] = 0.25f * (1 + r % 3);
+                zero_points[r] = (int32_t)(r % 5) - 2;
+            }
+            for (memory::dim d = 0; d < p.emb_dim; ++d)
+                table[r * p.emb_dim + d]
+                        = (float)((r * 31 + d * 17) % 23) - 11.f;
+        }
+        {
+            if (p.src_dt == dt::f32) {
+                auto ptr = map_memory<float>(mem_src);
+                std::copy(table.begin(), table.end(), &ptr[0]);
+            } else {
+                auto ptr = map_memory<int8_t>(mem_src);
+                for (memory::dim i = 0; i < nelems; ++i)
+                    ptr[i] = (int8_t)table[i];
+            }
+            auto idx = map_memory<int32_t>(mem_idx);
+            std::copy(indices.begin(), indices.end(), &idx[0]);
+            auto off = map_memory<int32_t>(mem_off);
+            std::copy(offsets.begin(), offsets.end(), &off[0]);
+            auto sc = map_memory<float>(mem_scales);
+            std::copy(scales.begin(), scales.end(), &sc[0]);
+            auto zp = map_memory<int32_t>(mem_zero_points);
+            std::copy(zero_points.begin(), zero_points.end(), &zp[0]);
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, mem_src},
+                {DNNL_ARG_SRC_INDICES, mem_idx},
+                {DNNL_ARG_SRC_OFFSETS, mem_off}, {DNNL_ARG_DST, mem_dst}};
+        if (p.with_qparams) {
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, mem_scales});
+            args.insert({DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_SRC,
+                    mem_zero_points});
+        }
+        prim.execute(strm, args);
+        strm.wait();
+
+        auto dst = map_memory<float>(mem_dst);
+        for (memory::dim b = 0; b < n_bags; ++b)
+            for (memory::dim d = 0; d < p.emb_dim; ++d) {
+                float ref = 0.f;
+                for (memory::dim i = 0; i < p.bags[b]; ++i) {
+                    const int32_t r = indices[offsets[b] + i];
+                    const float v = (table[r * p.emb_dim + d] - zero_points[r])
+                            * scales[r];
+                    if (p.aalgorithm == algorithm::reduction_max)
+                        ref = i == 0 ? v : std::max(ref, v);
+                    else
+                        ref += v;
+                }
+                if (p.aalgorithm == algorithm::reduction_mean && p.bags[b])
+                    ref /= p.bags[b];
+                ASSERT_NEAR(dst[b * p.emb_dim + d], ref,
+                        1e-5f * (1.f + std::abs(ref)));
+            }
+    }
+};
+
+using dt = memory::data_type;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // not supported alg_kind
+            embedding_bag_test_params_t {algorithm::reduction_mul, dt::f32,
+                    10, 4, {2, 3}, false, true, dnnl_invalid_arguments},
+            // scales are only supported for integer tables
+            embedding_bag_test_params_t {algorithm::reduction_sum, dt::f32,
+                    10, 4, {2, 3}, true, true, dnnl_unimplemented});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            embedding_bag_test_params_t {algorithm::reduction_sum, dt::f32,
+                    100, 16, {1, 5, 0, 20}},
+            embedding_bag_test_params_t {algorithm::reduction_mean, dt::f32,
+                    100, 33, {3, 0, 12, 7, 1}},
+            embedding_bag_test_params_t {algorithm::reduction_max, dt::f32,
+                    50, 64, {4, 4, 0, 9}},
+            embedding_bag_test_params_t {algorithm::reduction_sum, dt::s8,
+                    100, 24, {2, 30, 0, 5}, true},
+            embedding_bag_test_params_t {algorithm::reduction_max, dt::s8,
+                    70, 13, {6, 1, 11}, true});
+};
+
+TEST_P(embedding_bag_test_t, TestsEmbeddingBag) {}
+INSTANTIATE_TEST_SUITE_P(
+        TestEmbeddingBagEF, embedding_bag_test_t, expected_failures());
+INSTANTIATE_TEST_SUITE_P(
+        TestEmbeddingBagSimple, embedding_bag_test_t, simple_cases());
+
+} // namespace dnnl
@@ -0,0 +1,113 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <atomic>
+#include <cstdlib>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+namespace {
+std::atomic<int> n_allocs {0};
+std::atomic<int> n_frees {0};
+std::atomic<size_t> last_alloc_size {0};
+
+void *test_allocate(size_t size, size_t alignment) {
+    n_allocs++;
+    last_alloc_size = size;
+#ifdef _WIN32
+    return _aligned_malloc(size, alignment);
+#else
+    void *ptr;
+    return ::posix_memalign(&ptr, alignment, size) == 0 ? ptr : nullptr;
+#endif
+}
+
+void test_deallocate(void *ptr) {
+    n_frees++;
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    ::free(ptr);
+#endif
+}
+} // namespace
+
+class engine_allocator_test_t : public ::testing::Test {};
+
+HANDLE_EXCEPTIONS_FOR_TEST(engine_allocator_test_t, TestInvalidArguments) {
+    dnnl_engine_t eng;
+    ASSERT_EQ(dnnl_engine_create_with_allocator(
+                      &eng, dnnl_cpu, 0, nullptr, test_deallocate),
+            dnnl_invalid_arguments);
+    ASSERT_EQ(dnnl_engine_create_with_allocator(
+                      &eng, dnnl_cpu, 0, test_allocate, nullptr),
+            dnnl_invalid_arguments);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(engine_allocator_test_t, TestMemoryAndScratchpad) {
+    SKIP_IF(is_sycl_engine(engine::kind::cpu),
+            "User-provided allocator is not supported for SYCL engines.");
+
+    n_allocs = 0;
+    n_frees = 0;
+    {
+        engine eng(engine::kind::cpu, 0, test_allocate, test_deallocate);
+        stream strm(eng);
+
+        const memory::dims dims = {2, 32, 7, 7};
+        memory::desc src_md(
+                dims, memory::data_type::f32, memory::format_tag::nchw);
+        memory::desc dst_md(
+                dims, memory::data_type::s8, memory::format_tag::nhwc);
+
+        memory src(src_md, eng);
+        ASSERT_EQ(n_allocs, 1);
+        ASSERT_EQ(last_alloc_size, src_md.get_size());
+        memory dst(dst_md, eng);
+        ASSERT_EQ(n_allocs, 2);
+        ASSERT_EQ(last_alloc_size, dst_md.get_size());
+
+        // A sum with different layouts and an integer destination accumulates
+        // in a library-managed scratchpad, which is allocated once at the
+        // primitive creation.
+        auto sum_pd = sum::primitive_desc(
+                eng, dst_md, {1.f, 2.f, 3.f}, {src_md, src_md, src_md});
+        const size_t scratchpad_size = sum_pd.scratchpad_desc().get_size();
+        ASSERT_GT(scratchpad_size, 0u);
+        ASSERT_EQ(n_allocs, 2);
+
+        sum sum_prim(sum_pd);
+        ASSERT_EQ(n_allocs, 3);
+        ASSERT_EQ(last_alloc_size, scratchpad_size);
+
+        sum_prim.execute(strm,
+                {{DNNL_ARG_MULTIPLE_SRC, src},
+                        {DNNL_ARG_MULTIPLE_SRC + 1, src},
+                        {DNNL_ARG_MULTIPLE_SRC + 2, src},
+                        {DNNL_ARG_DST, dst}});
+        strm.wait();
+        ASSERT_EQ(n_allocs, 3);
+    }
+    ASSERT_EQ(n_allocs, 3);
+    ASSERT_EQ(n_allocs, n_frees);
+}
+
+} // namespace dnnl
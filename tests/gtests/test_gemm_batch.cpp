@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct gemm_batch_test_params_t {
+    char transa;
+    char transb;
+    dnnl_dim_t M, N, K;
+    dnnl_dim_t batch;
+};
+
+// Batched GEMMs must produce the same results as a sequence of regular GEMM
+// calls on the same matrices.
+class gemm_batch_test_t
+    : public ::testing::TestWithParam<gemm_batch_test_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Batched GEMM is supported on CPU only.");
+        const auto &p = GetParam();
+        const bool tr_a = p.transa == 'T';
+        const bool tr_b = p.transb == 'T';
+        lda_ = tr_a ? p.M : p.K;
+        ldb_ = tr_b ? p.K : p.N;
+        ldc_ = p.N;
+        // Padded strides check that the matrices are addressed separately.
+        stride_a_ = p.M * p.K + 3;
+        stride_b_ = p.K * p.N + 5;
+        stride_c_ = p.M * p.N + 7;
+        Test();
+    }
+
+    template <typename data_t>
+    static void fill(std::vector<data_t> &v, int seed) {
+        for (size_t i = 0; i < v.size(); ++i)
+            v[i] = (data_t)((i * 13 + seed) % 7) - 3;
+    }
+
+    void Test() {
+        const auto &p = GetParam();
+        std::vector<float> a(p.batch * stride_a_), b(p.batch * stride_b_);
+        std::vector<float> c(p.batch * stride_c_), c_ref;
+        fill(a, 1);
+        fill(b, 2);
+        fill(c, 3);
+        c_ref = c;
+
+        const float alpha = 2.f, beta = 0.5f;
+        for (dnnl_dim_t i = 0; i < p.batch; ++i)
+            ASSERT_EQ(sgemm(p.transa, p.transb, p.M, p.N, p.K, alpha,
+                              a.data() + i * stride_a_, lda_,
+                              b.data() + i * stride_b_, ldb_, beta,
+                              c_ref.data() + i * stride_c_, ldc_),
+                    status::success);
+
+        std::vector<float> c_strided = c;
+        ASSERT_EQ(sgemm_batch_strided(p.transa, p.transb, p.M, p.N, p.K, alpha,
+                          a.data(), lda_, stride_a_, b.data(), ldb_, stride_b_,
+                          beta, c_strided.data(), ldc_, stride_c_, p.batch),
+                status::success);
+
+        std::vector<const float *> a_ptrs(p.batch), b_ptrs(p.batch);
+        std::vector<float *> c_ptrs(p.batch);
+        std::vector<float> c_array = c;
+        for (dnnl_dim_t i = 0; i < p.batch; ++i) {
+            a_ptrs[i] = a.data() + i * stride_a_;
+            b_ptrs[i] = b.data() + i * stride_b_;
+            c_ptrs[i] = c_array.data() + i * stride_c_;
+        }
+        ASSERT_EQ(sgemm_batch(p.transa, p.transb, p.M, p.N, p.K, alpha,
+                          a_ptrs.data(), lda_, b_ptrs.data(), ldb_, beta,
+                          c_ptrs.data(), ldc_, p.batch),
+                status::success);
+
+        // The inputs are small integers, so the results are exact.
+        for (size_t i = 0; i < c.size(); ++i) {
+            ASSERT_EQ(c_strided[i], c_ref[i]) << "index " << i;
+            ASSERT_EQ(c_array[i], c_ref[i]) << "index " << i;
+        }
+
+        std::vector<uint8_t> a_u8(p.batch * stride_a_);
+        std::vector<int8_t> b_s8(p.batch * stride_b_);
+        std::vector<int32_t> c_s32(p.batch * stride_c_), c_s32_ref;
+        for (size_t i = 0; i < a_u8.size(); ++i)
+            a_u8[i] = (uint8_t)((i * 7) % 11);
+        fill(b_s8, 4);
+        fill(c_s32, 5);
+        c_s32_ref = c_s32;
+        const int32_t co = 1;
+        for (dnnl_dim_t i = 0; i < p.batch; ++i)
+            ASSERT_EQ(gemm_u8s8s32(p.transa, p.transb, 'F', p.M, p.N, p.K, 1.f,
+                              a_u8.data() + i * stride_a_, lda_, 2,
+                              b_s8.data() + i * stride_b_, ldb_, -1, 1.f,
+                              c_s32_ref.data() + i * stride_c_, ldc_, &co),
+                    status::success);
+        ASSERT_EQ(gemm_u8s8s32_batch_strided(p.transa, p.transb, 'F', p.M, p.N,
+                          p.K, 1.f, a_u8.data(), lda_, stride_a_, 2,
+                          b_s8.data(), ldb_, stride_b_, -1, 1.f, c_s32.data(),
+                          ldc_, stride_c_, &co, p.batch),
+                status::success);
+        for (size_t i = 0; i < c_s32.size(); ++i)
+            ASSERT_EQ(c_s32[i], c_s32_ref[i]) << "index " << i;
+    }
+
+    dnnl_dim_t lda_, ldb_, ldc_;
+    dnnl_dim_t stride_a_, stride_b_, stride_c_;
+};
+
+TEST_P(gemm_batch_test_t, TestsGemmBatch) {}
+
+INSTANTIATE_TEST_SUITE_P(TestGemmBatch, gemm_batch_test_t,
+        ::testing::Values(gemm_batch_test_params_t {'N', 'N', 4, 5, 6, 1},
+                gemm_batch_test_params_t {'N', 'N', 16, 16, 16, 64},
+                gemm_batch_test_params_t {'T', 'N', 7, 33, 9, 3},
+                gemm_batch_test_params_t {'N', 'T', 64, 40, 8, 5},
+                gemm_batch_test_params_t {'T', 'T', 3, 2, 50, 200},
+                gemm_batch_test_params_t {'N', 'N', 128, 96, 32, 2}));
+
+} // namespace dnnl
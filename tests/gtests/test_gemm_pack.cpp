@@ -0,0 +1,155 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct gemm_pack_test_params_t {
+    char identifier;
+    char transa;
+    char transb;
+    dnnl_dim_t M, N, K;
+};
+
+// GEMM with a packed matrix must produce the same results as a regular GEMM
+// on the same matrices.
+class gemm_pack_test_t
+    : public ::testing::TestWithParam<gemm_pack_test_params_t> {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Packed GEMM is supported on CPU only.");
+        const auto &p = GetParam();
+        lda_ = p.transa == 'T' ? p.M : p.K;
+        ldb_ = p.transb == 'T' ? p.K : p.N;
+        ldc_ = p.N;
+        size_t size = 0;
+        const auto st = sgemm_pack_get_size(p.identifier, p.transa, p.transb,
+                p.M, p.N, p.K, lda_, ldb_, &size);
+        SKIP_IF(st == status::unimplemented,
+                "Packed GEMM is not supported on the system.");
+        ASSERT_EQ(st, status::success);
+        Test();
+    }
+
+    template <typename data_t>
+    static void fill(std::vector<data_t> &v, int seed) {
+        for (size_t i = 0; i < v.size(); ++i)
+            v[i] = (data_t)((i * 13 + seed) % 7) - 3;
+    }
+
+    // Packs one of @p a and @p b into @p packed and returns the arguments and
+    // transposition flags to pass to the compute function.
+    template <typename a_t, typename b_t, typename get_size_t, typename pack_t>
+    void pack(const std::vector<a_t> &a, const std::vector<b_t> &b,
+            std::vector<char> &packed, const void *&a_arg, const void *&b_arg,
+            char &transa, char &transb, const get_size_t &get_size,
+            const pack_t &pack_f) {
+        const auto &p = GetParam();
+        const bool pack_a = p.identifier == 'A';
+        size_t size = 0;
+        ASSERT_EQ(get_size(p.identifier, p.transa, p.transb, p.M, p.N, p.K,
+                          lda_, ldb_, &size),
+                status::success);
+        packed.resize(size);
+        ASSERT_EQ(pack_f(p.identifier, p.transa, p.transb, p.M, p.N, p.K,
+                          lda_, ldb_,
+                          pack_a ? (const void *)a.data()
+                                 : (const void *)b.data(),
+                          packed.data()),
+                status::success);
+        a_arg = pack_a ? (const void *)packed.data() : a.data();
+        b_arg = pack_a ? (const void *)b.data() : packed.data();
+        transa = pack_a ? 'P' : p.transa;
+        transb = pack_a ? p.transb : 'P';
+    }
+
+    void Test() {
+        const auto &p = GetParam();
+        std::vector<float> a(p.M * p.K), b(p.K * p.N), c(p.M * p.N), c_ref;
+        fill(a, 1);
+        fill(b, 2);
+        fill(c, 3);
+        c_ref = c;
+
+        const float beta = 0.5f;
+        ASSERT_EQ(sgemm(p.transa, p.transb, p.M, p.N, p.K, 1.f, a.data(),
+                          lda_, b.data(), ldb_, beta, c_ref.data(), ldc_),
+                status::success);
+
+        std::vector<char> packed;
+        const void *a_arg = nullptr, *b_arg = nullptr;
+        char transa = 0, transb = 0;
+        pack(a, b, packed, a_arg, b_arg, transa, transb, sgemm_pack_get_size,
+                [](char id, char ta, char tb, dnnl_dim_t M, dnnl_dim_t N,
+                        dnnl_dim_t K, dnnl_dim_t lda, dnnl_dim_t ldb,
+                        const void *src, void *dst) {
+                    return sgemm_pack(id, ta, tb, M, N, K, lda, ldb,
+                            (const float *)src, dst);
+                });
+        // The packed matrix is reused across several calls.
+        for (int i = 0; i < 2; ++i) {
+            std::vector<float> c_packed = c;
+            ASSERT_EQ(sgemm_compute(transa, transb, p.M, p.N, p.K, a_arg,
+                              lda_, b_arg, ldb_, beta, c_packed.data(), ldc_),
+                    status::success);
+            // The inputs are small integers, so the results are exact.
+            for (size_t j = 0; j < c.size(); ++j)
+                ASSERT_EQ(c_packed[j], c_ref[j]) << "index " << j;
+        }
+
+        std::vector<uint8_t> a_u8(p.M * p.K);
+        std::vector<int8_t> b_s8(p.K * p.N);
+        std::vector<int32_t> c_s32(p.M * p.N), c_s32_ref;
+        for (size_t i = 0; i < a_u8.size(); ++i)
+            a_u8[i] = (uint8_t)((i * 7) % 11);
+        fill(b_s8, 4);
+        fill(c_s32, 5);
+        c_s32_ref = c_s32;
+        const int32_t co = 1;
+        ASSERT_EQ(gemm_u8s8s32(p.transa, p.transb, 'F', p.M, p.N, p.K, 1.f,
+                          a_u8.data(), lda_, 0, b_s8.data(), ldb_, 0, 1.f,
+                          c_s32_ref.data(), ldc_, &co),
+                status::success);
+        pack(a_u8, b_s8, packed, a_arg, b_arg, transa, transb,
+                gemm_u8s8s32_pack_get_size, gemm_u8s8s32_pack);
+        ASSERT_EQ(gemm_u8s8s32_compute(transa, transb, 'F', p.M, p.N, p.K,
+                          a_arg, lda_, b_arg, ldb_, 1.f, c_s32.data(), ldc_,
+                          &co),
+                status::success);
+        for (size_t i = 0; i < c_s32.size(); ++i)
+            ASSERT_EQ(c_s32[i], c_s32_ref[i]) << "index " << i;
+    }
+
+    dnnl_dim_t lda_, ldb_, ldc_;
+};
+
+TEST_P(gemm_pack_test_t, TestsGemmPack) {}
+
+INSTANTIATE_TEST_SUITE_P(TestGemmPack, gemm_pack_test_t,
+        ::testing::Values(gemm_pack_test_params_t {'A', 'N', 'N', 4, 5, 6},
+                gemm_pack_test_params_t {'B', 'N', 'N', 4, 5, 6},
+                gemm_pack_test_params_t {'A', 'T', 'N', 33, 17, 65},
+                gemm_pack_test_params_t {'B', 'N', 'T', 64, 40, 128},
+                gemm_pack_test_params_t {'B', 'T', 'T', 100, 300, 20}));
+
+} // namespace dnnl
@@ -116,6 +116,111 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+// The eviction order is only defined within a shard.
+TEST(primitive_cache_test, TestEvictionOrder) {
+    if (get_primitive_cache_shards() != 1) return;
+
+    engine eng(get_test_engine_kind(), 0);
+    auto make_relu = [&](int i) {
+        auto md = memory::desc(
+                {i, 1, 1, 1}, memory::data_type::f32, memory::format_tag::nchw);
+        return eltwise_forward(eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f, 0.f));
+    };
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+    std::vector<eltwise_forward> p;
+    for (int i = 1; i <= 4; i++)
+        p.push_back(make_relu(i));
+    // Primitives 1 and 3 become the most recently used ones.
+    make_relu(1);
+    make_relu(3);
+    p.push_back(make_relu(5));
+    p.push_back(make_relu(6));
+
+    ASSERT_EQ(get_primitive_cache_size(), 4);
+    ASSERT_TRUE(impl::is_primitive_in_cache(p[0].get()));
+    ASSERT_FALSE(impl::is_primitive_in_cache(p[1].get()));
+    ASSERT_TRUE(impl::is_primitive_in_cache(p[2].get()));
+    ASSERT_FALSE(impl::is_primitive_in_cache(p[3].get()));
+    ASSERT_TRUE(impl::is_primitive_in_cache(p[4].get()));
+    ASSERT_TRUE(impl::is_primitive_in_cache(p[5].get()));
+
+    // Shrinking the capacity keeps the most recently used primitives.
+    make_relu(1);
+    set_primitive_cache_capacity(2);
+    ASSERT_EQ(get_primitive_cache_size(), 2);
+    ASSERT_TRUE(impl::is_primitive_in_cache(p[0].get()));
+    ASSERT_TRUE(impl::is_primitive_in_cache(p[5].get()));
+}
+
+// Hits in the reverse order of insertion make the oldest entry the most
+// recently used one.
+TEST(primitive_cache_test, TestEvictionOrderAfterHits) {
+    if (get_primitive_cache_shards() != 1) return;
+
+    engine eng(get_test_engine_kind(), 0);
+    auto make_relu = [&](int i) {
+        auto md = memory::desc(
+                {i, 1, 1, 1}, memory::data_type::f32, memory::format_tag::nchw);
+        return eltwise_forward(eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f, 0.f));
+    };
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(2);
+    auto a = make_relu(1);
+    auto b = make_relu(2);
+    make_relu(2);
+    make_relu(1);
+    auto c = make_relu(3);
+
+    ASSERT_EQ(get_primitive_cache_size(), 2);
+    ASSERT_TRUE(impl::is_primitive_in_cache(a.get()));
+    ASSERT_FALSE(impl::is_primitive_in_cache(b.get()));
+    ASSERT_TRUE(impl::is_primitive_in_cache(c.get()));
+}
+
+TEST(primitive_cache_test, TestStats) {
+    const int nshards = get_primitive_cache_shards();
+    ASSERT_GE(nshards, 1);
+    EXPECT_ANY_THROW(get_primitive_cache_stats(-1));
+    EXPECT_ANY_THROW(get_primitive_cache_stats(nshards));
+
+    auto sum_stats = [&]() {
+        primitive_cache_stats_t total {};
+        for (int i = 0; i < nshards; i++) {
+            auto s = get_primitive_cache_stats(i);
+            total.hits += s.hits;
+            total.misses += s.misses;
+            total.evictions += s.evictions;
+        }
+        return total;
+    };
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(2);
+    auto before = sum_stats();
+    fill_primitive_cache(1);
+    fill_primitive_cache(1);
+    auto after = sum_stats();
+
+    ASSERT_GE(after.misses - before.misses, 1u);
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_SYCL
+    if (get_test_engine_kind() == engine::kind::cpu) {
+        ASSERT_GE(after.hits - before.hits, 1u);
+    }
+#endif
+
+    before = sum_stats();
+    set_primitive_cache_capacity(0);
+    after = sum_stats();
+    ASSERT_GE(after.evictions - before.evictions, 1u);
+}
 #endif
 
 } // namespace dnnl
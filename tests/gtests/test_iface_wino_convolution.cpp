@@ -49,7 +49,13 @@ protected:
         input_int8.dat_dt = data_type::u8;
         input_int8.wei_dt = data_type::s8;
 
-#if DNNL_X64 || DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
+#if DNNL_X64 && DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+        const bool is_gpu = get_test_engine_kind() == engine::kind::gpu;
+        const bool is_cpu_f32_supported
+                = !is_gpu && dnnl::mayiuse(cpu_isa::avx512_core);
+        input_f32.wino_supported = is_gpu || is_cpu_f32_supported;
+        input_f16.wino_supported = is_gpu;
+#elif DNNL_CPU_RUNTIME == DNNL_RUNTIME_NONE
         const bool is_gpu = get_test_engine_kind() == engine::kind::gpu;
         input_f32.wino_supported = is_gpu;
         input_f16.wino_supported = is_gpu;
@@ -103,6 +103,14 @@ protected:
         Forward(inference, flags::use_global_stats);
         Forward(inference, flags::use_scale | flags::use_shift);
 
+        // RMS normalization is implemented on CPU only.
+        const bool test_rms = get_test_engine_kind() == engine::kind::cpu;
+        if (test_rms) {
+            Forward(training, flags::rms_norm);
+            Forward(training, flags::rms_norm | flags::use_global_stats);
+            Forward(inference, flags::rms_norm | flags::use_scale);
+        }
+
         if (!impl::utils::one_of(p.dst_dt, memory::data_type::f16,
                     memory::data_type::s8, memory::data_type::u8)) {
             diff_src_md = std::make_shared<memory::desc>(
@@ -116,6 +124,11 @@ protected:
             Backward(prop_kind::backward,
                     flags::use_scale | flags::use_shift
                             | flags::use_global_stats);
+            if (test_rms) {
+                Backward(prop_kind::backward_data, flags::rms_norm);
+                Backward(prop_kind::backward,
+                        flags::rms_norm | flags::use_scale);
+            }
         }
     }
 
@@ -310,13 +323,18 @@ protected:
         memory::dims stat_dims(p.dims.begin(), p.dims.end() - 1);
         memory::desc expect_stat_md(
                 stat_dims, memory::data_type::f32, expect_stat_tag);
+        // RMS normalization has no mean.
+        const memory::desc expect_mean_md
+                = (bool)(flags & normalization_flags::rms_norm)
+                ? memory::desc()
+                : expect_stat_md;
 
         // no stat_md provided at all
         {
             layer_normalization_forward::primitive_desc fwd_pd(
                     eng, pk, *src_md, *dst_md, epsilon, flags);
 
-            EXPECT_EQ(fwd_pd.mean_desc(), expect_stat_md);
+            EXPECT_EQ(fwd_pd.mean_desc(), expect_mean_md);
             EXPECT_EQ(fwd_pd.variance_desc(), expect_stat_md);
         }
 
@@ -327,7 +345,7 @@ protected:
             layer_normalization_forward::primitive_desc fwd_pd(
                     eng, pk, *src_md, *dst_md, any_stat_md, epsilon, flags);
 
-            EXPECT_EQ(fwd_pd.mean_desc(), expect_stat_md);
+            EXPECT_EQ(fwd_pd.mean_desc(), expect_mean_md);
             EXPECT_EQ(fwd_pd.variance_desc(), expect_stat_md);
         }
     }
@@ -341,6 +359,11 @@ protected:
         memory::dims stat_dims(p.dims.begin(), p.dims.end() - 1);
         memory::desc expect_stat_md(
                 stat_dims, memory::data_type::f32, expect_stat_tag);
+        // RMS normalization has no mean.
+        const memory::desc expect_mean_md
+                = (bool)(flags & normalization_flags::rms_norm)
+                ? memory::desc()
+                : expect_stat_md;
 
         layer_normalization_forward::primitive_desc fwd_pd(eng,
                 prop_kind::forward_training, *src_md, *dst_md, epsilon, flags);
@@ -353,7 +376,7 @@ protected:
                     *diff_src_md, *dst_md, *src_md, any_stat_md, epsilon, flags,
                     fwd_pd);
 
-            EXPECT_EQ(bwd_pd.mean_desc(), expect_stat_md);
+            EXPECT_EQ(bwd_pd.mean_desc(), expect_mean_md);
             EXPECT_EQ(bwd_pd.variance_desc(), expect_stat_md);
         }
     }
@@ -19,6 +19,7 @@
 
 #include "oneapi/dnnl/dnnl.hpp"
 
+#include <cmath>
 #include <vector>
 
 namespace dnnl {
@@ -683,4 +684,113 @@ INSTANTIATE_TEST_SUITE_P(TensorDims, attr_test_t,
                         memory::dims {2, 10, 10, 10}, tag::abcd,
                         memory::data_type::f16, 4)));
 
+class matmul_wei_decompression_test_t : public ::testing::Test {
+protected:
+    engine eng = get_test_engine();
+
+    // Computes dst = src * ((wei - zp) * scale) with per-group weights
+    // quantization parameters and compares it with the library result.
+    void check(memory::data_type wei_dt, memory::data_type zp_dt) {
+        const memory::dim M = 4, K = 64, N = 48, G = 16;
+        const bool is_4bit
+                = wei_dt == data_type::s4 || wei_dt == data_type::u4;
+        const int wei_mask = (1 << 0) | (1 << 1);
+
+        memory::desc src_md({M, K}, data_type::f32, tag::ab);
+        memory::desc wei_md({K, N}, wei_dt, tag::ab);
+        memory::desc dst_md({M, N}, data_type::f32, tag::ab);
+        memory::desc scales_md({K / G, N}, data_type::f32, tag::ab);
+        memory::desc zp_md({K / G, N}, zp_dt, tag::ab);
+
+        primitive_attr attr;
+        attr.set_scales(DNNL_ARG_WEIGHTS, wei_mask, {G, 1});
+        attr.set_zero_points(DNNL_ARG_WEIGHTS, wei_mask, {G, 1}, zp_dt);
+
+        matmul::primitive_desc pd(eng, src_md, wei_md, dst_md, attr);
+
+        memory src_m(src_md, eng), wei_m(wei_md, eng), dst_m(dst_md, eng);
+        memory scales_m(scales_md, eng), zp_m(zp_md, eng);
+
+        std::vector<float> src(M * K), scales(K / G * N), wei_f(K * N);
+        std::vector<int> wei(K * N), zp(K / G * N);
+        for (memory::dim i = 0; i < M * K; i++)
+            src[i] = (float)((i * 7) % 13 - 6) / 4.f;
+        for (memory::dim i = 0; i < K * N; i++)
+            wei[i] = is_4bit ? (int)((i * 5) % 16) - 8 : (int)(i % 31) - 15;
+        for (memory::dim i = 0; i < K / G * N; i++) {
+            scales[i] = 0.25f * (float)(1 + i % 3);
+            zp[i] = (int)(i % 5) - (zp_dt == data_type::u8 ? 0 : 2);
+        }
+        if (wei_dt == data_type::u4 || wei_dt == data_type::u8)
+            for (auto &w : wei)
+                w += is_4bit ? 8 : 15;
+
+        {
+            auto src_ptr = map_memory<float>(src_m);
+            for (memory::dim i = 0; i < M * K; i++)
+                src_ptr[i] = src[i];
+            auto scales_ptr = map_memory<float>(scales_m);
+            for (memory::dim i = 0; i < K / G * N; i++)
+                scales_ptr[i] = scales[i];
+            if (zp_dt == data_type::s32) {
+                auto zp_ptr = map_memory<int32_t>(zp_m);
+                for (memory::dim i = 0; i < K / G * N; i++)
+                    zp_ptr[i] = zp[i];
+            } else {
+                auto zp_ptr = map_memory<uint8_t>(zp_m);
+                for (memory::dim i = 0; i < K / G * N; i++)
+                    zp_ptr[i] = (uint8_t)zp[i];
+            }
+            auto wei_ptr = map_memory<uint8_t>(wei_m);
+            for (memory::dim i = 0; i < K * N; i++) {
+                if (!is_4bit) {
+                    wei_ptr[i] = (uint8_t)wei[i];
+                    continue;
+                }
+                uint8_t &byte = wei_ptr[i / 2];
+                const uint8_t nibble = (uint8_t)wei[i] & 0xf;
+                byte = i % 2 ? (byte & 0x0f) | (nibble << 4)
+                             : (byte & 0xf0) | nibble;
+            }
+        }
+        for (memory::dim k = 0; k < K; k++)
+            for (memory::dim n = 0; n < N; n++) {
+                const memory::dim g = (k / G) * N + n;
+                wei_f[k * N + n] = (wei[k * N + n] - zp[g]) * scales[g];
+            }
+
+        stream strm(eng);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src_m}, {DNNL_ARG_WEIGHTS, wei_m},
+                        {DNNL_ARG_DST, dst_m},
+                        {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, scales_m},
+                        {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS,
+                                zp_m}});
+        strm.wait();
+
+        auto dst_ptr = map_memory<float>(dst_m);
+        for (memory::dim m = 0; m < M; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float ref = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    ref += src[m * K + k] * wei_f[k * N + n];
+                const float eps = 1e-4f * (1.f + std::fabs(ref));
+                ASSERT_NEAR(dst_ptr[m * N + n], ref, eps)
+                        << "m: " << m << " n: " << n;
+            }
+    }
+};
+
+CPU_TEST_F(matmul_wei_decompression_test_t, TestS4) {
+    check(data_type::s4, data_type::s8);
+}
+
+CPU_TEST_F(matmul_wei_decompression_test_t, TestU4) {
+    check(data_type::u4, data_type::u8);
+}
+
+CPU_TEST_F(matmul_wei_decompression_test_t, TestS8) {
+    check(data_type::s8, data_type::s32);
+}
+
 } // namespace dnnl
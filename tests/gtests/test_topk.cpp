@@ -0,0 +1,161 @@
+/*******************************************************************************
+* Copyright 2024 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct topk_test_params_t {
+    memory::format_tag tag;
+    memory::dims src_dims;
+    int axis;
+    memory::dim k;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class topk_test_t : public ::testing::TestWithParam<topk_test_params_t> {
+private:
+    topk_test_params_t p;
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<topk_test_params_t>::GetParam();
+
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using pd_t = topk::primitive_desc;
+        using dt = memory::data_type;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const int ndims = (int)p.src_dims.size();
+        memory::dims dst_dims = p.src_dims;
+        if (p.axis < ndims) dst_dims[p.axis] = p.k;
+
+        auto desc_src = memory::desc(p.src_dims, dt::f32, p.tag);
+        auto desc_dst = memory::desc(dst_dims, dt::f32, p.tag);
+        auto desc_idx = memory::desc(dst_dims, dt::s32, p.tag);
+
+        auto pd = pd_t(eng, desc_src, desc_dst, desc_idx, p.axis);
+        auto prim = topk(pd);
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC)
+                == pd.src_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST)
+                == pd.dst_desc());
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST_INDICES)
+                == pd.dst_indices_desc());
+        ASSERT_EQ(pd.get_axis(), p.axis);
+
+        auto mem_src = test::make_memory(pd.src_desc(), eng);
+        auto mem_dst = test::make_memory(pd.dst_desc(), eng);
+        auto mem_idx = test::make_memory(pd.dst_indices_desc(), eng);
+
+        // Few distinct values so that the ordering of ties is checked.
+        memory::dim nelems = 1;
+        for (int d = 0; d < ndims; ++d)
+            nelems *= p.src_dims[d];
+        {
+            auto src = map_memory<float>(mem_src);
+            for (memory::dim i = 0; i < nelems; ++i)
+                src[i] = (float)((i * 7919) % 97) - 48.f;
+        }
+
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, mem_src}, {DNNL_ARG_DST, mem_dst},
+                        {DNNL_ARG_DST_INDICES, mem_idx}});
+        strm.wait();
+
+        // Plain layouts only: rows along the axis are strided by `inner`.
+        const memory::dim axis_size = p.src_dims[p.axis];
+        memory::dim inner = 1;
+        for (int d = p.axis + 1; d < ndims; ++d)
+            inner *= p.src_dims[d];
+        const memory::dim outer = nelems / (axis_size * inner);
+
+        auto src = map_memory<float>(mem_src);
+        auto dst = map_memory<float>(mem_dst);
+        auto idx = map_memory<int32_t>(mem_idx);
+        std::vector<memory::dim> order(axis_size);
+        for (memory::dim o = 0; o < outer; ++o)
+            for (memory::dim i = 0; i < inner; ++i) {
+                const float *s = &src[o * axis_size * inner + i];
+                std::iota(order.begin(), order.end(), 0);
+                std::stable_sort(order.begin(), order.end(),
+                        [&](memory::dim a, memory::dim b) {
+                            return s[a * inner] > s[b * inner];
+                        });
+                for (memory::dim j = 0; j < p.k; ++j) {
+                    const memory::dim off = (o * p.k + j) * inner + i;
+                    ASSERT_EQ(idx[off], order[j]);
+                    ASSERT_EQ(dst[off], s[order[j] * inner]);
+                }
+            }
+    }
+};
+
+using tag = memory::format_tag;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // k exceeds the axis size
+            topk_test_params_t {tag::ab, {2, 4}, 1, 5, true,
+                    dnnl_invalid_arguments},
+            // k is zero
+            topk_test_params_t {tag::ab, {2, 4}, 1, 0, true,
+                    dnnl_invalid_arguments},
+            // axis out of range
+            topk_test_params_t {tag::ab, {2, 4}, 2, 1, true,
+                    dnnl_invalid_arguments});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(topk_test_params_t {tag::ab, {1, 16}, 1, 1},
+            topk_test_params_t {tag::ab, {3, 100}, 1, 5},
+            topk_test_params_t {tag::ab, {7, 1000}, 1, 64},
+            topk_test_params_t {tag::abc, {2, 50, 3}, 1, 10},
+            topk_test_params_t {tag::abc, {4, 3, 20}, 0, 2},
+            topk_test_params_t {tag::ab, {5, 37}, 1, 37});
+};
+
+// Rows long enough to be split between threads when there are only a few.
+static auto long_rows = []() {
+    return ::testing::Values(topk_test_params_t {tag::ab, {1, 100000}, 1, 1},
+            topk_test_params_t {tag::ab, {1, 100000}, 1, 64},
+            topk_test_params_t {tag::ab, {2, 65536}, 1, 100});
+};
+
+TEST_P(topk_test_t, TestsTopk) {}
+INSTANTIATE_TEST_SUITE_P(TestTopkEF, topk_test_t, expected_failures());
+INSTANTIATE_TEST_SUITE_P(TestTopkSimple, topk_test_t, simple_cases());
+INSTANTIATE_TEST_SUITE_P(TestTopkLongRows, topk_test_t, long_rows());
+
+} // namespace dnnl